@@ -0,0 +1,237 @@
+
+/* 
+ * Copyright (C) Jan 2019 Mellanox Technologies Ltd. All rights reserved.
+ * 
+ * This software is available to you under a choice of one of two
+ * licenses.  You may choose to be licensed under the terms of the GNU
+ * General Public License (GPL) Version 2, available from the file
+ * COPYING in the main directory of this source tree, or the
+ * OpenIB.org BSD license below:
+ * 
+ *     Redistribution and use in source and binary forms, with or
+ *     without modification, are permitted provided that the following
+ *     conditions are met:
+ * 
+ *      - Redistributions of source code must retain the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer.
+ * 
+ *      - Redistributions in binary form must reproduce the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer in the documentation and/or other materials
+ *        provided with the distribution.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+ *
+ */
+
+/*
+ * adb2cpp - emits a header-only C++ view of access registers: one struct per
+ * register with an AdbRegField per leaf field, so hot code can address a
+ * field by type instead of looking its name up in the parsed ADB.
+ *
+ * Usage: adb2cpp <adb file> <root node> <output header> REG [REG ...]
+ *
+ * The root node is the access register union (or a node holding it as
+ * "access_reg_summary"), registers are given by their union selector value.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+#include <fstream>
+#include <set>
+#include "adb_parser.h"
+
+// license block of the generated header, the same one adb2c puts on its layouts
+static const char *licenseHeader =
+    "/*\n"
+    " * Copyright (c) 2020 Mellanox Technologies Ltd.  All rights reserved.\n"
+    " *\n"
+    " * This software is available to you under a choice of one of two\n"
+    " * licenses.  You may choose to be licensed under the terms of the GNU\n"
+    " * General Public License (GPL) Version 2, available from the file\n"
+    " * COPYING in the main directory of this source tree, or the\n"
+    " * OpenIB.org BSD license below:\n"
+    " *\n"
+    " *     Redistribution and use in source and binary forms, with or\n"
+    " *     without modification, are permitted provided that the following\n"
+    " *     conditions are met:\n"
+    " *\n"
+    " *      - Redistributions of source code must retain the above\n"
+    " *        copyright notice, this list of conditions and the following\n"
+    " *        disclaimer.\n"
+    " *\n"
+    " *      - Redistributions in binary form must reproduce the above\n"
+    " *        copyright notice, this list of conditions and the following\n"
+    " *        disclaimer in the documentation and/or other materials\n"
+    " *        provided with the distribution.\n"
+    " *\n"
+    " * THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND,\n"
+    " * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF\n"
+    " * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND\n"
+    " * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS\n"
+    " * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN\n"
+    " * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN\n"
+    " * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE\n"
+    " * SOFTWARE.\n"
+    " */\n";
+
+static const char *cppKeywords[] = {
+    "and", "asm", "auto", "bool", "break", "case", "catch", "char", "class",
+    "const", "continue", "default", "delete", "do", "double", "else", "enum",
+    "explicit", "export", "extern", "false", "float", "for", "friend", "goto",
+    "if", "inline", "int", "long", "mutable", "namespace", "new", "not",
+    "operator", "or", "private", "protected", "public", "register", "return",
+    "short", "signed", "sizeof", "static", "struct", "switch", "template",
+    "this", "throw", "true", "try", "typedef", "typeid", "typename", "union",
+    "unsigned", "using", "virtual", "void", "volatile", "while", "xor",
+    // members of the generated structs
+    "name", "size", "offset", "fields", "reg", NULL
+};
+
+static string toIdentifier(const string &name)
+{
+    string id;
+    for (size_t i = 0; i < name.size(); i++) {
+        char c = name[i];
+        if (isalnum(c) || c == '_') {
+            id += c;
+        } else if (c != ']') {
+            id += '_';
+        }
+    }
+    if (id.empty() || isdigit(id[0])) {
+        id = "f_" + id;
+    }
+    return id;
+}
+
+static string uniqueIdentifier(const string &name, set<string> &used)
+{
+    string id = toIdentifier(name);
+    for (int i = 0; cppKeywords[i]; i++) {
+        if (id == cppKeywords[i]) {
+            id += "_";
+            break;
+        }
+    }
+    while (used.count(id)) {
+        id += "_";
+    }
+    used.insert(id);
+    return id;
+}
+
+static string guardName(const string &path)
+{
+    string base = path.substr(path.find_last_of('/') + 1);
+    string guard;
+    for (size_t i = 0; i < base.size(); i++) {
+        guard += isalnum(base[i]) ? (char)toupper(base[i]) : '_';
+    }
+    return guard;
+}
+
+static void emitRegister(ostream &out, const string &regName, AdbInstance *reg)
+{
+    vector<AdbInstance*> leaves = reg->getLeafFields(true);
+    set<string> usedIds, seenNames;
+    char buf[256];
+
+    usedIds.insert(regName);
+    out << "struct " << regName << " {\n";
+    out << "    static const char* name() { return \"" << regName << "\"; }\n";
+    snprintf(buf, sizeof(buf), "0x%x", reg->size);
+    out << "    static constexpr u_int32_t size = " << buf << ";\n\n";
+
+    string table;
+    for (size_t i = 0; i < leaves.size(); i++) {
+        const string &fieldName = leaves[i]->name;
+        // the runtime lookup resolves duplicate names to the first leaf
+        if (!seenNames.insert(fieldName).second) {
+            continue;
+        }
+        string id = uniqueIdentifier(fieldName, usedIds);
+        snprintf(buf, sizeof(buf), "AdbRegField<0x%x, %u>", leaves[i]->offset, leaves[i]->size);
+        out << "    struct " << id << " : " << buf << " {\n";
+        out << "        typedef " << regName << " reg;\n";
+        out << "        static const char* name() { return \"" << fieldName << "\"; }\n";
+        out << "    };\n";
+        snprintf(buf, sizeof(buf), "            { \"%s\", 0x%x, %u },\n",
+                fieldName.c_str(), leaves[i]->offset, leaves[i]->size);
+        table += buf;
+    }
+
+    out << "\n    static const AdbRegFieldDesc* fields(size_t &count)\n";
+    out << "    {\n";
+    out << "        static const AdbRegFieldDesc table[] = {\n";
+    out << table;
+    out << "        };\n";
+    out << "        count = sizeof(table) / sizeof(table[0]);\n";
+    out << "        return table;\n";
+    out << "    }\n";
+    out << "};\n\n";
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 5) {
+        fprintf(stderr, "Usage: %s <adb file> <root node> <output header> REG [REG ...]\n", argv[0]);
+        return 1;
+    }
+    string adbFile = argv[1], rootName = argv[2], outFile = argv[3];
+
+    Adb adb;
+    if (!adb.load(adbFile, false, NULL, false)) {
+        fprintf(stderr, "-E- Failed to load %s: %s\n", adbFile.c_str(), adb.getLastError().c_str());
+        return 1;
+    }
+    AdbInstance *root = adb.createLayout(rootName, false, NULL, -1, false, false, true);
+    if (!root) {
+        fprintf(stderr, "-E- Failed to create layout %s: %s\n", rootName.c_str(), adb.getLastError().c_str());
+        return 1;
+    }
+
+    string guard = guardName(outFile);
+    ofstream out(outFile.c_str());
+    out << licenseHeader << "\n";
+    out << "/* Generated by adb2cpp from "
+        << adbFile.substr(adbFile.find_last_of('/') + 1) << ", do not edit */\n\n";
+    out << "#ifndef " << guard << "\n#define " << guard << "\n\n";
+    out << "#include <adb_parser/adb_reg_field.h>\n\n";
+    out << "namespace adb_regs {\n\n";
+
+    int rc = 0;
+    try {
+        AdbInstance *regUnion = root->getChildByPath("access_reg_summary");
+        if (!regUnion) {
+            regUnion = root;
+        }
+        for (int i = 4; i < argc; i++) {
+            emitRegister(out, argv[i], regUnion->getUnionSelectedNodeName(string(argv[i])));
+        }
+    } catch (AdbException &exp) {
+        fprintf(stderr, "-E- %s\n", exp.what());
+        rc = 1;
+    }
+
+    out << "} // namespace adb_regs\n\n";
+    out << "#endif // " << guard << "\n";
+    out.close();
+    if (rc || !out) {
+        fprintf(stderr, "-E- Failed to write %s\n", outFile.c_str());
+        remove(outFile.c_str());
+        rc = 1;
+    }
+    delete root;
+    return rc;
+}
@@ -0,0 +1,570 @@
+
+/* 
+ * Copyright (C) Jan 2019 Mellanox Technologies Ltd. All rights reserved.
+ * 
+ * This software is available to you under a choice of one of two
+ * licenses.  You may choose to be licensed under the terms of the GNU
+ * General Public License (GPL) Version 2, available from the file
+ * COPYING in the main directory of this source tree, or the
+ * OpenIB.org BSD license below:
+ * 
+ *     Redistribution and use in source and binary forms, with or
+ *     without modification, are permitted provided that the following
+ *     conditions are met:
+ * 
+ *      - Redistributions of source code must retain the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer.
+ * 
+ *      - Redistributions in binary form must reproduce the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer in the documentation and/or other materials
+ *        provided with the distribution.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#ifndef __WIN__
+#include <fcntl.h>
+#include <unistd.h>
+#include <pwd.h>
+#include <sys/mman.h>
+#endif
+#ifdef __WIN__
+#include <process.h>
+#include <direct.h>
+#define OS_PATH_SEP "\\"
+#else
+#define OS_PATH_SEP "/"
+#endif
+#include <sstream>
+#include <mft_utils/mft_thread_pool.h>
+#include "adb_cache.h"
+#include "adb_parser.h"
+
+#define ADB_CACHE_MAGIC     0x43424441 // "ADBC"
+#define ADB_CACHE_VERSION   1
+#define ADB_CACHE_HDR_WORDS 8
+#define ADB_CACHE_SUFFIX    ".adbc"
+
+enum {
+    FIELD_DEFINED_AS_ARR = 0x1,
+    FIELD_UNLIMITED_ARR  = 0x2,
+    FIELD_IS_RESERVED    = 0x4
+};
+
+/*************************** AdbCache::Writer ***************************/
+void AdbCache::Writer::putU32(u_int32_t val)
+{
+    _payload.push_back(val);
+}
+
+void AdbCache::Writer::putStr(const string &str)
+{
+    map<string, u_int32_t>::iterator it = _strIds.find(str);
+    if (it == _strIds.end()) {
+        it = _strIds.insert(make_pair(str, (u_int32_t)_strs.size())).first;
+        _strs.push_back(str);
+    }
+    putU32(it->second);
+}
+
+void AdbCache::Writer::putAttrs(const map<string, string> &attrs)
+{
+    putU32(attrs.size());
+    for (map<string, string>::const_iterator it = attrs.begin(); it != attrs.end(); it++) {
+        putStr(it->first);
+        putStr(it->second);
+    }
+}
+
+void AdbCache::Writer::putField(const AdbField *field)
+{
+    putStr(field->name);
+    putU32(field->size);
+    putU32(field->offset);
+    putStr(field->desc);
+    putU32((field->definedAsArr ? FIELD_DEFINED_AS_ARR : 0) | (field->unlimitedArr ? FIELD_UNLIMITED_ARR : 0) |
+           (field->isReserved ? FIELD_IS_RESERVED : 0));
+    putU32(field->lowBound);
+    putU32(field->highBound);
+    putStr(field->subNode);
+    putStr(field->condition);
+    putAttrs(field->attrs);
+}
+
+/*
+ * Layout (native endianness, the magic tells a foreign file apart):
+ *   header:  magic, version, options, #strings, string table bytes, #payload words, hash lo, hash hi
+ *   strings: u32 length + bytes, padded to 4 bytes
+ *   payload: u32 words, strings are referenced by index
+ */
+void AdbCache::Writer::serialize(vector<u_int8_t> &out, u_int64_t contentHash, u_int32_t options)
+{
+    vector<u_int32_t> strTable;
+    for (size_t i = 0; i < _strs.size(); i++) {
+        size_t words = (_strs[i].size() + 3) / 4;
+        size_t pos = strTable.size();
+        strTable.resize(pos + 1 + words, 0);
+        strTable[pos] = _strs[i].size();
+        if (_strs[i].size()) {
+            memcpy(&strTable[pos + 1], _strs[i].data(), _strs[i].size());
+        }
+    }
+    u_int32_t hdr[ADB_CACHE_HDR_WORDS] = {ADB_CACHE_MAGIC, ADB_CACHE_VERSION, options, (u_int32_t)_strs.size(),
+                                          (u_int32_t)(strTable.size() * 4), (u_int32_t)_payload.size(),
+                                          (u_int32_t)contentHash, (u_int32_t)(contentHash >> 32)};
+    out.resize(sizeof(hdr) + strTable.size() * 4 + _payload.size() * 4);
+    memcpy(&out[0], hdr, sizeof(hdr));
+    if (strTable.size()) {
+        memcpy(&out[sizeof(hdr)], &strTable[0], strTable.size() * 4);
+    }
+    if (_payload.size()) {
+        memcpy(&out[sizeof(hdr) + strTable.size() * 4], &_payload[0], _payload.size() * 4);
+    }
+}
+
+/*************************** AdbCache::Reader ***************************/
+AdbCache::Reader::Reader(const u_int8_t *buf, size_t size) :
+    _buf(buf), _size(size), _payload(NULL), _payloadLen(0), _pos(0), _ok(false)
+{
+}
+
+bool AdbCache::Reader::init(u_int64_t contentHash, u_int32_t options)
+{
+    const u_int32_t *hdr = (const u_int32_t*)_buf;
+    if (_size < ADB_CACHE_HDR_WORDS * 4 || hdr[0] != ADB_CACHE_MAGIC || hdr[1] != ADB_CACHE_VERSION ||
+        hdr[2] != options || hdr[6] != (u_int32_t)contentHash || hdr[7] != (u_int32_t)(contentHash >> 32)) {
+        return false;
+    }
+    u_int64_t strBytes = hdr[4];
+    u_int64_t payloadBytes = (u_int64_t)hdr[5] * 4;
+    if ((strBytes % 4) || ADB_CACHE_HDR_WORDS * 4 + strBytes + payloadBytes != _size) {
+        return false;
+    }
+    const u_int32_t *strTable = hdr + ADB_CACHE_HDR_WORDS;
+    size_t strWords = strBytes / 4;
+    size_t pos = 0;
+    // every string takes at least its length word
+    if (hdr[3] > strWords) {
+        return false;
+    }
+    _strOffsets.reserve(hdr[3]);
+    for (u_int32_t i = 0; i < hdr[3]; i++) {
+        if (pos >= strWords || ((u_int64_t)strTable[pos] + 3) / 4 > strWords - pos - 1) {
+            return false;
+        }
+        _strOffsets.push_back(pos);
+        pos += 1 + ((u_int64_t)strTable[pos] + 3) / 4;
+    }
+    _payload = strTable + strWords;
+    _payloadLen = hdr[5];
+    _ok = true;
+    return true;
+}
+
+bool AdbCache::Reader::getU32(u_int32_t &val)
+{
+    if (_pos >= _payloadLen) {
+        _ok = false;
+        val = 0;
+        return false;
+    }
+    val = _payload[_pos++];
+    return true;
+}
+
+bool AdbCache::Reader::getStr(string &str)
+{
+    u_int32_t id;
+    if (!getU32(id) || id >= _strOffsets.size()) {
+        _ok = false;
+        return false;
+    }
+    const u_int32_t *entry = (const u_int32_t*)_buf + ADB_CACHE_HDR_WORDS + _strOffsets[id];
+    str.assign((const char*)(entry + 1), entry[0]);
+    return true;
+}
+
+bool AdbCache::Reader::getAttrs(map<string, string> &attrs)
+{
+    u_int32_t num;
+    if (!getU32(num)) {
+        return false;
+    }
+    for (u_int32_t i = 0; i < num && _ok; i++) {
+        string key;
+        getStr(key);
+        // written in map order, so every insert goes to the end
+        map<string, string>::iterator it = attrs.insert(attrs.end(), make_pair(key, string()));
+        getStr(it->second);
+    }
+    return _ok;
+}
+
+AdbField* AdbCache::Reader::getField()
+{
+    AdbField *field = new AdbField;
+    u_int32_t flags = 0;
+    getStr(field->name);
+    getU32(field->size);
+    getU32(field->offset);
+    getStr(field->desc);
+    getU32(flags);
+    getU32(field->lowBound);
+    getU32(field->highBound);
+    getStr(field->subNode);
+    getStr(field->condition);
+    getAttrs(field->attrs);
+    field->definedAsArr = (flags & FIELD_DEFINED_AS_ARR) != 0;
+    field->unlimitedArr = (flags & FIELD_UNLIMITED_ARR) != 0;
+    field->isReserved = (flags & FIELD_IS_RESERVED) != 0;
+    return field;
+}
+
+/*************************** AdbCache ***************************/
+bool AdbCache::isEnabled()
+{
+    return getenv("ADB_DISABLE_CACHE") == NULL;
+}
+
+// root or setuid: the environment belongs to whoever started us
+bool AdbCache::isPrivileged()
+{
+#ifndef __WIN__
+    return geteuid() == 0 || geteuid() != getuid();
+#else
+    return false;
+#endif
+}
+
+// a cache dir is only used when nobody else could have put files in it
+bool AdbCache::isTrustedDir(const string &dir)
+{
+#ifndef __WIN__
+    struct stat st;
+    return stat(dir.c_str(), &st) == 0 && S_ISDIR(st.st_mode) &&
+           st.st_uid == geteuid() && (st.st_mode & (S_IWGRP | S_IWOTH)) == 0;
+#else
+    (void)dir;
+    return true;
+#endif
+}
+
+const u_int8_t* AdbCache::mapFile(const string &fname, size_t &size, bool isCache)
+{
+#ifndef __WIN__
+    struct stat st;
+    int fd = open(fname.c_str(), isCache ? O_RDONLY | O_NOFOLLOW : O_RDONLY);
+    if (fd < 0) {
+        return NULL;
+    }
+    if (fstat(fd, &st) || st.st_size <= 0) {
+        close(fd);
+        return NULL;
+    }
+    if (isCache && (!S_ISREG(st.st_mode) || st.st_uid != geteuid() ||
+                    (st.st_mode & (S_IWGRP | S_IWOTH)))) {
+        close(fd);
+        return NULL;
+    }
+    void *addr = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (addr == MAP_FAILED) {
+        return NULL;
+    }
+    size = st.st_size;
+    return (const u_int8_t*)addr;
+#else
+    (void)isCache;
+    FILE *fp = fopen(fname.c_str(), "rb");
+    if (!fp) {
+        return NULL;
+    }
+    fseek(fp, 0, SEEK_END);
+    long fsize = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    u_int8_t *buf = fsize > 0 ? (u_int8_t*)malloc(fsize) : NULL;
+    if (!buf || fread(buf, 1, fsize, fp) != (size_t)fsize) {
+        free(buf);
+        fclose(fp);
+        return NULL;
+    }
+    fclose(fp);
+    size = fsize;
+    return buf;
+#endif
+}
+
+void AdbCache::unmapFile(const u_int8_t *buf, size_t size)
+{
+#ifndef __WIN__
+    munmap((void*)buf, size);
+#else
+    (void)size;
+    free((void*)buf);
+#endif
+}
+
+// FNV-1a over 64 bit words, enough to tell .adb revisions apart
+u_int64_t AdbCache::hash(const u_int8_t *buf, size_t size)
+{
+    u_int64_t h = 0xcbf29ce484222325ULL;
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        u_int64_t word;
+        memcpy(&word, buf + i, 8);
+        h = (h ^ word) * 0x100000001b3ULL;
+    }
+    for (; i < size; i++) {
+        h = (h ^ buf[i]) * 0x100000001b3ULL;
+    }
+    return h ^ size;
+}
+
+string AdbCache::getCacheDir()
+{
+    if (!isPrivileged()) {
+        if (getenv("ADB_CACHE_DIR")) {
+            return getenv("ADB_CACHE_DIR");
+        }
+        if (getenv("HOME")) {
+            return string(getenv("HOME")) + OS_PATH_SEP + ".cache" + OS_PATH_SEP + "mft";
+        }
+    }
+#ifndef __WIN__
+    // privileged runs (e.g. sudo with HOME kept) take the home of the effective user
+    struct passwd pwd;
+    struct passwd *res = NULL;
+    char pwBuf[4096];
+    if (getpwuid_r(geteuid(), &pwd, pwBuf, sizeof(pwBuf), &res) == 0 && res && res->pw_dir) {
+        return string(res->pw_dir) + OS_PATH_SEP + ".cache" + OS_PATH_SEP + "mft";
+    }
+#endif
+    return "";
+}
+
+string AdbCache::getCachePath(const string &fname)
+{
+    size_t sep = fname.find_last_of("/\\");
+    string base = sep == string::npos ? fname : fname.substr(sep + 1);
+    string cacheDir = getCacheDir();
+    if (cacheDir == "") {
+        return "";
+    }
+    // different .adb files may share a name, tell them apart by their path
+    stringstream name;
+    name << cacheDir << OS_PATH_SEP << base << "." << hex << hash((const u_int8_t*)fname.data(), fname.size())
+         << ADB_CACHE_SUFFIX;
+    return name.str();
+}
+
+bool AdbCache::loadFrom(Adb *adb, const string &cachePath, u_int64_t contentHash, u_int32_t options)
+{
+    size_t size = 0;
+    if (!isTrustedDir(cachePath.substr(0, cachePath.find_last_of(OS_PATH_SEP)))) {
+        return false;
+    }
+    const u_int8_t *buf = mapFile(cachePath, size, true);
+    if (!buf) {
+        return false;
+    }
+    Reader r(buf, size);
+    if (!r.init(contentHash, options)) {
+        unmapFile(buf, size);
+        return false;
+    }
+
+    u_int32_t num = 0, val = 0;
+    r.getStr(adb->version);
+    r.getStr(adb->rootNode);
+    r.getStr(adb->srcDocName);
+    r.getStr(adb->srcDocVer);
+    r.getU32(val);
+    adb->bigEndianArr = val != 0;
+    r.getU32(val);
+    adb->singleEntryArrSupp = val != 0;
+
+    r.getU32(num);
+    for (u_int32_t i = 0; i < num && r.ok(); i++) {
+        AdbConfig *config = new AdbConfig;
+        adb->configs.push_back(config);
+        r.getAttrs(config->attrs);
+        r.getAttrs(config->enums);
+    }
+
+    r.getU32(num);
+    for (u_int32_t i = 0; i < num && r.ok(); i++) {
+        string key;
+        r.getStr(key);
+        r.getAttrs(adb->instAttrs[key]);
+    }
+
+    r.getU32(num);
+    for (u_int32_t i = 0; i < num && r.ok(); i++) {
+        string key;
+        AdbNode *node = new AdbNode;
+        r.getStr(key);
+        adb->nodesMap.insert(adb->nodesMap.end(), make_pair(key, node));
+        r.getStr(node->name);
+        r.getU32(node->size);
+        r.getU32(val);
+        node->isUnion = val != 0;
+        r.getStr(node->desc);
+        r.getStr(node->fileName);
+        r.getU32(val);
+        node->lineNumber = (int)val;
+        r.getAttrs(node->attrs);
+        u_int32_t numFields = 0;
+        r.getU32(numFields);
+        for (u_int32_t j = 0; j < numFields && r.ok(); j++) {
+            node->fields.push_back(r.getField());
+        }
+        r.getU32(numFields);
+        for (u_int32_t j = 0; j < numFields && r.ok(); j++) {
+            node->condFields.push_back(r.getField());
+        }
+    }
+    bool ok = r.ok();
+    unmapFile(buf, size);
+
+    if (!ok) {
+        // corrupted cache, leave the adb as empty as it was
+        for (size_t i = 0; i < adb->configs.size(); i++) {
+            delete adb->configs[i];
+        }
+        adb->configs.clear();
+        for (NodesMap::iterator it = adb->nodesMap.begin(); it != adb->nodesMap.end(); it++) {
+            delete it->second;
+        }
+        adb->nodesMap.clear();
+        adb->instAttrs.clear();
+    }
+    return ok;
+}
+
+bool AdbCache::load(Adb *adb, const string &fname, u_int32_t options)
+{
+    size_t size = 0;
+    const u_int8_t *buf = mapFile(fname, size);
+    if (!buf) {
+        return false;
+    }
+    u_int64_t contentHash = hash(buf, size);
+    unmapFile(buf, size);
+
+    string cachePath = getCachePath(fname);
+    return cachePath != "" && loadFrom(adb, cachePath, contentHash, options);
+}
+
+// tells apart the temporary files of threads storing the same cache
+static u_int32_t nextTmpId()
+{
+    static mft_utils::MftMutex lock;
+    static u_int32_t tmpId = 0;
+    mft_utils::MftLockGuard guard(lock);
+    return tmpId++;
+}
+
+void AdbCache::store(Adb *adb, const string &fname, u_int32_t options)
+{
+    size_t size = 0;
+    const u_int8_t *buf = mapFile(fname, size);
+    if (!buf) {
+        return;
+    }
+    u_int64_t contentHash = hash(buf, size);
+    unmapFile(buf, size);
+
+    Writer w;
+    w.putStr(adb->version);
+    w.putStr(adb->rootNode);
+    w.putStr(adb->srcDocName);
+    w.putStr(adb->srcDocVer);
+    w.putU32(adb->bigEndianArr);
+    w.putU32(adb->singleEntryArrSupp);
+    w.putU32(adb->configs.size());
+    for (size_t i = 0; i < adb->configs.size(); i++) {
+        w.putAttrs(adb->configs[i]->attrs);
+        w.putAttrs(adb->configs[i]->enums);
+    }
+    w.putU32(adb->instAttrs.size());
+    for (InstanceAttrs::iterator it = adb->instAttrs.begin(); it != adb->instAttrs.end(); it++) {
+        w.putStr(it->first);
+        w.putAttrs(it->second);
+    }
+    w.putU32(adb->nodesMap.size());
+    for (NodesMap::iterator it = adb->nodesMap.begin(); it != adb->nodesMap.end(); it++) {
+        AdbNode *node = it->second;
+        w.putStr(it->first);
+        w.putStr(node->name);
+        w.putU32(node->size);
+        w.putU32(node->isUnion);
+        w.putStr(node->desc);
+        w.putStr(node->fileName);
+        w.putU32((u_int32_t)node->lineNumber);
+        w.putAttrs(node->attrs);
+        w.putU32(node->fields.size());
+        for (size_t i = 0; i < node->fields.size(); i++) {
+            w.putField(node->fields[i]);
+        }
+        w.putU32(node->condFields.size());
+        for (size_t i = 0; i < node->condFields.size(); i++) {
+            w.putField(node->condFields[i]);
+        }
+    }
+    vector<u_int8_t> out;
+    w.serialize(out, contentHash, options);
+
+    string cachePath = getCachePath(fname);
+    if (cachePath == "") {
+        return;
+    }
+    string dir = cachePath.substr(0, cachePath.find_last_of(OS_PATH_SEP));
+    string parent = dir.substr(0, dir.find_last_of(OS_PATH_SEP));
+#ifndef __WIN__
+    mkdir(parent.c_str(), 0700);
+    mkdir(dir.c_str(), 0700);
+#else
+    mkdir(parent.c_str());
+    mkdir(dir.c_str());
+#endif
+    if (!isTrustedDir(dir)) {
+        return;
+    }
+    // concurrent loads each write their own file, the last rename wins
+    stringstream tmpPath;
+    tmpPath << cachePath << ".tmp." << getpid() << "." << nextTmpId();
+#ifndef __WIN__
+    int fd = open(tmpPath.str().c_str(), O_WRONLY | O_CREAT | O_EXCL | O_NOFOLLOW, 0600);
+    FILE *fp = fd < 0 ? NULL : fdopen(fd, "wb");
+    if (!fp && fd >= 0) {
+        close(fd);
+    }
+#else
+    FILE *fp = fopen(tmpPath.str().c_str(), "wb");
+#endif
+    if (!fp) {
+        return;
+    }
+    bool written = fwrite(&out[0], 1, out.size(), fp) == out.size();
+    written = (fclose(fp) == 0) && written;
+    if (written && rename(tmpPath.str().c_str(), cachePath.c_str()) == 0) {
+        return;
+    }
+    remove(tmpPath.str().c_str());
+}
@@ -0,0 +1,115 @@
+
+/* 
+ * Copyright (C) Jan 2019 Mellanox Technologies Ltd. All rights reserved.
+ * 
+ * This software is available to you under a choice of one of two
+ * licenses.  You may choose to be licensed under the terms of the GNU
+ * General Public License (GPL) Version 2, available from the file
+ * COPYING in the main directory of this source tree, or the
+ * OpenIB.org BSD license below:
+ * 
+ *     Redistribution and use in source and binary forms, with or
+ *     without modification, are permitted provided that the following
+ *     conditions are met:
+ * 
+ *      - Redistributions of source code must retain the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer.
+ * 
+ *      - Redistributions in binary form must reproduce the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer in the documentation and/or other materials
+ *        provided with the distribution.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+ *
+ */
+
+#ifndef ADB_CACHE_H
+#define ADB_CACHE_H
+
+#include <string>
+#include <vector>
+#include <map>
+#include <common/compatibility.h>
+
+using namespace std;
+
+class Adb;
+class AdbNode;
+class AdbField;
+
+/*
+ * Compiled form of a parsed .adb file: the nodes, fields, configs and
+ * instance attributes of an Adb object with all strings interned in one
+ * table, so loading it is a single read plus object construction instead of
+ * an XML parse.
+ *
+ * The cache is kept per user under $ADB_CACHE_DIR or $HOME/.cache/mft, never
+ * next to the .adb. Root and setuid runs ignore the environment and use the
+ * home of the effective user. A cache file is only read when it and its
+ * directory are owned by the effective user and not group/world writable,
+ * since the offsets in it drive register access. It is keyed by a hash of
+ * the .adb contents and the load options, so an edited .adb is simply parsed
+ * again and its cache rewritten. ADB_DISABLE_CACHE turns the cache off.
+ */
+class AdbCache {
+public:
+    static bool isEnabled();
+    // fills an empty adb from the cache of fname, false if there is no valid cache for it
+    static bool load(Adb *adb, const string &fname, u_int32_t options);
+    // best effort, a cache that can't be written is just not used
+    static void store(Adb *adb, const string &fname, u_int32_t options);
+
+private:
+    class Writer {
+    public:
+        void putU32(u_int32_t val);
+        void putStr(const string &str);
+        void putAttrs(const map<string, string> &attrs);
+        void putField(const AdbField *field);
+        void serialize(vector<u_int8_t> &out, u_int64_t contentHash, u_int32_t options);
+    private:
+        map<string, u_int32_t> _strIds;
+        vector<string> _strs;
+        vector<u_int32_t> _payload;
+    };
+
+    class Reader {
+    public:
+        Reader(const u_int8_t *buf, size_t size);
+        bool init(u_int64_t contentHash, u_int32_t options);
+        bool getU32(u_int32_t &val);
+        bool getStr(string &str);
+        bool getAttrs(map<string, string> &attrs);
+        AdbField* getField();
+        bool ok() const { return _ok; }
+    private:
+        const u_int8_t *_buf;
+        size_t _size;
+        const u_int32_t *_payload;
+        size_t _payloadLen;
+        size_t _pos;
+        vector<u_int32_t> _strOffsets;
+        bool _ok;
+    };
+
+    static bool isPrivileged();
+    static bool isTrustedDir(const string &dir);
+    static const u_int8_t* mapFile(const string &fname, size_t &size, bool isCache = false);
+    static void unmapFile(const u_int8_t *buf, size_t size);
+    static u_int64_t hash(const u_int8_t *buf, size_t size);
+    static string getCacheDir();
+    static string getCachePath(const string &fname);
+    static bool loadFrom(Adb *adb, const string &cachePath, u_int64_t contentHash, u_int32_t options);
+};
+
+#endif // ADB_CACHE_H
@@ -42,11 +42,15 @@
 
 #include <vector>
 #include <stdio.h>
+#include <stdarg.h>
 #include <boost/algorithm/string.hpp>
 #include <boost/lexical_cast.hpp>
+#include <mft_utils/mft_thread_pool.h>
 #include "adb_db.h"
 #include "adb_parser.h"
 
+using namespace mft_utils;
+
 #define CHECK_FIELD(field, node_w) \
     if (((AdbInstance*)field)->isReserved()) { \
         continue; \
@@ -57,21 +61,52 @@
         continue; \
     }
 
+#if defined(_MSC_VER)
+#define ADB_DB_TLS __declspec(thread)
+#else
+#define ADB_DB_TLS __thread
+#endif
+
+#define ADB_DB_ERR_LEN 1024
+
+struct db_wrapper
+{
+    Adb *adb;
+    // Adb::load/createLayout keep working state in the Adb object
+    MftMutex lock;
+    char err[ADB_DB_ERR_LEN];
+};
+
 struct node_wrapper
 {
     AdbInstance *node;
     vector<AdbInstance*> *fields;
+    char err[ADB_DB_ERR_LEN];
 };
 
-static char err[1024] = {0};
+// last error of the calling thread, whatever handle it came from
+static ADB_DB_TLS char last_err[ADB_DB_ERR_LEN];
+
+static void set_err(char *handle_err, const char *fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    vsnprintf(last_err, sizeof(last_err), fmt, args);
+    va_end(args);
+    if (handle_err) {
+        strcpy(handle_err, last_err);
+    }
+}
 
 /**
  * db_create
  */
 adb_db_t* db_create()
 {
-    return new Adb();
-
+    struct db_wrapper *db_w = new db_wrapper;
+    db_w->adb = new Adb();
+    db_w->err[0] = '\0';
+    return db_w;
 }
 
 /**
@@ -79,8 +114,10 @@ adb_db_t* db_create()
  */
 int db_load(adb_db_t *db, const char *adb_file_path, int add_reserved)
 {
-    if (!((Adb*)db)->load(adb_file_path, add_reserved, NULL, false)) {
-        sprintf(err, "Failed to load adabe project: %s", ((Adb*)db)->getLastError().c_str());
+    struct db_wrapper *db_w = (struct db_wrapper*)db;
+    MftLockGuard guard(db_w->lock);
+    if (!db_w->adb->load(adb_file_path, add_reserved, NULL, false)) {
+        set_err(db_w->err, "Failed to load adabe project: %s", db_w->adb->getLastError().c_str());
         return 1;
     }
 
@@ -92,8 +129,10 @@ int db_load(adb_db_t *db, const char *adb_file_path, int add_reserved)
  */
 int db_load_from_str(adb_db_t *db, const char *adb_data, int add_reserved)
 {
-    if (!((Adb*)db)->loadFromString(adb_data, add_reserved, NULL, false)) {
-        sprintf(err, "Failed to load adabe project: %s", ((Adb*)db)->getLastError().c_str());
+    struct db_wrapper *db_w = (struct db_wrapper*)db;
+    MftLockGuard guard(db_w->lock);
+    if (!db_w->adb->loadFromString(adb_data, add_reserved, NULL, false)) {
+        set_err(db_w->err, "Failed to load adabe project: %s", db_w->adb->getLastError().c_str());
         return 1;
     }
 
@@ -105,19 +144,28 @@ int db_load_from_str(adb_db_t *db, const char *adb_data, int add_reserved)
  */
 void db_destroy(adb_db_t *db)
 {
-    if (db) {
-        delete (Adb*)db;
+    struct db_wrapper *db_w = (struct db_wrapper*)db;
+    if (db_w) {
+        delete db_w->adb;
+        delete db_w;
     }
 }
 
 /**
- * db_destroy
+ * db_get_last_err
  */
 const char* db_get_last_err()
 {
-    return err;
+    return last_err;
 }
 
+/**
+ * db_get_err
+ */
+const char* db_get_err(adb_db_t *db)
+{
+    return ((struct db_wrapper*)db)->err;
+}
 
 adb_limits_map_t* db_create_limits_map(adb_db_t *db)
 {
@@ -125,9 +173,10 @@ adb_limits_map_t* db_create_limits_map(adb_db_t *db)
 
     // Load defines
     if (db) {
-        for (size_t i = 0; i < ((Adb*)db)->configs.size(); i++) {
-            AttrsMap::iterator attrs_map = ((Adb*)db)->configs[i]->attrs.find("define");
-            if (attrs_map != ((Adb*)db)->configs[i]->attrs.end()) {
+        Adb *adb = ((struct db_wrapper*)db)->adb;
+        for (size_t i = 0; i < adb->configs.size(); i++) {
+            AttrsMap::iterator attrs_map = adb->configs[i]->attrs.find("define");
+            if (attrs_map != adb->configs[i]->attrs.end()) {
                 vector<string> defVal;
                 boost::algorithm::split(defVal, attrs_map->second, boost::is_any_of(string("=")));
 
@@ -156,16 +205,22 @@ void db_destroy_limits_map(adb_limits_map_t *limits)
  */
 adb_node_t* db_get_node(adb_db_t *db, const char *node_name)
 {
-    Adb *adb = (Adb*)db;
-    AdbInstance *node = adb->createLayout(node_name, false, NULL);
-    if (!node) {
-        sprintf(err, "Failed to create node %s: %s", node_name, adb->getLastError().c_str());
-        return NULL;
+    struct db_wrapper *db_w = (struct db_wrapper*)db;
+    AdbInstance *node;
+    {
+        // the layout is private to the caller, only its creation touches the db
+        MftLockGuard guard(db_w->lock);
+        node = db_w->adb->createLayout(node_name, false, NULL);
+        if (!node) {
+            set_err(db_w->err, "Failed to create node %s: %s", node_name, db_w->adb->getLastError().c_str());
+            return NULL;
+        }
     }
     struct node_wrapper *node_w = (struct node_wrapper*)malloc(sizeof(struct node_wrapper));
     if (!node_w) {
         delete node;
-        sprintf(err, "Failed to allocate memory for node");
+        MftLockGuard guard(db_w->lock);
+        set_err(db_w->err, "Failed to allocate memory for node");
         return NULL;
     }
     memset(node_w, 0, sizeof(*node_w));
@@ -192,6 +247,14 @@ void db_node_destroy(adb_node_t *node)
     }
 }
 
+/**
+ * db_node_get_err
+ */
+const char* db_node_get_err(adb_node_t *node)
+{
+    return ((struct node_wrapper*)node)->err;
+}
+
 /**
  * db_node_name
  */
@@ -224,12 +287,12 @@ int db_node_num_of_fields(adb_node_t *node)
  */
 adb_field_t* db_node_get_field(adb_node_t *node, int field_idx)
 {
+    struct node_wrapper *node_w = (struct node_wrapper*)node;
     if (field_idx >= db_node_num_of_fields(node)) {
-        sprintf(err, "index out of range");
+        set_err(node_w->err, "index out of range");
         return NULL;
     }
 
-    struct node_wrapper *node_w = (struct node_wrapper*)node;
     return node_w->fields->at(field_idx);
 }
 
@@ -259,7 +322,7 @@ adb_field_t* db_node_get_field_by_path(adb_node_t *node, const char *path, int i
         }
     }
 
-    sprintf(err, "Can't find field (%s)", path);
+    set_err(node_w->err, "Can't find field (%s)", path);
     return NULL;
 }
 
@@ -465,7 +528,8 @@ void db_print_nodes(adb_db_t *db)
     int i = 0;
 
     printf("DB nodes list:\n");
-    for (NodesMap::iterator iter = ((Adb*)db)->nodesMap.begin(); iter != ((Adb*)db)->nodesMap.end(); iter++) {
+    Adb *adb = ((struct db_wrapper*)db)->adb;
+    for (NodesMap::iterator iter = adb->nodesMap.begin(); iter != adb->nodesMap.end(); iter++) {
         i++;
         printf("%-5d) %s\n", i, iter->first.c_str());
     }
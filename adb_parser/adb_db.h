@@ -60,13 +60,21 @@ typedef enum
     DB_FORMAT_FULL_DETAILS
 } dump_format_t;
 
-// TODO - this API isn't thread-safe because of the error reporting mechanism
+/*
+ * Threading: independent handles may be used from different threads. A loaded
+ * db may be shared by several threads, db_get_node is serialized per db and
+ * the nodes it returns are owned by the caller. A node and its fields must be
+ * used by one thread at a time.
+ * Errors are kept per handle (db_get_err/db_node_get_err) and per thread
+ * (db_get_last_err, the last error raised by the calling thread).
+ */
 // DB Functions
 adb_db_t*       db_create();
 int             db_load(adb_db_t *db, const char *adb_file_path, int add_reserved);
 int             db_load_from_str(adb_db_t *db, const char *adb_data, int add_reserved);
 void            db_destroy(adb_db_t *db);
 const char*     db_get_last_err();
+const char*     db_get_err(adb_db_t *db);
 
 adb_limits_map_t* db_create_limits_map(adb_db_t *db);
 void            db_destroy_limits_map(adb_limits_map_t *limits);
@@ -74,6 +82,7 @@ void            db_destroy_limits_map(adb_limits_map_t *limits);
 // Node Functions - *** node contains flat fields (full path leaves) ***
 adb_node_t*     db_get_node(adb_db_t *db, const char *node_name);
 void            db_node_destroy(adb_node_t *node);
+const char*     db_node_get_err(adb_node_t *node);
 void            db_node_name(adb_node_t *node, char name[]);
 int             db_node_size(adb_node_t *node);
 int             db_node_num_of_fields(adb_node_t *node);
@@ -0,0 +1,185 @@
+/*
+ * Copyright (C) Jan 2019 Mellanox Technologies Ltd. All rights reserved.
+ *
+ * This software is available to you under a choice of one of two
+ * licenses.  You may choose to be licensed under the terms of the GNU
+ * General Public License (GPL) Version 2, available from the file
+ * COPYING in the main directory of this source tree, or the
+ * OpenIB.org BSD license below:
+ *
+ *     Redistribution and use in source and binary forms, with or
+ *     without modification, are permitted provided that the following
+ *     conditions are met:
+ *
+ *      - Redistributions of source code must retain the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer.
+ *
+ *      - Redistributions in binary form must reproduce the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer in the documentation and/or other materials
+ *        provided with the distribution.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * Concurrent stress test of the adb_db C API. Not part of the build, from
+ * the top of a built tree:
+ *   g++ -I. -Iadb_parser -Iext_libs/json -Icommon adb_parser/adb_db_test.cpp \
+ *       adb_parser/libadb_parser.a mft_utils/libmftutils.a -lboost_regex -lboost_filesystem \
+ *       -lboost_system -lexpat -lpthread -o adb_db_test
+ *   ./adb_db_test tools_layouts/adb/prm/hca/ext/register_access_table.adb [threads]
+ * For ThreadSanitizer, build the adb_parser sources and mft_thread_pool.cpp
+ * together with it under -fsanitize=thread instead of linking the libraries.
+ * Every thread dumps register nodes from a db shared by all threads or from
+ * a private one, forces per-handle and per-thread errors and evaluates
+ * expressions. The dumps must match a single-threaded reference.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <string>
+#include <map>
+#include "adb_db.h"
+#include "adb_expr.h"
+
+#define MAX_THREADS 64
+#define ITERATIONS  30
+
+static const char *nodeNames[] = {"pddr_reg_ext", "ppcnt_reg_ext", "mcia_ext", "sltp_reg_ext",
+                                  "ptys_reg_ext", "slred_reg_ext", "access_reg_summary_selector_ext"};
+#define NODES_NUM (sizeof(nodeNames) / sizeof(nodeNames[0]))
+
+static std::string refDumps[NODES_NUM];
+static u_int8_t regBuff[8192];
+static adb_db_t *sharedDb;
+static const char *adbPath;
+static int failures = 0;
+static pthread_mutex_t failLock = PTHREAD_MUTEX_INITIALIZER;
+
+static void fail(const char *msg)
+{
+    pthread_mutex_lock(&failLock);
+    failures++;
+    fprintf(stderr, "-E- %s\n", msg);
+    pthread_mutex_unlock(&failLock);
+}
+
+static std::string dumpNode(adb_db_t *db, unsigned int idx)
+{
+    adb_node_t *node = db_get_node(db, nodeNames[idx]);
+    if (!node) {
+        fail(db_get_last_err());
+        return "";
+    }
+    char *data;
+    size_t len;
+    FILE *f = open_memstream(&data, &len);
+    db_node_dump(node, regBuff, DB_FORMAT_FULL_DETAILS, f);
+    fclose(f);
+    std::string dump(data, len);
+    free(data);
+
+    if (db_node_get_field_by_path(node, "no_such_field", 1)) {
+        fail("found a field that does not exist");
+    }
+    if (!strstr(db_node_get_err(node), "no_such_field") || !strstr(db_get_last_err(), "no_such_field")) {
+        fail("node error not reported");
+    }
+    db_node_destroy(node);
+    return dump;
+}
+
+static void* worker(void *arg)
+{
+    long id = (long)arg;
+    adb_db_t *ownDb = NULL;
+    if (id % 2) {
+        ownDb = db_create();
+        if (db_load(ownDb, adbPath, 0)) {
+            fail(db_get_last_err());
+            db_destroy(ownDb);
+            return NULL;
+        }
+    }
+    for (int it = 0; it < ITERATIONS; it++) {
+        unsigned int idx = (id + it) % NODES_NUM;
+        adb_db_t *db = ownDb ? ownDb : sharedDb;
+        if (dumpNode(db, idx) != refDumps[idx]) {
+            fail("dump differs from the reference");
+        }
+
+        char bogus[64];
+        snprintf(bogus, sizeof(bogus), "bogus_node_%ld_%d", id, it);
+        if (db_get_node(db, bogus)) {
+            fail("found a node that does not exist");
+        }
+        if (!strstr(db_get_last_err(), bogus)) {
+            fail("thread error overwritten by another thread");
+        }
+
+        std::map<std::string, std::string> vars;
+        char val[32];
+        snprintf(val, sizeof(val), "%ld", id * 1000 + it);
+        vars["x"] = val;
+        AdbExpr expr;
+        expr.setVars(&vars);
+        char exprStr[] = "(x * 3 + 7) % 1000003 SHIFT_L 2";
+        char *exprPtr = exprStr;
+        u_int64_t res;
+        if (expr.expr(&exprPtr, &res) < 0 || res != ((u_int64_t)((id * 1000 + it) * 3 + 7) % 1000003) << 2) {
+            fail("wrong expression result");
+        }
+    }
+    if (ownDb) {
+        db_destroy(ownDb);
+    }
+    return NULL;
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc < 2) {
+        printf("usage: %s <adb file> [threads]\n", argv[0]);
+        return 1;
+    }
+    adbPath = argv[1];
+    int threadsNum = argc > 2 ? atoi(argv[2]) : 16;
+    if (threadsNum < 1 || threadsNum > MAX_THREADS) {
+        threadsNum = 16;
+    }
+    srand(3);
+    for (size_t i = 0; i < sizeof(regBuff); i++) {
+        regBuff[i] = (u_int8_t)rand();
+    }
+
+    sharedDb = db_create();
+    if (db_load(sharedDb, adbPath, 0)) {
+        printf("-E- %s\n", db_get_last_err());
+        return 1;
+    }
+    for (unsigned int i = 0; i < NODES_NUM; i++) {
+        refDumps[i] = dumpNode(sharedDb, i);
+    }
+
+    pthread_t threads[MAX_THREADS];
+    for (long i = 0; i < threadsNum; i++) {
+        pthread_create(&threads[i], NULL, worker, (void*)i);
+    }
+    for (int i = 0; i < threadsNum; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    db_destroy(sharedDb);
+    printf("%d threads, %d failures\n", threadsNum, failures);
+    return failures != 0;
+}
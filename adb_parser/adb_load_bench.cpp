@@ -0,0 +1,123 @@
+/*
+ * Copyright (C) Jan 2019 Mellanox Technologies Ltd. All rights reserved.
+ *
+ * This software is available to you under a choice of one of two
+ * licenses.  You may choose to be licensed under the terms of the GNU
+ * General Public License (GPL) Version 2, available from the file
+ * COPYING in the main directory of this source tree, or the
+ * OpenIB.org BSD license below:
+ *
+ *     Redistribution and use in source and binary forms, with or
+ *     without modification, are permitted provided that the following
+ *     conditions are met:
+ *
+ *      - Redistributions of source code must retain the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer.
+ *
+ *      - Redistributions in binary form must reproduce the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer in the documentation and/or other materials
+ *        provided with the distribution.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * ADB load benchmark: parses each ADB file and builds its layout with
+ * expression evaluation on, the path that runs Adb::evalExpr for every
+ * instance. Reports the best of several runs. The compiled ADB cache is
+ * disabled so the XML is parsed every time. Not part of the build, from
+ * the top of a built tree:
+ *   g++ -O2 -I. -Icommon adb_parser/adb_load_bench.cpp adb_parser/libadb_parser.a \
+ *       mft_utils/libmftutils.a -lboost_regex -lboost_filesystem -lboost_system \
+ *       -lexpat -lpthread -o adb_load_bench
+ *   ./adb_load_bench [-n runs] [-r root node] tools_layouts/adb/prm/hca/ext/register_access_table.adb \
+ *       tools_layouts/adb/prm/switch/ext/register_access_table.adb
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include <string>
+#include <vector>
+#include "adb_parser.h"
+
+static double now()
+{
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec + tv.tv_usec / 1e6;
+}
+
+static size_t countInstances(AdbInstance *inst)
+{
+    size_t count = 1;
+    for (size_t i = 0; i < inst->subItems.size(); i++) {
+        count += countInstances(inst->subItems[i]);
+    }
+    return count;
+}
+
+int main(int argc, char *argv[])
+{
+    int runs = 5;
+    std::string root = "access_reg_summary_selector_ext";
+    std::vector<std::string> files;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-n") && i + 1 < argc) {
+            runs = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "-r") && i + 1 < argc) {
+            root = argv[++i];
+        } else {
+            files.push_back(argv[i]);
+        }
+    }
+    if (files.empty() || runs < 1) {
+        printf("usage: %s [-n runs] [-r root node] <adb file>...\n", argv[0]);
+        return 1;
+    }
+    setenv("ADB_DISABLE_CACHE", "1", 1);
+
+    for (size_t f = 0; f < files.size(); f++) {
+        double bestLoad = 0;
+        double bestLayout = 0;
+        size_t nodes = 0;
+        size_t instances = 0;
+        for (int run = 0; run < runs; run++) {
+            Adb adb;
+            double start = now();
+            if (!adb.load(files[f], false, NULL, false)) {
+                printf("-E- %s: %s\n", files[f].c_str(), adb.getLastError().c_str());
+                return 1;
+            }
+            double loaded = now();
+            AdbInstance *layout = adb.createLayout(root, true, NULL);
+            double done = now();
+            if (!layout) {
+                printf("-E- %s: %s\n", files[f].c_str(), adb.getLastError().c_str());
+                return 1;
+            }
+            if (!run || loaded - start < bestLoad) {
+                bestLoad = loaded - start;
+            }
+            if (!run || done - loaded < bestLayout) {
+                bestLayout = done - loaded;
+            }
+            nodes = adb.nodesMap.size();
+            instances = countInstances(layout);
+            delete layout;
+        }
+        printf("%s: %zu nodes, %zu instances, load %.1f ms, layout %.1f ms (best of %d)\n",
+               files[f].c_str(), nodes, instances, bestLoad * 1000, bestLayout * 1000, runs);
+    }
+    return 0;
+}
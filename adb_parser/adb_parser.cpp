@@ -37,6 +37,7 @@
 #include <string.h>
 #include <errno.h>
 #include <list>
+#include <set>
 #include <iostream>
 #include <boost/lexical_cast.hpp>
 #include <boost/algorithm/string.hpp>
@@ -44,7 +45,9 @@
 #include <boost/filesystem/operations.hpp>
 #include <expat.h>
 #include <stdexcept>
+#include <mft_utils/mft_thread_pool.h>
 #include "adb_parser.h"
+#include "adb_cache.h"
 #include "buf_ops.h"
 
 #if __cplusplus >= 201402L
@@ -172,6 +175,7 @@ public:
     static void insertNewException(const string exceptionType, string exceptionTxt);
     static ExceptionsMap getAdbExceptionsMap();
     static int getNumberOfExceptions();
+    static void restore(const ExceptionsMap& savedMap, int savedCounter);
 public:
     // VARIABLES
     static ExceptionsMap adbExceptionMap;
@@ -179,12 +183,14 @@ public:
     static const string ERROR_EXCEPTION;
     static const string WARN_EXCEPTION;
     static int exceptionCounter;
+    static mft_utils::MftMutex lock; // included files may be parsed concurrently
 };
 ExceptionsMap ExceptionHolder::adbExceptionMap;
 const string ExceptionHolder::FATAL_EXCEPTION = "FATAL";
 const string ExceptionHolder::ERROR_EXCEPTION = "ERROR"; 
 const string ExceptionHolder::WARN_EXCEPTION = "WARNING"; 
 int ExceptionHolder::exceptionCounter = 0;
+mft_utils::MftMutex ExceptionHolder::lock;
 
 /**
  * Function: ExceptionHolder::getNumberOfExceptions
@@ -192,6 +198,7 @@ int ExceptionHolder::exceptionCounter = 0;
  **/
 
 int ExceptionHolder::getNumberOfExceptions() {
+    mft_utils::MftLockGuard guard(lock);
     return ExceptionHolder::exceptionCounter;
 }
 
@@ -201,6 +208,7 @@ int ExceptionHolder::getNumberOfExceptions() {
  **/
 
 ExceptionsMap ExceptionHolder::getAdbExceptionsMap() {
+    mft_utils::MftLockGuard guard(lock);
     return ExceptionHolder::adbExceptionMap;
 }
 
@@ -210,10 +218,21 @@ ExceptionsMap ExceptionHolder::getAdbExceptionsMap() {
  * Then it insert it to the adb exception map
  **/
 void ExceptionHolder::insertNewException(const string exceptionType, string exceptionTxt) {
+    mft_utils::MftLockGuard guard(lock);
     ExceptionHolder::adbExceptionMap[exceptionType].push_back(exceptionTxt);
     ExceptionHolder::exceptionCounter += 1;
 }
 
+/**
+ * Function: ExceptionHolder::restore
+ * This function drops the exceptions that were added since the map and counter were saved
+ **/
+void ExceptionHolder::restore(const ExceptionsMap& savedMap, int savedCounter) {
+    mft_utils::MftLockGuard guard(lock);
+    ExceptionHolder::adbExceptionMap = savedMap;
+    ExceptionHolder::exceptionCounter = savedCounter;
+}
+
 LogFile::LogFile() : _logFile(NULL) {
 }
 
@@ -247,6 +266,15 @@ void LogFile::appendLogFile(string str) {
 }
 
 /*************************** AdbParser ***************************/
+// An include that was resolved but left for AdbIncludeLoader to parse
+typedef struct {
+    string filePath;
+    string baseName;
+    string includedFrom;
+    int includedFromLine;
+} PendingInclude;
+typedef vector<PendingInclude> PendingIncludeList;
+
 class AdbParser {
 public:
     // METHODS
@@ -271,8 +299,10 @@ public:
     static bool allowMultipleExceptions;
 
 private:
+    friend class AdbIncludeLoader;
     // METHODS
     string findFile(string fileName);
+    void noteSharedStateChange();
     static void addIncludePaths(Adb *adbCtxt, string includePaths);
     static void includeFile(AdbParser *adbParser, string fileName, int lineNumber = -1);
     static void startElement(void *adbParser, const XML_Char *name, const XML_Char **atts);
@@ -315,6 +345,10 @@ private:
     AdbConfig *_currentConfig;
     bool _instanceOps;
     bool _enforceExtraChecks;
+    bool _deferIncludes; // record includes in _pendingIncludes instead of parsing them
+    PendingIncludeList _pendingIncludes;
+    bool _touchesSharedState; // has config/info elements or adds include paths
+    bool _ctxtChangedAfterInclude; // ... and some of them come after an include
 
     static const string TAG_NODES_DEFINITION;
     static const string TAG_RCS_HEADERS;
@@ -569,13 +603,54 @@ string AdbConfig::toXml() {
     return xml;
 }
 
+/*************************** AdbInstanceArena ***************************/
+/*
+ * Storage for the instances of one layout. Instances are placed in fixed
+ * size chunks and are all destroyed together with the layout root, so
+ * building a layout doesn't allocate every instance separately and
+ * teardown doesn't recurse the tree.
+ */
+class AdbInstanceArena {
+public:
+    AdbInstanceArena() : _used(CHUNK_SIZE) {}
+    ~AdbInstanceArena();
+    AdbInstance* alloc();
+
+private:
+    enum { CHUNK_SIZE = 512 };
+    vector<AdbInstance*> _chunks;
+    size_t _used; // instances constructed in the last chunk
+};
+
+AdbInstance* AdbInstanceArena::alloc() {
+    if (_used == CHUNK_SIZE) {
+        _chunks.push_back((AdbInstance*)::operator new(CHUNK_SIZE * sizeof(AdbInstance)));
+        _used = 0;
+    }
+    AdbInstance *inst = new (_chunks.back() + _used) AdbInstance();
+    _used++;
+    inst->isArenaItem = true;
+    return inst;
+}
+
+AdbInstanceArena::~AdbInstanceArena() {
+    for (size_t i = 0; i < _chunks.size(); i++) {
+        size_t count = (i + 1 == _chunks.size()) ? _used : (size_t)CHUNK_SIZE;
+        for (size_t j = 0; j < count; j++) {
+            _chunks[i][j].~AdbInstance();
+        }
+        ::operator delete(_chunks[i]);
+    }
+}
+
 /*************************** AdbInstance ***************************/
 /**
  * Function: AdbInstance::AdbInstance
  **/
 AdbInstance::AdbInstance() :
     fieldDesc(NULL), nodeDesc(NULL), parent(NULL), offset(0xffffffff), size(0),
-            arrIdx(0), isNameBeenExtended(false), unionSelector(NULL), isDiff(false), userData(NULL)
+            arrIdx(0), isNameBeenExtended(false), unionSelector(NULL), isDiff(false), userData(NULL),
+            lazyAdb(NULL), lazyExprEval(false), arena(NULL), isArenaItem(false)
 
 {
 
@@ -585,8 +660,12 @@ AdbInstance::AdbInstance() :
  * Function: AdbInstance::AdbInstance
  **/
 AdbInstance::~AdbInstance() {
-    for (size_t i = 0; i < subItems.size(); i++)
-        delete subItems[i];
+    if (arena) {
+        delete arena;
+    } else if (!isArenaItem) {
+        for (size_t i = 0; i < subItems.size(); i++)
+            delete subItems[i];
+    }
 }
 
 /**
@@ -692,6 +771,7 @@ AdbInstance* AdbInstance::getChildByPath(const string &path,
     string grandChildPath = idx == string::npos ? string() : effPath.substr(
             idx + 1);
 
+    expand();
     if (path.empty()) {
         return this;
     }
@@ -712,6 +792,9 @@ AdbInstance* AdbInstance::getChildByPath(const string &path,
     }
 
     // if grandChildPath isn't empty this means we need to continue and find the desired field in grand child node
+    if (grandChildPath.empty()) {
+        child->expand();
+    }
     return grandChildPath.empty() ? child : child->getChildByPath(
             grandChildPath, isCaseSensitive);
 }
@@ -736,6 +819,7 @@ vector<AdbInstance*> AdbInstance::findChild(const string& childName,
     }
 
     // do that recursively for all child items
+    expand();
     for (size_t i = 0; i < subItems.size(); i++) {
         vector<AdbInstance*> l = subItems[i]->findChild(effName, true);
         childList.insert(childList.end(), l.begin(), l.end());
@@ -1002,6 +1086,7 @@ AdbInstance* AdbInstance::getUnionSelectedNodeName(const u_int64_t& selectorVal)
             // search for the sub instance with the "selected_by" attribute == selectorEnum
             for (size_t i = 0; i < subItems.size(); i++) {
                 if (subItems[i]->getInstanceAttr("selected_by") == selectorEnum) {
+                    subItems[i]->expand();
                     return subItems[i];
                 }
 
@@ -1034,6 +1119,7 @@ AdbInstance* AdbInstance::getUnionSelectedNodeName(const string& selectorEnum) {
 
     for (size_t i = 0; i < subItems.size(); i++) {
         if (subItems[i]->getInstanceAttr("selected_by") == selectorEnum) {
+            subItems[i]->expand();
             return subItems[i];
         }
     }
@@ -1100,6 +1186,7 @@ bool AdbInstance::isConditionValid(map<string, string> *valuesMap) {
 vector<AdbInstance*> AdbInstance::getLeafFields(bool extendenName) {
     vector<AdbInstance*> fields;
 
+    expand();
     for (size_t i = 0; i < subItems.size(); i++) {
         if (subItems[i]->isNode()) {
             vector<AdbInstance*> subFields = subItems[i]->getLeafFields(extendenName);
@@ -1116,6 +1203,15 @@ vector<AdbInstance*> AdbInstance::getLeafFields(bool extendenName) {
     return fields;
 }
 
+/**
+ * Function: AdbInstance::expand
+ **/
+void AdbInstance::expand() {
+    if (lazyAdb) {
+        lazyAdb->expandInstance(this);
+    }
+}
+
 /**
  * Function: AdbInstance::pushBuf
  **/
@@ -1135,6 +1231,7 @@ u_int64_t AdbInstance::popBuf(u_int8_t *buf) {
  **/
 void AdbInstance::print(int indent) {
     string indentStr = indentString(indent);
+    expand();
     printf(
             "%sfullName: %s, offset: 0x%x.%d, size: 0x%x.%d, isNode:%d, isUnion:%d\n",
             indentStr.c_str(), fullName().c_str(), (offset >> 5) << 2,
@@ -1151,7 +1248,7 @@ void AdbInstance::print(int indent) {
  * Function: Adb::Adb
  **/
 Adb::Adb() :
-    bigEndianArr(false), singleEntryArrSupp(false){
+    bigEndianArr(false), singleEntryArrSupp(false), _arena(NULL){
 }
 
 /**
@@ -1231,6 +1328,295 @@ string Adb::printAdbExceptionMap() {
     return errorStr;
 }
 
+/*************************** AdbIncludeLoader ***************************/
+#define ADB_LOAD_THREADS_ENV "ADB_LOAD_THREADS"
+
+/**
+ * Function: adbLoadThreads
+ * Number of threads used for loading a project, 1 means load it sequentially
+ **/
+static u_int32_t adbLoadThreads() {
+    const char *env = getenv(ADB_LOAD_THREADS_ENV);
+    if (env) {
+        int numOfThreads = atoi(env);
+        return numOfThreads > 1 ? numOfThreads : 1;
+    }
+    return mft_utils::MftThreadPool::getDefaultNumOfThreads();
+}
+
+/*
+ * Parses the files included by a project on a thread pool, each one into a
+ * private Adb, and merges them in the order the sequential parser reads them.
+ * The parallel load is only kept when it gives exactly what the sequential one
+ * would: on any error, exception, duplicated node or included file that changes
+ * the parser state (config, info, include paths) load() returns false and the
+ * project has to be loaded sequentially, which also reports the errors.
+ */
+class AdbIncludeLoader {
+public:
+    AdbIncludeLoader(Adb *adbCtxt, const string& fileName, bool addReserved,
+            AdbProgress *progressObj, bool strict, const string& includePath,
+            bool enforceExtraChecks, u_int32_t numOfThreads);
+    ~AdbIncludeLoader();
+    bool load();
+
+private:
+    typedef struct {
+        string filePath;
+        Adb *adb;
+        PendingIncludeList includes;
+        bool status;
+        bool touchesSharedState;
+    } FileResult;
+    typedef map<string, FileResult*> FileResultMap;
+    typedef vector<const PendingInclude*> IncludeOrder;
+
+    bool parseAll();
+    void walk(const PendingIncludeList& includes, IncludeFileMap& includedFiles,
+            IncludeOrder& order, StringVector& missing);
+    void parseFiles(const StringVector& paths);
+    static void parseFileJob(void *ctx, u_int32_t jobIdx);
+    bool merge(const IncludeOrder& order);
+    void adopt();
+
+    Adb *_adbCtxt;
+    Adb _mainAdb;
+    string _fileName;
+    bool _addReserved;
+    AdbProgress *_progressObj;
+    bool _strict;
+    string _includePath;
+    bool _enforceExtraChecks;
+    u_int32_t _numOfThreads;
+    PendingIncludeList _mainIncludes;
+    FileResultMap _results;
+    vector<FileResult*> _jobs;
+    IncludeFileMap _includedFiles;
+    IncludeOrder _order;
+};
+
+/**
+ * Function: AdbIncludeLoader::AdbIncludeLoader
+ **/
+AdbIncludeLoader::AdbIncludeLoader(Adb *adbCtxt, const string& fileName,
+        bool addReserved, AdbProgress *progressObj, bool strict,
+        const string& includePath, bool enforceExtraChecks,
+        u_int32_t numOfThreads) :
+    _adbCtxt(adbCtxt), _fileName(fileName), _addReserved(addReserved),
+            _progressObj(progressObj), _strict(strict),
+            _includePath(includePath), _enforceExtraChecks(enforceExtraChecks),
+            _numOfThreads(numOfThreads) {
+    _mainAdb.mainFileName = adbCtxt->mainFileName;
+}
+
+/**
+ * Function: AdbIncludeLoader::~AdbIncludeLoader
+ **/
+AdbIncludeLoader::~AdbIncludeLoader() {
+    for (FileResultMap::iterator it = _results.begin(); it != _results.end(); it++) {
+        // the configs belong to _mainAdb
+        it->second->adb->configs.clear();
+        delete it->second->adb;
+        delete it->second;
+    }
+}
+
+/**
+ * Function: AdbIncludeLoader::load
+ * Returns true if the project was loaded into adbCtxt, false if it has to be loaded sequentially
+ **/
+bool AdbIncludeLoader::load() {
+    ExceptionsMap savedMap = ExceptionHolder::getAdbExceptionsMap();
+    int savedCounter = ExceptionHolder::getNumberOfExceptions();
+
+    bool status = parseAll();
+    if (ExceptionHolder::getNumberOfExceptions() != savedCounter) {
+        // the sequential load reports them again, in their order
+        ExceptionHolder::restore(savedMap, savedCounter);
+        status = false;
+    }
+    if (status) {
+        adopt();
+    }
+    return status;
+}
+
+/**
+ * Function: AdbIncludeLoader::parseAll
+ **/
+bool AdbIncludeLoader::parseAll() {
+    try {
+        AdbParser p(_fileName, &_mainAdb, _addReserved, _progressObj, _strict,
+                _includePath, _enforceExtraChecks);
+        p._deferIncludes = true;
+        if (!p.load() || p._ctxtChangedAfterInclude) {
+            return false;
+        }
+        _mainIncludes = p._pendingIncludes;
+
+        // each round parses the files the include tree is known to reach so far
+        while (true) {
+            StringVector missing;
+            _includedFiles = _mainAdb.includedFiles;
+            _order.clear();
+            walk(_mainIncludes, _includedFiles, _order, missing);
+            if (missing.empty()) {
+                break;
+            }
+            parseFiles(missing);
+        }
+        return merge(_order);
+    } catch (AdbException&) {
+        return false;
+    }
+}
+
+/**
+ * Function: AdbIncludeLoader::walk
+ * Visits the includes in the order AdbParser::includeFile would parse them
+ **/
+void AdbIncludeLoader::walk(const PendingIncludeList& includes,
+        IncludeFileMap& includedFiles, IncludeOrder& order, StringVector& missing) {
+    for (PendingIncludeList::const_iterator it = includes.begin(); it != includes.end(); it++) {
+        if (includedFiles.count(it->baseName)) {
+            continue;
+        }
+        IncludeFileInfo info = { it->filePath, it->includedFrom, it->includedFromLine };
+        includedFiles[it->baseName] = info;
+        order.push_back(&(*it));
+
+        FileResultMap::iterator res = _results.find(it->filePath);
+        if (res == _results.end()) {
+            missing.push_back(it->filePath);
+            continue;
+        }
+        walk(res->second->includes, includedFiles, order, missing);
+    }
+}
+
+/**
+ * Function: AdbIncludeLoader::parseFiles
+ **/
+void AdbIncludeLoader::parseFiles(const StringVector& paths) {
+    _jobs.clear();
+    for (StringVector::const_iterator it = paths.begin(); it != paths.end(); it++) {
+        if (_results.count(*it)) {
+            continue;
+        }
+        FileResult *res = new FileResult;
+        res->filePath = *it;
+        res->adb = new Adb;
+        res->status = false;
+        res->touchesSharedState = false;
+
+        // the state the sequential parser has when it reaches the include
+        res->adb->version = _mainAdb.version;
+        res->adb->configs = _mainAdb.configs;
+        res->adb->bigEndianArr = _mainAdb.bigEndianArr;
+        res->adb->singleEntryArrSupp = _mainAdb.singleEntryArrSupp;
+        res->adb->includePaths = _mainAdb.includePaths;
+        res->adb->mainFileName = _mainAdb.mainFileName;
+
+        _results[*it] = res;
+        _jobs.push_back(res);
+    }
+
+    mft_utils::MftThreadPool pool(_numOfThreads);
+    pool.run(_jobs.size(), parseFileJob, this);
+}
+
+/**
+ * Function: AdbIncludeLoader::parseFileJob
+ **/
+void AdbIncludeLoader::parseFileJob(void *ctx, u_int32_t jobIdx) {
+    AdbIncludeLoader *self = (AdbIncludeLoader*) ctx;
+    FileResult *res = self->_jobs[jobIdx];
+    try {
+        AdbParser p(res->filePath, res->adb, self->_addReserved, NULL,
+                self->_strict, "", self->_enforceExtraChecks);
+        p._deferIncludes = true;
+        res->status = p.load();
+        res->includes = p._pendingIncludes;
+        res->touchesSharedState = p._touchesSharedState;
+    } catch (...) {
+        res->status = false;
+    }
+}
+
+/**
+ * Function: AdbIncludeLoader::merge
+ **/
+bool AdbIncludeLoader::merge(const IncludeOrder& order) {
+    // the sequential parser fails or reports on any clash, let it do so
+    set<string> nodeNames, instPaths;
+    for (IncludeOrder::const_iterator it = order.begin(); it != order.end(); it++) {
+        FileResult *res = _results[(*it)->filePath];
+        if (!res->status || res->touchesSharedState) {
+            return false;
+        }
+        for (NodesMap::iterator nodeIt = res->adb->nodesMap.begin();
+                nodeIt != res->adb->nodesMap.end(); nodeIt++) {
+            if (_mainAdb.nodesMap.count(nodeIt->first)
+                    || !nodeNames.insert(nodeIt->first).second) {
+                return false;
+            }
+        }
+        for (InstanceAttrs::iterator attrIt = res->adb->instAttrs.begin();
+                attrIt != res->adb->instAttrs.end(); attrIt++) {
+            if (_mainAdb.instAttrs.count(attrIt->first)
+                    || !instPaths.insert(attrIt->first).second) {
+                return false;
+            }
+        }
+        if (res->adb->version != _mainAdb.version) {
+            return false;
+        }
+    }
+
+    for (IncludeOrder::const_iterator it = order.begin(); it != order.end(); it++) {
+        FileResult *res = _results[(*it)->filePath];
+        _mainAdb.nodesMap.insert(res->adb->nodesMap.begin(), res->adb->nodesMap.end());
+        res->adb->nodesMap.clear();
+        _mainAdb.instAttrs.insert(res->adb->instAttrs.begin(), res->adb->instAttrs.end());
+        if (!res->adb->rootNode.empty()) {
+            _mainAdb.rootNode = res->adb->rootNode;
+        }
+        if (_progressObj) {
+            _progressObj->progress();
+        }
+    }
+    _mainAdb.includedFiles = _includedFiles;
+    return true;
+}
+
+/**
+ * Function: AdbIncludeLoader::adopt
+ * Moves the merged project into adbCtxt
+ **/
+void AdbIncludeLoader::adopt() {
+    _adbCtxt->_logFile.appendLogFile("Opening " + _fileName + "\n");
+    for (IncludeOrder::const_iterator it = _order.begin(); it != _order.end(); it++) {
+        _adbCtxt->_logFile.appendLogFile("Opening " + (*it)->filePath + "\n");
+    }
+
+    _adbCtxt->version.swap(_mainAdb.version);
+    _adbCtxt->nodesMap.swap(_mainAdb.nodesMap);
+    _adbCtxt->configs.swap(_mainAdb.configs);
+    _adbCtxt->rootNode.swap(_mainAdb.rootNode);
+    _adbCtxt->bigEndianArr = _mainAdb.bigEndianArr;
+    _adbCtxt->singleEntryArrSupp = _mainAdb.singleEntryArrSupp;
+    _adbCtxt->instAttrs.swap(_mainAdb.instAttrs);
+    _adbCtxt->srcDocName.swap(_mainAdb.srcDocName);
+    _adbCtxt->srcDocVer.swap(_mainAdb.srcDocVer);
+    _adbCtxt->includePaths.swap(_mainAdb.includePaths);
+    _adbCtxt->includedFiles.swap(_mainAdb.includedFiles);
+
+    // the results share the configs that now belong to adbCtxt
+    for (FileResultMap::iterator it = _results.begin(); it != _results.end(); it++) {
+        it->second->adb->configs.clear();
+    }
+}
+
 /**
  * Function: Adb::load
  **/
@@ -1245,14 +1631,33 @@ bool Adb::load(string fname, bool addReserved, AdbProgress *progressObj,
         }
         _logFile.init(logFileStr, allowMultipleExceptions);
 
-        AdbParser p(fname, this, addReserved, progressObj, strict, includePath,
-                enforceExtraChecks);
-        if (!p.load()) {
-            _lastError = p.getError();
-            status = false;
+        // the compiled cache only stands for a plain load of a single file
+        u_int32_t cacheOptions = (addReserved ? 0x1 : 0) | (strict ? 0x2 : 0) | (enforceExtraChecks ? 0x4 : 0);
+        bool useCache = AdbCache::isEnabled() && includePath == "" && includeDir == "" &&
+                        !allowMultipleExceptions && progressObj == NULL;
+        if (useCache && AdbCache::load(this, fname, cacheOptions)) {
+            return true;
+        }
+
+        // included files are parsed in parallel when it makes no difference
+        u_int32_t numOfThreads = adbLoadThreads();
+        bool parallelLoaded = false;
+        if (numOfThreads > 1 && includeDir == "" && nodesMap.empty()
+                && configs.empty() && includePaths.empty()) {
+            AdbIncludeLoader loader(this, fname, addReserved, progressObj,
+                    strict, includePath, enforceExtraChecks, numOfThreads);
+            parallelLoaded = loader.load();
         }
-        if (status && includeDir != "") {
-            AdbParser::includeAllFilesInDir(&p, includeDir);
+        if (!parallelLoaded) {
+            AdbParser p(fname, this, addReserved, progressObj, strict, includePath,
+                    enforceExtraChecks);
+            if (!p.load()) {
+                _lastError = p.getError();
+                status = false;
+            }
+            if (status && includeDir != "") {
+                AdbParser::includeAllFilesInDir(&p, includeDir);
+            }
         }
         if (status && !nodesMap.size()) {
             _lastError = "Empty project, no nodes were found";
@@ -1271,6 +1676,9 @@ bool Adb::load(string fname, bool addReserved, AdbProgress *progressObj,
             fetchAdbExceptionsMap(ExceptionHolder::getAdbExceptionsMap());
             status = false;
         }
+        if (status && useCache && includedFiles.size() <= 1) {
+            AdbCache::store(this, fname, cacheOptions);
+        }
         return status;
     } catch (AdbException &e) {
         _lastError = e.what_s();
@@ -1462,7 +1870,7 @@ void Adb::cleanInstAttrs()
  **/
 AdbInstance* Adb::createLayout(string rootNodeName, bool isExprEval,
         AdbProgress *progressObj, int depth, bool ignoreMissingNodes,
-        bool allowMultipleExceptions) {
+        bool allowMultipleExceptions, bool lazyUnions) {
     try {
         //find root in nodes map
         NodesMap::iterator it;
@@ -1475,6 +1883,8 @@ AdbInstance* Adb::createLayout(string rootNodeName, bool isExprEval,
 
         AdbNode *nodeDesc = it->second;
         AdbInstance *rootItem = new AdbInstance();
+        rootItem->arena = new AdbInstanceArena();
+        _arena = rootItem->arena;
         rootItem->fieldDesc = NULL;
         rootItem->nodeDesc = nodeDesc;
         rootItem->parent = NULL;
@@ -1494,7 +1904,7 @@ AdbInstance* Adb::createLayout(string rootNodeName, bool isExprEval,
             vector<AdbInstance*> subItems = createInstance(nodeDesc->fields[i],
                     rootItem, emptyVars, isExprEval, progressObj,
                     depth == -1 ? -1 : depth - 1, ignoreMissingNodes,
-                    allowMultipleExceptions);
+                    allowMultipleExceptions, lazyUnions);
             rootItem->subItems.insert(rootItem->subItems.end(),
                     subItems.begin(), subItems.end());
         }
@@ -1523,93 +1933,159 @@ AdbInstance* Adb::createLayout(string rootNodeName, bool isExprEval,
         }
 
         /* Evaluate unions selector fields*/
-        for (list<AdbInstance*>::iterator it = _unionSelectorEvalDeffered.begin(); 
-             it != _unionSelectorEvalDeffered.end(); it++) {
-            vector < string > path;
-            AdbInstance *inst = *it;
-            AdbInstance *curInst = inst;
-            const string splitVal = inst->getInstanceAttr("union_selector");
-            boost::algorithm::split(path, splitVal, boost::is_any_of(string(".")));
-            for (size_t i = 0; i < path.size(); i++) {
-                if (path[i] == "#(parent)" || path[i] == "$(parent)") {
-                    curInst = curInst->parent;
-                } else {
-                    size_t j;
-                    bool inPath = false;
-                    for (j = 0; j < curInst->subItems.size(); j++) {
-                        if (curInst->subItems[j]->name == path[i]) {
-                            curInst = curInst->subItems[j];
-                            inPath = true;
-                            break;
-                        }
-                    }
-
-                    if (j == curInst->subItems.size() && !inPath) {
-                        if (rootNodeName == rootNode) { // give this warning only if this root instantiation
-                            raiseException(allowMultipleExceptions, 
-                                          "Failed to find union selector for union (" + inst->fullName() + ") Can't find field (" + path[i] + ") under (" + curInst->fullName() + ")",
-                                          ExceptionHolder::ERROR_EXCEPTION);
-                        }
-                    }
-                }
-            }
+        evalUnionSelectors(rootNodeName == rootNode, allowMultipleExceptions);
 
-            inst->unionSelector = curInst;
-            for (size_t i = 0; i < inst->subItems.size(); i++) {
-                //printf("Field %s, isResered=%d\n", inst->subItems[i]->fullName().c_str(), inst->subItems[i]->isReserved());
-                if (inst->subItems[i]->isReserved()) {
-                    continue;
-                }
+        _arena = NULL;
+        return rootItem;
+    } catch (AdbException &exp) {
+        _arena = NULL;
+        _lastError = exp.what_s();
+        if (allowMultipleExceptions) {
+            insertNewException(ExceptionHolder::FATAL_EXCEPTION, _lastError);
+        }
+        return NULL;
+    } catch (...) {
+        _arena = NULL;
+        _lastError = "Unknown error occurred";
+        return NULL;
+    }
+}
 
-                // make sure all union subnodes define "selected_by" attribute
-                bool found = false;
-                AttrsMap::iterator selectorValIt = inst->subItems[i]->getInstanceAttrIterator("selected_by", found);
-                if (!found) {
-                    raiseException(allowMultipleExceptions, 
-                                  "In union (" + inst->fullName() + ") the union subnode (" + inst->subItems[i]->name + ") doesn't define selection value",
-                                  ExceptionHolder::ERROR_EXCEPTION);
-                }
+/**
+ * Function: Adb::newInstance
+ **/
+AdbInstance* Adb::newInstance() {
+    return _arena ? _arena->alloc() : new AdbInstance;
+}
 
-                // make sure that all union subnodes selector values are defined in the selector field enum
-                if (selectorValIt->second == "") {
-                    continue;
-                }
+/**
+ * Function: Adb::releaseInstance
+ * Arena instances stay allocated until their layout is deleted
+ **/
+void Adb::releaseInstance(AdbInstance *inst) {
+    if (!inst->isArenaItem) {
+        delete inst;
+    }
+}
 
-                map<string, u_int64_t>::iterator it;
-                map < string, u_int64_t > selectorValMap
-                        = inst->unionSelector->getEnumMap();
-                for (it = selectorValMap.begin(); it != selectorValMap.end(); it++) {
-                    if (it->first == selectorValIt->second) {
+/**
+ * Function: Adb::evalUnionSelectors
+ **/
+void Adb::evalUnionSelectors(bool isRootLayout, bool allowMultipleExceptions) {
+    for (list<AdbInstance*>::iterator it = _unionSelectorEvalDeffered.begin(); 
+         it != _unionSelectorEvalDeffered.end(); it++) {
+        vector < string > path;
+        AdbInstance *inst = *it;
+        AdbInstance *curInst = inst;
+        const string splitVal = inst->getInstanceAttr("union_selector");
+        boost::algorithm::split(path, splitVal, boost::is_any_of(string(".")));
+        for (size_t i = 0; i < path.size(); i++) {
+            if (path[i] == "#(parent)" || path[i] == "$(parent)") {
+                curInst = curInst->parent;
+            } else {
+                size_t j;
+                bool inPath = false;
+                curInst->expand(); // the selector may live in a lazy union member
+                for (j = 0; j < curInst->subItems.size(); j++) {
+                    if (curInst->subItems[j]->name == path[i]) {
+                        curInst = curInst->subItems[j];
+                        inPath = true;
                         break;
                     }
                 }
 
-                //if not found in map throw exeption
-                if (it == selectorValMap.end()) {
-                    string exceptionTxt = "In union (" + inst->fullName()
-                            + ") the union subnode (" + inst->subItems[i]->name
-                            + ") uses a selector value ("
-                            + selectorValIt->second
-                            + ") which isn't defined in the selector field ("
-                            + inst->unionSelector->fullName() + ")";
-                    raiseException(allowMultipleExceptions, 
-                                  exceptionTxt,
-                                  ExceptionHolder::ERROR_EXCEPTION);
+                if (j == curInst->subItems.size() && !inPath) {
+                    if (isRootLayout) { // give this warning only if this root instantiation
+                        raiseException(allowMultipleExceptions, 
+                                      "Failed to find union selector for union (" + inst->fullName() + ") Can't find field (" + path[i] + ") under (" + curInst->fullName() + ")",
+                                      ExceptionHolder::ERROR_EXCEPTION);
+                    }
                 }
             }
         }
 
-        return rootItem;
+        inst->unionSelector = curInst;
+        map < string, u_int64_t > selectorValMap;
+        bool selectorValMapBuilt = false;
+        for (size_t i = 0; i < inst->subItems.size(); i++) {
+            //printf("Field %s, isResered=%d\n", inst->subItems[i]->fullName().c_str(), inst->subItems[i]->isReserved());
+            if (inst->subItems[i]->isReserved()) {
+                continue;
+            }
+
+            // make sure all union subnodes define "selected_by" attribute
+            bool found = false;
+            AttrsMap::iterator selectorValIt = inst->subItems[i]->getInstanceAttrIterator("selected_by", found);
+            if (!found) {
+                raiseException(allowMultipleExceptions, 
+                              "In union (" + inst->fullName() + ") the union subnode (" + inst->subItems[i]->name + ") doesn't define selection value",
+                              ExceptionHolder::ERROR_EXCEPTION);
+            }
+
+            // make sure that all union subnodes selector values are defined in the selector field enum
+            if (selectorValIt->second == "") {
+                continue;
+            }
+
+            // the selector enum is parsed once per union, not per subnode
+            if (!selectorValMapBuilt) {
+                selectorValMap = inst->unionSelector->getEnumMap();
+                selectorValMapBuilt = true;
+            }
+            map<string, u_int64_t>::iterator it = selectorValMap.find(selectorValIt->second);
+
+            //if not found in map throw exeption
+            if (it == selectorValMap.end()) {
+                string exceptionTxt = "In union (" + inst->fullName()
+                        + ") the union subnode (" + inst->subItems[i]->name
+                        + ") uses a selector value ("
+                        + selectorValIt->second
+                        + ") which isn't defined in the selector field ("
+                        + inst->unionSelector->fullName() + ")";
+                raiseException(allowMultipleExceptions, 
+                              exceptionTxt,
+                              ExceptionHolder::ERROR_EXCEPTION);
+            }
+        }
+    }
+}
+
+/**
+ * Function: Adb::expandInstance
+ * Creates the subtree of a union member that createLayout left as a stub
+ **/
+void Adb::expandInstance(AdbInstance *inst) {
+    if (!inst->lazyAdb) {
+        return;
+    }
+    inst->lazyAdb = NULL;
+
+    AdbInstance *root = inst;
+    while (root->parent) {
+        root = root->parent;
+    }
+
+    // Expansion may happen while createLayout still holds deferred unions
+    list<AdbInstance*> pendingUnions;
+    pendingUnions.swap(_unionSelectorEvalDeffered);
+    AdbInstanceArena *pendingArena = _arena;
+    _arena = root->arena;
+    map < string, string > vars = inst->getVarsMap();
+    try {
+        createSubItems(inst, vars, inst->lazyExprEval, NULL, -1, false, false, true);
+        evalUnionSelectors(root->nodeDesc && root->nodeDesc->name == rootNode, false);
     } catch (AdbException &exp) {
-        _lastError = exp.what_s();
-        if (allowMultipleExceptions) {
-            insertNewException(ExceptionHolder::FATAL_EXCEPTION, _lastError);
+        for (size_t i = 0; i < inst->subItems.size(); i++) {
+            releaseInstance(inst->subItems[i]);
         }
-        return NULL;
-    } catch (...) {
-        _lastError = "Unknown error occurred";
-        return NULL;
+        inst->subItems.clear();
+        inst->lazyAdb = this;
+        _unionSelectorEvalDeffered.swap(pendingUnions);
+        _arena = pendingArena;
+        throw;
     }
+    _unionSelectorEvalDeffered.swap(pendingUnions);
+    _arena = pendingArena;
 }
 
 /**
@@ -1643,9 +2119,7 @@ vector<string> Adb::getNodeDeps(string nodeName) {
 vector<AdbInstance*> Adb::createInstance(AdbField *field,
         AdbInstance *parent, map<string, string> vars, bool isExprEval,
         AdbProgress *progressObj, int depth, bool ignoreMissingNodes,
-        bool allowMultipleExceptions) {
-    static const regex EXP_PATTERN(
-            "\\s*([a-zA-Z0-9_]+)=((\\$\\(.*?\\)|\\S+|$)*)\\s*");
+        bool allowMultipleExceptions, bool lazyUnions) {
     if (progressObj) {
         progressObj->progress();
     }
@@ -1653,14 +2127,14 @@ vector<AdbInstance*> Adb::createInstance(AdbField *field,
     // if array create instance for each item. else - create 1
     vector<AdbInstance*> instList;
     for (u_int32_t i = 0; i < field->arrayLen(); i++) {
-        AdbInstance *inst = new AdbInstance;
+        AdbInstance *inst = newInstance();
         inst->fieldDesc = field;
 
         // if field is struct - find field->subNode in nodes map and addto instance not desc
         if (field->isStruct()) {
             NodesMap::iterator it = nodesMap.find(field->subNode);
             if (it == nodesMap.end()) {
-                delete inst;
+                releaseInstance(inst);
                 raiseException(allowMultipleExceptions,
                               "Can't find the definition for subnode: " + field->subNode + " of field: " + field->name,
                               ExceptionHolder::ERROR_EXCEPTION);
@@ -1705,30 +2179,15 @@ vector<AdbInstance*> Adb::createInstance(AdbField *field,
                 boost::algorithm::trim(varStr);
 
                 // build var_name->value map from varAttrStr
-                AttrsMap curVars;
                 if (!varStr.empty()) {
-                    match_results < string::const_iterator > what;
-                    string::const_iterator start = varStr.begin();
-                    string::const_iterator end = varStr.end();
-
-                    while (regex_search(start, end, what, EXP_PATTERN)) {
-                        string var(what[1].first, what[1].second);
-                        string exp(what[2].first, what[2].second);
-#if 0
-                        printf("%s) %s <=> %s\n", inst->fullName().c_str(), var.c_str(), exp.c_str());
-                        printf("Variable Attr: %s\n", inst->field->attrs["variables"].c_str());
-#endif
-                        start = what[0].second;
-                        curVars[var] = exp;
-                    }
-
-                    for (AttrsMap::iterator it = curVars.begin(); it
+                    const AttrsMap &curVars = parseVarsAttr(varStr);
+                    for (AttrsMap::const_iterator it = curVars.begin(); it
                             != curVars.end(); it++) {
                         vars[it->first] = it->second;
                     }
 
                     // evaluate the variables themselves
-                    for (AttrsMap::iterator it = curVars.begin(); it
+                    for (AttrsMap::const_iterator it = curVars.begin(); it
                             != curVars.end(); it++) {
                         vars[it->first] = evalExpr(it->second, &vars);
                     }
@@ -1747,7 +2206,11 @@ vector<AdbInstance*> Adb::createInstance(AdbField *field,
                         continue;
                     }
 
-                    inst->setInstanceAttr(it->first, evalExpr(it->second, &vars));
+                    // unchanged values are read from the field definition
+                    string value = evalExpr(it->second, &vars);
+                    if (value != it->second) {
+                        inst->setInstanceAttr(it->first, value);
+                    }
                 }
                 inst->setVarsMap(vars);
             } catch (AdbException &exp) {
@@ -1784,38 +2247,13 @@ vector<AdbInstance*> Adb::createInstance(AdbField *field,
                  ") (" +  boost::lexical_cast<string>(inst->nodeDesc->size) + ")";*/
             }
 
-            vector<AdbField*>::iterator it;
-            for (it = inst->nodeDesc->fields.begin(); it
-                    != inst->nodeDesc->fields.end(); it++) {
-                map < string, string > varsCopy = vars;
-                vector<AdbInstance*> subItems = createInstance(*it, inst, vars,
-                        isExprEval, progressObj, depth == -1 ? -1 : depth - 1,
-                        ignoreMissingNodes, allowMultipleExceptions);
-                inst->subItems.insert(inst->subItems.end(), subItems.begin(),
-                        subItems.end());
-            }
-
-            if (!inst->isUnion()) {
-                stable_sort(inst->subItems.begin(), inst->subItems.end(),
-                            compareFieldsPtr<AdbInstance> );
-
-                for (size_t j = 0; j < inst->subItems.size() - 1; j++) {
-                    //printf("field: %s, offset: %s\n", inst->subItems[j+1]->name.c_str(),formatAddr(inst->subItems[j+1]->offset, inst->subItems[j+1]->size).c_str());
-                    //printf("field: %s, offset: %s\n", inst->subItems[j]->name.c_str(),formatAddr(inst->subItems[j]->offset, inst->subItems[j]->size).c_str());
-                    if (inst->subItems[j + 1]->offset
-                        < inst->subItems[j]->offset + inst->subItems[j]->size) {
-                        string exceptionTxt = "Field ("
-                                + inst->subItems[j + 1]->name + ") ("
-                                + formatAddr(inst->subItems[j + 1]->offset,
-                                        inst->subItems[j + 1]->size).c_str()
-                                + ") overlaps with (" + inst->subItems[j]->name
-                                + ") (" + formatAddr(inst->subItems[j]->offset,
-                                inst->subItems[j]->size).c_str() + ")";
-                        raiseException(allowMultipleExceptions, 
-                              exceptionTxt,
-                              ExceptionHolder::ERROR_EXCEPTION);  
-                    }
-                }
+            if (lazyUnions && depth == -1 && parent->isUnion()) {
+                // Union members are instantiated on first access (AdbInstance::expand)
+                inst->lazyAdb = this;
+                inst->lazyExprEval = isExprEval;
+            } else {
+                createSubItems(inst, vars, isExprEval, progressObj, depth,
+                        ignoreMissingNodes, allowMultipleExceptions, lazyUnions);
             }
         }
 
@@ -1826,6 +2264,53 @@ vector<AdbInstance*> Adb::createInstance(AdbField *field,
     return instList;
 }
 
+/**
+ * Function: Adb::createSubItems
+ **/
+void Adb::createSubItems(AdbInstance *inst, map<string, string> &vars,
+        bool isExprEval, AdbProgress *progressObj, int depth,
+        bool ignoreMissingNodes, bool allowMultipleExceptions,
+        bool lazyUnions) {
+    vector<AdbField*>::iterator it;
+    size_t numItems = 0;
+    for (it = inst->nodeDesc->fields.begin(); it
+            != inst->nodeDesc->fields.end(); it++) {
+        numItems += (*it)->arrayLen();
+    }
+    inst->subItems.reserve(numItems);
+    for (it = inst->nodeDesc->fields.begin(); it
+            != inst->nodeDesc->fields.end(); it++) {
+        vector<AdbInstance*> subItems = createInstance(*it, inst, vars,
+                isExprEval, progressObj, depth == -1 ? -1 : depth - 1,
+                ignoreMissingNodes, allowMultipleExceptions, lazyUnions);
+        inst->subItems.insert(inst->subItems.end(), subItems.begin(),
+                subItems.end());
+    }
+
+    if (!inst->isUnion()) {
+        stable_sort(inst->subItems.begin(), inst->subItems.end(),
+                    compareFieldsPtr<AdbInstance> );
+
+        for (size_t j = 0; j < inst->subItems.size() - 1; j++) {
+            //printf("field: %s, offset: %s\n", inst->subItems[j+1]->name.c_str(),formatAddr(inst->subItems[j+1]->offset, inst->subItems[j+1]->size).c_str());
+            //printf("field: %s, offset: %s\n", inst->subItems[j]->name.c_str(),formatAddr(inst->subItems[j]->offset, inst->subItems[j]->size).c_str());
+            if (inst->subItems[j + 1]->offset
+                < inst->subItems[j]->offset + inst->subItems[j]->size) {
+                string exceptionTxt = "Field ("
+                        + inst->subItems[j + 1]->name + ") ("
+                        + formatAddr(inst->subItems[j + 1]->offset,
+                                inst->subItems[j + 1]->size).c_str()
+                        + ") overlaps with (" + inst->subItems[j]->name
+                        + ") (" + formatAddr(inst->subItems[j]->offset,
+                        inst->subItems[j]->size).c_str() + ")";
+                raiseException(allowMultipleExceptions, 
+                      exceptionTxt,
+                      ExceptionHolder::ERROR_EXCEPTION);  
+            }
+        }
+    }
+}
+
 /**
  * Function: Adb::checkInstanceOffsetValidity
  **/
@@ -1878,106 +2363,241 @@ u_int32_t Adb::calcArrOffset(AdbField *fieldDesc, AdbInstance *parent,
 }
 
 /**
- * Function: Adb::evalExpr
+ * Function: Adb::parseVarsAttr
+ * Splits a "variables" attribute into var_name->expression, once per distinct attribute
  **/
-string Adb::evalExpr(string expr, AttrsMap *vars) {
-    if (expr.find('$') == string::npos) {
-        return expr;
+const AttrsMap& Adb::parseVarsAttr(const string &varStr) {
+    static const regex EXP_PATTERN(
+            "\\s*([a-zA-Z0-9_]+)=((\\$\\(.*?\\)|\\S+|$)*)\\s*");
+    map<string, AttrsMap>::iterator it = _parsedVarsAttrs.find(varStr);
+    if (it != _parsedVarsAttrs.end()) {
+        return it->second;
     }
 
-    smatch what, what2;
-    regex singleExpr("^([^\\$]*)(\\$\\(([^)]+)\\))(.*)$");
-    while (regex_search(expr, what, singleExpr)) {
-        string vname = what[3].str();
-        string vvalue;
-        regex singleVar("^[a-zA-Z_][a-zA-Z0-9_]*$");
-
-        //Need to change to array-like initialization when we'll move to c++11
-        vector<string> specialVars;
-        specialVars.push_back("NAME");
-        specialVars.push_back("ARR_IDX");
-        specialVars.push_back("BN");
-        specialVars.push_back("parent");
+    AttrsMap &curVars = _parsedVarsAttrs[varStr];
+    match_results < string::const_iterator > what;
+    string::const_iterator start = varStr.begin();
+    string::const_iterator end = varStr.end();
+    while (regex_search(start, end, what, EXP_PATTERN)) {
+        string var(what[1].first, what[1].second);
+        string exp(what[2].first, what[2].second);
+        start = what[0].second;
+        curVars[var] = exp;
+    }
+    return curVars;
+}
 
-        if (regex_search(vname, what2, singleVar)) {
-            if (find(specialVars.begin(), specialVars.end(), vname) == specialVars.end()) {
-                return expr;
-            } else {
-                AttrsMap::iterator it = vars->find(vname);
-                if (it == vars->end()) {
-                    throw AdbException("Can't find the variable: " + vname);
-                }
-                vvalue = it->second;
-            }
-        } else {
-            string vnameCopy = vname;
-            regex singleVarInExpr("[a-zA-Z_][a-zA-Z0-9_]*");
-            smatch matches;
-            while (regex_search(vnameCopy, matches, singleVarInExpr)) {
-                if (find(specialVars.begin(), specialVars.end(), matches[0]) == specialVars.end()) {
-                    return expr;
-                }
-                vnameCopy = matches.suffix();
-            }
+static bool isSpecialVar(const string &name) {
+    return name == "NAME" || name == "ARR_IDX" || name == "BN" || name == "parent";
+}
 
-            char exp[vname.size() + 1];
-            char *expPtr = exp;
-            strcpy(exp, vname.c_str());
-            u_int64_t res;
-            _adbExpr.setVars(vars);
-            int status = _adbExpr.expr(&expPtr, &res);
-            string statusStr;
+static bool isVarStartChar(char c) {
+    return isalpha((unsigned char)c) || c == '_';
+}
 
-            //printf("-D- Eval expr \"%s\" = %ul.\n", vname.ascii(), (u_int32_t)res);
+static bool isVarChar(char c) {
+    return isalnum((unsigned char)c) || c == '_';
+}
 
-            if (status < 0) {
-                switch (status) {
-                case Expr::ERR_RPAR_EXP:
-                    statusStr = "Right parentheses expected";
-                    break;
+/**
+ * Function: Adb::compileExpr
+ * Splits an attribute value into literal text and $(...) references.
+ * A reference to anything but the special variables ends the substitution,
+ * the rest of the text is kept as is.
+ **/
+const Adb::CompiledExpr& Adb::compileExpr(const string &expr) {
+    map<string, CompiledExpr>::iterator it = _compiledExprs.find(expr);
+    if (it != _compiledExprs.end()) {
+        return it->second;
+    }
 
-                case Expr::ERR_VALUE_EXP:
-                    statusStr = "Value expected";
-                    break;
+    CompiledExpr &segs = _compiledExprs[expr];
+    ExprSegment seg;
+    size_t pos = 0;
+    while (pos < expr.size()) {
+        size_t refStart = expr.find('$', pos);
+        if (refStart == string::npos || refStart + 2 >= expr.size() || expr[refStart + 1] != '(') {
+            break;
+        }
+        size_t refEnd = expr.find(')', refStart + 2);
+        if (refEnd == string::npos || refEnd == refStart + 2) {
+            break;
+        }
+        string vname = expr.substr(refStart + 2, refEnd - refStart - 2);
+
+        seg.vars.clear();
+        bool isSingleVar = isVarStartChar(vname[0]);
+        for (size_t i = 0; i < vname.size(); ) {
+            if (!isVarStartChar(vname[i])) {
+                isSingleVar = false;
+                i++;
+                continue;
+            }
+            size_t j = i + 1;
+            while (j < vname.size() && isVarChar(vname[j])) {
+                j++;
+            }
+            string var = vname.substr(i, j - i);
+            if (!isSpecialVar(var)) {
+                seg.vars.clear();
+                seg.vars.push_back(var);
+                break;
+            }
+            if (find(seg.vars.begin(), seg.vars.end(), var) == seg.vars.end()) {
+                seg.vars.push_back(var);
+            }
+            i = j;
+        }
+        if (seg.vars.size() == 1 && !isSpecialVar(seg.vars[0])) {
+            break;
+        }
 
-                case Expr::ERR_BIN_EXP:
-                    statusStr = "Binary operation expected ";
-                    break;
+        if (refStart > pos) {
+            seg.type = EXPR_SEG_TEXT;
+            seg.text = expr.substr(pos, refStart - pos);
+            segs.push_back(seg);
+        }
+        seg.type = isSingleVar ? EXPR_SEG_VAR : EXPR_SEG_EXPR;
+        seg.text = vname;
+        seg.tail = expr.substr(refStart);
+        segs.push_back(seg);
+        seg.tail.clear();
+        pos = refEnd + 1;
+    }
 
-                case Expr::ERR_DIV_ZERO:
-                    statusStr = "Divide zero attempt";
-                    break;
+    if (pos < expr.size()) {
+        seg.type = EXPR_SEG_TEXT;
+        seg.text = expr.substr(pos);
+        seg.vars.clear();
+        segs.push_back(seg);
+    }
+    return segs;
+}
 
-                case Expr::ERR_BAD_NUMBER:
-                    statusStr = "Bad constant syntax";
-                    break;
+/**
+ * Function: Adb::evalExprSegment
+ **/
+string Adb::evalExprSegment(const ExprSegment &seg, const string &evaluated,
+        AttrsMap *vars) {
+    // The result only depends on the values of the special variables it uses
+    string key = seg.text;
+    for (size_t i = 0; i < seg.vars.size(); i++) {
+        AttrsMap::iterator it = vars->find(seg.vars[i]);
+        key += '\0';
+        key += (it == vars->end() ? string("\1") : it->second);
+    }
+    map<string, string>::iterator it = _exprValues.find(key);
+    if (it != _exprValues.end()) {
+        return it->second;
+    }
+
+    char exp[seg.text.size() + 1];
+    char *expPtr = exp;
+    strcpy(exp, seg.text.c_str());
+    u_int64_t res;
+    _adbExpr.setVars(vars);
+    int status = _adbExpr.expr(&expPtr, &res);
+    //printf("-D- Eval expr \"%s\" = %ul.\n", seg.text.c_str(), (u_int32_t)res);
+    if (status < 0) {
+        throw AdbException(
+                "Error evaluating expression " + evaluated + seg.tail + " : "
+                        + AdbExpr::statusStr(status));
+    }
 
-                case Expr::ERR_BAD_NAME:
-                    statusStr = "Variable Name not resolved";
-                    break;
+    string value = boost::lexical_cast<string>(res);
+    _exprValues[key] = value;
+    return value;
+}
 
-                default:
-                    statusStr = "Unknown error";
+/**
+ * Function: Adb::evalExpr
+ **/
+string Adb::evalExpr(string expr, AttrsMap *vars) {
+    if (expr.find('$') == string::npos) {
+        return expr;
+    }
 
-                }
+    const CompiledExpr &segs = compileExpr(expr);
+    string evaluated;
+    for (size_t i = 0; i < segs.size(); i++) {
+        const ExprSegment &seg = segs[i];
+        switch (seg.type) {
+        case EXPR_SEG_TEXT:
+            evaluated += seg.text;
+            break;
 
-                throw AdbException(
-                        "Error evaluating expression " + expr + " : "
-                                + statusStr);
+        case EXPR_SEG_VAR:
+        {
+            AttrsMap::iterator it = vars->find(seg.text);
+            if (it == vars->end()) {
+                throw AdbException("Can't find the variable: " + seg.text);
             }
+            evaluated += it->second;
+            break;
+        }
 
-            vvalue = boost::lexical_cast<string>(res);
+        case EXPR_SEG_EXPR:
+            evaluated += evalExprSegment(seg, evaluated, vars);
+            break;
         }
+    }
 
-        /*printf("what[0] - %s, what[1] - %s, what[2] - %s,  what[3] - %s, what[4] - %s\n",
-         what[0].str().c_str(), what[1].str().c_str(),
-         what[2].str().c_str(), what[3].str().c_str(),
-         what[4].str().c_str());*/
+    return evaluated;
+}
 
-        expr = what[1].str() + vvalue + what[4].str();
+/*
+ * checkInstSizeConsistency() splits the nodes between the threads of a pool,
+ * each node gets its own errors list so they are reported in the nodes order
+ */
+#define ADB_CHECK_NODES_PER_JOB 256
+typedef struct {
+    NodesMap *nodesMap;
+    vector<AdbNode*> nodes;
+    vector<StringVector> errors;
+} InstSizeCheckCtx;
+
+/**
+ * Function: checkNodeInstSizes
+ **/
+static void checkNodeInstSizes(NodesMap& nodesMap, AdbNode *node, StringVector& errors) {
+    for (size_t i = 0; i < node->fields.size(); i++) {
+        if (node->fields[i]->isStruct()) {
+            NodesMap::iterator iter = nodesMap.find(node->fields[i]->subNode);
+            if (iter == nodesMap.end()) {
+                continue;
+                /*
+                 _lastError = "Can't find definition of subnode \"" + node->fields[i]->subNode +
+                 "\" instantiated from node \"" + node->name + "\"";
+                 return false;
+                 */
+            }
+            AdbNode *subNode = iter->second;
+            if (subNode->size != node->fields[i]->size / node->fields[i]->arrayLen()) {
+                char tmp[256];
+                sprintf(
+                        tmp,
+                        "Node (%s) size 0x%x.%d is not consistent with the instance (%s->%s) size 0x%x.%d",
+                        subNode->name.c_str(), (subNode->size >> 5) << 2,
+                        subNode->size % 32, node->name.c_str(),
+                        node->fields[i]->name.c_str(),
+                        (node->fields[i]->size >> 5) << 2,
+                        node->fields[i]->size % 32);
+                errors.push_back(tmp);
+            }
+        }
     }
+}
 
-    return expr;
+/**
+ * Function: checkInstSizesJob
+ **/
+static void checkInstSizesJob(void *ctx, u_int32_t jobIdx) {
+    InstSizeCheckCtx *checkCtx = (InstSizeCheckCtx*) ctx;
+    size_t first = (size_t) jobIdx * ADB_CHECK_NODES_PER_JOB;
+    size_t last = MIN(first + ADB_CHECK_NODES_PER_JOB, checkCtx->nodes.size());
+    for (size_t i = first; i < last; i++) {
+        checkNodeInstSizes(*checkCtx->nodesMap, checkCtx->nodes[i], checkCtx->errors[i]);
+    }
 }
 
 /**
@@ -1985,39 +2605,32 @@ string Adb::evalExpr(string expr, AttrsMap *vars) {
  **/
 bool Adb::checkInstSizeConsistency(bool allowMultipleExceptions) {
     bool status = true;
+    InstSizeCheckCtx checkCtx;
+    checkCtx.nodesMap = &nodesMap;
     for (NodesMap::iterator it = nodesMap.begin(); it != nodesMap.end(); it++) {
-        for (size_t i = 0; i < it->second->fields.size(); i++) {
-            if (it->second->fields[i]->isStruct()) {
-                NodesMap::iterator iter = nodesMap.find(
-                        it->second->fields[i]->subNode);
-                if (iter == nodesMap.end()) {
-                    continue;
-                    /*
-                     _lastError = "Can't find definition of subnode \"" + it->second->fields[i]->subNode +
-                     "\" instantiated from node \"" + it->first + "\"";
-                     return false;
-                     */
-                }
-                AdbNode *node = nodesMap[it->second->fields[i]->subNode];
-                if (node->size != it->second->fields[i]->size
-                        / it->second->fields[i]->arrayLen()) {
-                    char tmp[256];
-                    sprintf(
-                            tmp,
-                            "Node (%s) size 0x%x.%d is not consistent with the instance (%s->%s) size 0x%x.%d",
-                            node->name.c_str(), (node->size >> 5) << 2,
-                            node->size % 32, it->second->name.c_str(),
-                            it->second->fields[i]->name.c_str(),
-                            (it->second->fields[i]->size >> 5) << 2,
-                            it->second->fields[i]->size % 32);
-                    _lastError = tmp;
-                    if (allowMultipleExceptions) {
-                        status = false;
-                        insertNewException(ExceptionHolder::ERROR_EXCEPTION, tmp);
-                    } else {
-                        return false;
-                    }
-                }
+        checkCtx.nodes.push_back(it->second);
+    }
+    checkCtx.errors.resize(checkCtx.nodes.size());
+
+    u_int32_t numOfJobs = (checkCtx.nodes.size() + ADB_CHECK_NODES_PER_JOB - 1) / ADB_CHECK_NODES_PER_JOB;
+    u_int32_t numOfThreads = adbLoadThreads();
+    if (numOfJobs > 1 && numOfThreads > 1) {
+        mft_utils::MftThreadPool pool(numOfThreads);
+        pool.run(numOfJobs, checkInstSizesJob, &checkCtx);
+    } else {
+        for (u_int32_t i = 0; i < numOfJobs; i++) {
+            checkInstSizesJob(&checkCtx, i);
+        }
+    }
+
+    for (size_t i = 0; i < checkCtx.errors.size(); i++) {
+        for (size_t j = 0; j < checkCtx.errors[i].size(); j++) {
+            _lastError = checkCtx.errors[i][j];
+            if (allowMultipleExceptions) {
+                status = false;
+                insertNewException(ExceptionHolder::ERROR_EXCEPTION, _lastError);
+            } else {
+                return false;
             }
         }
     }
@@ -2128,6 +2741,9 @@ AdbParser::AdbParser(string fileName, Adb *adbCtxt, bool addReserved,
         _adbCtxt->includedFiles[path[path.size() - 1]] = info;
     }
     _instanceOps = false;
+    _deferIncludes = false;
+    _touchesSharedState = false;
+    _ctxtChangedAfterInclude = false;
 }
 
 void AdbParser::addIncludePaths(Adb *adbCtxt, string includePaths) {
@@ -2384,6 +3000,17 @@ string AdbParser::attrValue(const XML_Char **atts, int i) {
     return string(atts[i * 2 + 1]);
 }
 
+/**
+ * Function: AdbParser::noteSharedStateChange
+ * Called for every element that changes state the following elements are parsed with
+ **/
+void AdbParser::noteSharedStateChange() {
+    _touchesSharedState = true;
+    if (!_pendingIncludes.empty()) {
+        _ctxtChangedAfterInclude = true;
+    }
+}
+
 /**
  * Function: AdbParser::findFile
  **/
@@ -2520,6 +3147,12 @@ void AdbParser::includeFile(AdbParser *adbParser, string fileName,
     boost::filesystem::path boostPath(filePath);
     fileName = boostPath.filename().string();
 
+    if (adbParser->_deferIncludes) {
+        PendingInclude pending = { filePath, fileName, adbParser->_fileName, lineNumber };
+        adbParser->_pendingIncludes.push_back(pending);
+        return;
+    }
+
     if (!adbParser->_adbCtxt->includedFiles.count(fileName)) {
         IncludeFileInfo info = { filePath, adbParser->_fileName, lineNumber };
         adbParser->_adbCtxt->includedFiles[fileName] = info;
@@ -2551,7 +3184,8 @@ void AdbParser::includeAllFilesInDir(AdbParser *adbParser, string dirPath,
 
         if (boost::filesystem::exists(fsPath)
                 && boost::filesystem::is_directory(fsPath)) {
-                    addIncludePaths(adbParser->_adbCtxt, *pathIt);
+            adbParser->noteSharedStateChange();
+            addIncludePaths(adbParser->_adbCtxt, *pathIt);
             boost::filesystem::directory_iterator filesIter(fsPath), dirEnd;
             for (; filesIter != dirEnd; ++filesIter) {
                 if (boost::filesystem::is_regular_file(filesIter->status())
@@ -2671,6 +3305,7 @@ void AdbParser::startEnumElement(const XML_Char **atts, AdbParser *adbParser, co
 void AdbParser::startConfigElement(const XML_Char **atts, AdbParser *adbParser, const int lineNumber) 
 {
     bool expFound = false;
+    adbParser->noteSharedStateChange();
     if (adbParser->_currentConfig) {
         expFound = raiseException(allowMultipleExceptions, 
                             "config tag can't appear within other config",
@@ -2741,6 +3376,7 @@ void AdbParser::startInfoElement(const XML_Char **atts, AdbParser *adbParser)
 {
     string docName = attrValue(atts, "source_doc_name");
     string docVer = attrValue(atts, "source_doc_version");
+    adbParser->noteSharedStateChange();
     adbParser->_adbCtxt->srcDocName = docName;
     adbParser->_adbCtxt->srcDocVer = docVer;
 }
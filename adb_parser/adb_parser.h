@@ -93,6 +93,8 @@ public:
 
 /*************************** AdbNode ***************************/
 class AdbField;
+class Adb;
+class AdbInstanceArena;
 typedef map<string, string> AttrsMap;
 typedef vector<AdbField*> FieldsList;
 class AdbNode {
@@ -215,6 +217,8 @@ public:
     void setVarsMap(const AttrsMap &AttrsMap);
     AttrsMap getVarsMap();
     vector<AdbInstance*> getLeafFields(bool extendedName); // Get all leaf fields
+    bool isLazy() { return lazyAdb != NULL; }
+    void expand(); // Create the subtree of a lazy union member
     void pushBuf(u_int8_t *buf, u_int64_t value);
     u_int64_t popBuf(u_int8_t *buf);
     int instAttrsMapLen() {return instAttrsMap.size();}
@@ -236,9 +240,16 @@ public:
     bool isDiff;
     // FOR USER USAGE
     void *userData;
+    // Set on union members whose subtree wasn't created yet (lazy layout)
+    Adb *lazyAdb;
+    bool lazyExprEval;
 private:
-    AttrsMap instAttrsMap; // Attributes after evaluations and array expanding
+    friend class Adb;
+    friend class AdbInstanceArena;
+    AttrsMap instAttrsMap; // Attributes that differ from fieldDesc->attrs after evaluations
     AttrsMap varsMap; // all variables relevant to this item after evaluation
+    AdbInstanceArena *arena; // Layout roots only: storage of all the instances below
+    bool isArenaItem;
 };
 
 /*************************** Adb ***************************/
@@ -278,7 +289,9 @@ public:
     AdbInstance* addMissingNodes(int depth, bool allowMultipleExceptions);
     AdbInstance* createLayout(string rootNodeName, bool isExprEval = false,
             AdbProgress *progressObj = NULL, int depth = -1, /* -1 means instantiate full tree */
-            bool ignoreMissingNodes = false, bool getAllExceptions = false);
+            bool ignoreMissingNodes = false, bool getAllExceptions = false,
+            bool lazyUnions = false); /* union members are expanded on first access */
+    void expandInstance(AdbInstance *inst);
     vector<string> getNodeDeps(string nodeName);
     string getLastError();
 
@@ -314,17 +327,46 @@ private:
     vector<AdbInstance*> createInstance(AdbField *fieldDesc,
             AdbInstance *parent, map<string, string> vars, bool isExprEval,
             AdbProgress *progressObj, int depth,
-            bool ignoreMissingNodes = false, bool getAllExceptions = false);
+            bool ignoreMissingNodes = false, bool getAllExceptions = false,
+            bool lazyUnions = false);
+    void createSubItems(AdbInstance *inst, map<string, string> &vars,
+            bool isExprEval, AdbProgress *progressObj, int depth,
+            bool ignoreMissingNodes, bool allowMultipleExceptions,
+            bool lazyUnions);
+    void evalUnionSelectors(bool isRootLayout, bool allowMultipleExceptions);
+    AdbInstance* newInstance();
+    void releaseInstance(AdbInstance *inst);
     u_int32_t calcArrOffset(AdbField *fieldDesc, AdbInstance *parent,
             u_int32_t arrIdx);
     string evalExpr(string expr, AttrsMap *vars);
+    /* An attribute expression split once into text and $(...) references */
+    typedef enum {
+        EXPR_SEG_TEXT,  // literal text
+        EXPR_SEG_VAR,   // $(NAME) - a single special variable
+        EXPR_SEG_EXPR   // $(ARR_IDX * 4) - arithmetic over special variables
+    } ExprSegType;
+    typedef struct {
+        ExprSegType type;
+        string text;          // literal text, variable name or expression
+        string tail;          // source text from this reference on (error messages)
+        vector<string> vars;  // special variables used by an expression
+    } ExprSegment;
+    typedef vector<ExprSegment> CompiledExpr;
+    const CompiledExpr& compileExpr(const string &expr);
+    string evalExprSegment(const ExprSegment &seg, const string &evaluated,
+            AttrsMap *vars);
+    const AttrsMap& parseVarsAttr(const string &varStr);
     bool checkInstSizeConsistency(bool getAllExceptions = false);
     void cleanInstAttrs();
 
 private:
     string _lastError;
     AdbExpr _adbExpr;
+    map<string, CompiledExpr> _compiledExprs;
+    map<string, string> _exprValues; // expression + variable values -> result
+    map<string, AttrsMap> _parsedVarsAttrs;
     std::list<AdbInstance*> _unionSelectorEvalDeffered;
+    AdbInstanceArena *_arena; // arena of the layout being instantiated
     void checkInstanceOffsetValidity(AdbInstance *inst, AdbInstance *parent, bool allowMultipleExceptions);
     void throwExeption(bool allowMultipleExceptions, string exceptionTxt, string addedMsgMultiExp);
 };
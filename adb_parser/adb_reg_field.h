@@ -0,0 +1,96 @@
+
+/* 
+ * Copyright (C) Jan 2019 Mellanox Technologies Ltd. All rights reserved.
+ * 
+ * This software is available to you under a choice of one of two
+ * licenses.  You may choose to be licensed under the terms of the GNU
+ * General Public License (GPL) Version 2, available from the file
+ * COPYING in the main directory of this source tree, or the
+ * OpenIB.org BSD license below:
+ * 
+ *     Redistribution and use in source and binary forms, with or
+ *     without modification, are permitted provided that the following
+ *     conditions are met:
+ * 
+ *      - Redistributions of source code must retain the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer.
+ * 
+ *      - Redistributions in binary form must reproduce the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer in the documentation and/or other materials
+ *        provided with the distribution.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+ *
+ */
+
+#ifndef ADB_REG_FIELD_H
+#define ADB_REG_FIELD_H
+
+#include <stddef.h>
+#include <common/compatibility.h>
+#include <common/bit_slice.h>
+#include "buf_ops.h"
+
+/*
+ * Compile-time description of a register field, the base of the structs
+ * emitted by adb2cpp. OFFSET and SIZE are in ADB bit notation, the same
+ * values AdbInstance::offset/size carry at runtime, and get/set work on the
+ * big-endian register buffer as it is sent to and returned by the device.
+ * Fields that fit in one dword are a shift and a mask, wider or unaligned
+ * ones go through pop_from_buf/push_to_buf.
+ */
+template <u_int32_t OFFSET, u_int32_t SIZE>
+struct AdbRegField {
+    static constexpr u_int32_t offset = OFFSET;
+    static constexpr u_int32_t size = SIZE;
+    static constexpr bool inDword = SIZE <= 32 && (OFFSET % 32) + SIZE <= 32;
+    // keeps the dword path well formed for the fields that never take it
+    static constexpr u_int32_t dwordSize = inDword ? SIZE : 32;
+
+    static inline u_int64_t get(const u_int8_t *buf)
+    {
+        if (inDword) {
+            u_int32_t dword = __be32_to_cpu(((const u_int32_t*)buf)[OFFSET >> 5]);
+            return EXTRACT(dword, OFFSET % 32, dwordSize);
+        }
+        return pop_from_buf(buf, OFFSET, SIZE);
+    }
+
+    static inline void set(u_int8_t *buf, u_int64_t value)
+    {
+        if (inDword) {
+            u_int32_t *dword = ((u_int32_t*)buf) + (OFFSET >> 5);
+            *dword = __cpu_to_be32(MERGE(__be32_to_cpu(*dword), (u_int32_t)value, OFFSET % 32, dwordSize));
+            return;
+        }
+        push_to_buf(buf, OFFSET, SIZE, value);
+    }
+};
+
+template <u_int32_t OFFSET, u_int32_t SIZE>
+constexpr u_int32_t AdbRegField<OFFSET, SIZE>::offset;
+template <u_int32_t OFFSET, u_int32_t SIZE>
+constexpr u_int32_t AdbRegField<OFFSET, SIZE>::size;
+template <u_int32_t OFFSET, u_int32_t SIZE>
+constexpr bool AdbRegField<OFFSET, SIZE>::inDword;
+template <u_int32_t OFFSET, u_int32_t SIZE>
+constexpr u_int32_t AdbRegField<OFFSET, SIZE>::dwordSize;
+
+// Runtime view of a generated field, to check it against the loaded ADB
+struct AdbRegFieldDesc {
+    const char *name;
+    u_int32_t offset;
+    u_int32_t size;
+};
+
+#endif // ADB_REG_FIELD_H
@@ -37,11 +37,6 @@
 #include <string.h>
 #include "expr.h"
 
-
-char*Expr::str;
-char*Expr::initial_arg;
-Expr::status Expr::state;
-
 /*
  * Number of elements in array
  */
@@ -483,7 +478,7 @@ int Expr::GetUnaryOp(u_int64_t *val)
 * routine:     GetToken
 *
 * description:
-*     Gets next token from static pointer str.
+*     Gets next token from member pointer str.
 *
 * arguments:
 *     pt              pointer to token. GetToken fills in all
@@ -494,7 +489,7 @@ int Expr::GetUnaryOp(u_int64_t *val)
 *
 * side effects:
 *     1. May insrease pointer str (if token getted successfully).
-*     2. May change static variable state (if token getted
+*     2. May change member variable state (if token getted
 *        successfully and state was changed).
 *
 ********************************************************/
@@ -723,7 +718,7 @@ int Expr::GetNumb(u_int64_t *val)
 #define MAXNAM 100
 int Expr::GetName(u_int64_t *val)
 {
-    static char name[MAXNAM];
+    char        name[MAXNAM];
     char        *p, *old_str;
 
     old_str = str;     /* Save start name position. */
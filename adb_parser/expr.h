@@ -114,7 +114,7 @@ public:
         ERR_BAD_NUMBER = -5,   // Bad constant syntax
         ERR_BAD_NAME  = -6    // Name not resolved
     };
-    Expr() : def_radix(10) { }
+    Expr() : str(NULL), initial_arg(NULL), state(was_bin), def_radix(10) { }
     virtual ~Expr()        { }
 
     int     expr(char **pstr, u_int64_t *result);
@@ -142,9 +142,10 @@ public:
 
 private:
 
-    static char    *str;
-    static char    *initial_arg;
-    static status state;
+    // parsing state is kept per object, so expressions can be evaluated concurrently
+    char    *str;
+    char    *initial_arg;
+    status state;
     int def_radix;
 
     int     GetBinaryOp(u_int64_t *val, int priority);
@@ -124,6 +124,9 @@ SubCmdMetaData::SubCmdMetaData()
 #if !defined(UEFI_BUILD) && !defined(NO_OPEN_SSL)
     _sCmds.push_back(new SubCmd("", "export_public_key", SC_Export_Public_Key));
 #endif
+#ifndef __WIN__
+    _sCmds.push_back(new SubCmd("bq", "batch_query", SC_Batch_Query));
+#endif
 }
 
 SubCmdMetaData::~SubCmdMetaData()
@@ -174,6 +174,9 @@ map_sub_cmd_t_to_subcommand Flint::initSubcommandMap()
     cmdMap[SC_Import_Hsm_Key] = new  ImportHsmKeySubCommand();
 #if !defined(UEFI_BUILD) && !defined(NO_OPEN_SSL)
     cmdMap[SC_Export_Public_Key] = new ExportPublicSubCommand();
+#endif
+#ifndef __WIN__
+    cmdMap[SC_Batch_Query] = new BatchQuerySubCommand();
 #endif
     return cmdMap;
 }
@@ -90,8 +90,9 @@ typedef enum {
     SC_Binary_Compare,
     SC_Import_Hsm_Key,
 #if !defined(UEFI_BUILD) && !defined(NO_OPEN_SSL)
-    SC_Export_Public_Key
+    SC_Export_Public_Key,
 #endif
+    SC_Batch_Query
 } sub_cmd_t;
 
 class FlintParams {
@@ -49,6 +49,7 @@
 #include "mlxfwops/lib/fw_ops.h"
 #include "mlxfwops/lib/fs_checks.h"
 #include "err_msgs.h"
+#include "mft_thread_pool.h"
 using namespace std;
 
 #ifndef NO_MSTARCHIVE
@@ -76,6 +77,7 @@ typedef enum what_to_ver {
 
 
 #define FLINT_ERR_LEN 1024
+#define VERSION_FORMAT(minor) minor < 100 ? "%d.%d.%04d" : "%d.%04d.%04d"
 
 class SubCommand
 {
@@ -310,6 +312,30 @@ public:
     bool verifyParams();
 };
 
+#ifndef __WIN__
+class BatchQuerySubCommand : public SubCommand
+{
+private:
+    std::vector<string> _images;
+    std::vector<string> _records;
+    std::vector<bool> _recordReady;
+    u_int32_t _nextRecordToPrint;
+    u_int32_t _numOfFailures;
+    FILE *_out;
+    mft_utils::MftMutex _outLock;
+
+    bool collectImages(const string& source);
+    bool queryImage(const string& imagePath, string& record);
+    void reportRecord(u_int32_t imageIdx, const string& record, bool success);
+    static void queryImageJob(void *ctx, u_int32_t imageIdx);
+public:
+    BatchQuerySubCommand();
+    ~BatchQuerySubCommand();
+    FlintStatus executeCommand();
+    bool verifyParams();
+};
+#endif
+
 class SignRSASubCommand : public SubCommand
 {
 private:
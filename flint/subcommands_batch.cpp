@@ -0,0 +1,301 @@
+/*
+ * Copyright (c) 2021 Mellanox Technologies Ltd.  All rights reserved.
+ *
+ * This software is available to you under a choice of one of two
+ * licenses.  You may choose to be licensed under the terms of the GNU
+ * General Public License (GPL) Version 2, available from the file
+ * COPYING in the main directory of this source tree, or the
+ * OpenIB.org BSD license below:
+ *
+ *     Redistribution and use in source and binary forms, with or
+ *     without modification, are permitted provided that the following
+ *     conditions are met:
+ *
+ *      - Redistributions of source code must retain the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer.
+ *
+ *      - Redistributions in binary form must reproduce the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer in the documentation and/or other materials
+ *        provided with the distribution.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *  Batch (offline) query and verification of FW images.
+ */
+
+#ifndef __WIN__
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include <common/compatibility.h>
+#include <mlxfwops/lib/fw_version.h>
+#include "mft_utils.h"
+#include "subcommands.h"
+
+using namespace std;
+
+static void addJsonField(string& record, const char *name, const string& value)
+{
+    record += string(", \"") + name + "\": \"" + mft_utils::json_escape(value) + "\"";
+}
+
+// the image is handed to FwOperations as a buffer, in file mode FImage reopens the file on every read
+static bool readImage(const string& path, vector<u_int8_t>& data, string& err)
+{
+    FILE *fh = fopen(path.c_str(), "rb");
+    if (!fh) {
+        err = strerror(errno);
+        return false;
+    }
+    struct stat st;
+    if (fstat(fileno(fh), &st) < 0) {
+        err = strerror(errno);
+        fclose(fh);
+        return false;
+    }
+    if (st.st_size == 0 || (st.st_size & 0x3)) {
+        fclose(fh);
+        err = "Image size should be 4-bytes aligned. Make sure the file is in the right format (binary image)";
+        return false;
+    }
+    data.resize(st.st_size);
+    if (fread(data.data(), 1, data.size(), fh) != data.size()) {
+        err = ferror(fh) ? strerror(errno) : "Unexpected end of file";
+        fclose(fh);
+        return false;
+    }
+    fclose(fh);
+    return true;
+}
+
+/***********************
+ * Class: BatchQuerySubCommand
+ **********************/
+BatchQuerySubCommand::BatchQuerySubCommand() :
+    _nextRecordToPrint(0), _numOfFailures(0), _out(stdout)
+{
+    _name = "batch_query";
+    _desc = "Query and verify all FW images in a directory or in a list file.";
+    _extendedDesc = "Query and verify FW images offline, several images at a time.\n"
+                    "\tThe images are processed by a pool of worker threads and one JSON record is printed per image,\n"
+                    "\tin the order the images were given.";
+    _flagLong = "batch_query";
+    _flagShort = "bq";
+    _param = "<directory|list file> [number of threads]";
+    _paramExp = "directory|list file : A directory of images, or a text file with one image path per line.\n"
+                "\tnumber of threads   : Number of images to process concurrently (default: number of online CPUs).";
+    _example = FLINT_NAME " batch_query ./images 8 --output_file results.json";
+    _v = Wtv_Uninitilized;
+    _maxCmdParamNum = 2;
+    _minCmdParamNum = 1;
+    _cmdType = SC_Batch_Query;
+}
+
+BatchQuerySubCommand::~BatchQuerySubCommand()
+{
+    if (_out != NULL && _out != stdout) {
+        fclose(_out);
+    }
+}
+
+bool BatchQuerySubCommand::verifyParams()
+{
+    if (_flintParams.device_specified || _flintParams.image_specified) {
+        reportErr(true, FLINT_COMMAND_INCORRECT_FLAGS_ERROR, _name.c_str(),
+                  "\"--device\" and \"--image\" flags are not allowed, images are taken from the command parameter");
+        return false;
+    }
+    if (_flintParams.cmd_params.size() == 2) {
+        u_int32_t numOfThreads;
+        if (!mft_utils::strToNum(_flintParams.cmd_params[1], numOfThreads, 0) || numOfThreads == 0) {
+            reportErr(true, FLINT_INVALID_ARG_ERROR, _flintParams.cmd_params[1].c_str());
+            return false;
+        }
+    }
+    return true;
+}
+
+bool BatchQuerySubCommand::collectImages(const string& source)
+{
+    struct stat st;
+    if (stat(source.c_str(), &st) < 0) {
+        reportErr(true, FLINT_OPEN_FILE_ERROR, source.c_str(), strerror(errno));
+        return false;
+    }
+    if (S_ISDIR(st.st_mode)) {
+        DIR *dir = opendir(source.c_str());
+        if (dir == NULL) {
+            reportErr(true, FLINT_OPEN_FILE_ERROR, source.c_str(), strerror(errno));
+            return false;
+        }
+        struct dirent *entry;
+        while ((entry = readdir(dir)) != NULL) {
+            if (entry->d_name[0] == '.') {
+                continue;
+            }
+            string path = source + "/" + entry->d_name;
+            struct stat entrySt;
+            if (stat(path.c_str(), &entrySt) == 0 && S_ISREG(entrySt.st_mode)) {
+                _images.push_back(path);
+            }
+        }
+        closedir(dir);
+        // readdir order is arbitrary, keep the output stable between runs
+        sort(_images.begin(), _images.end());
+        return true;
+    }
+    ifstream listFile(source.c_str());
+    if (!listFile.is_open()) {
+        reportErr(true, FLINT_OPEN_FILE_ERROR, source.c_str(), strerror(errno));
+        return false;
+    }
+    string line;
+    while (getline(listFile, line)) {
+        mft_utils::trim(line);
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        _images.push_back(line);
+    }
+    return true;
+}
+
+bool BatchQuerySubCommand::queryImage(const string& imagePath, string& record)
+{
+    char errBuff[FLINT_ERR_LEN] = {0};
+    string err;
+    vector<u_int8_t> image;
+
+    record = "{\"image\": \"" + mft_utils::json_escape(imagePath) + "\"";
+    if (!readImage(imagePath, image, err)) {
+        addJsonField(record, "status", "FAILED");
+        addJsonField(record, "error", err);
+        record += "}";
+        return false;
+    }
+    u_int32_t imageSize = image.size();
+    FwOperations *ops = FwOperations::FwOperationsCreate((void*)image.data(), (void*)&imageSize, NULL,
+                                                         FHT_FW_BUFF, errBuff, sizeof(errBuff));
+    if (ops == NULL) {
+        addJsonField(record, "status", "FAILED");
+        addJsonField(record, "error", strlen(errBuff) ? errBuff : "Cannot open image");
+        record += "}";
+        return false;
+    }
+
+    bool rc = true;
+    fw_info_t fwInfo;
+    memset(&fwInfo, 0, sizeof(fwInfo));
+    if (!ops->FwQuery(&fwInfo, !_flintParams.skip_rom_query, _flintParams.striped_image)) {
+        addJsonField(record, "status", "FAILED");
+        addJsonField(record, "error", string("Failed to query image: ") + ops->err());
+        rc = false;
+    } else {
+        FwVersion imageVersion = FwOperations::createFwVersion(&fwInfo.fw_info);
+        char releaseDate[32] = {0};
+        if (fwInfo.fw_info.fw_rel_date[0] || fwInfo.fw_info.fw_rel_date[1] || fwInfo.fw_info.fw_rel_date[2]) {
+            snprintf(releaseDate, sizeof(releaseDate), "%x.%x.%x", fwInfo.fw_info.fw_rel_date[0],
+                     fwInfo.fw_info.fw_rel_date[1], fwInfo.fw_info.fw_rel_date[2]);
+        }
+        addJsonField(record, "image_type", fwImgTypeToStr(fwInfo.fw_type));
+        addJsonField(record, "fw_version", imageVersion.is_set() ?
+                     imageVersion.get_fw_version(VERSION_FORMAT(fwInfo.fw_info.fw_ver[1])) : "");
+        addJsonField(record, "fw_release_date", releaseDate);
+        addJsonField(record, "product_version", fwInfo.fw_info.product_ver);
+        addJsonField(record, "psid", fwInfo.fw_info.psid);
+        addJsonField(record, "image_vsd", (char*)fwInfo.fs3_info.image_vsd);
+        record += ", \"dev_type\": " + mft_utils::numToStr(fwInfo.fw_info.dev_type);
+        record += ", \"image_size\": " + mft_utils::numToStr(imageSize);
+
+        FwOperations::ExtVerifyParams verifyParams((VerifyCallBack)NULL);
+        verifyParams.isStripedImage = _flintParams.striped_image;
+        if (!ops->FwVerifyAdv(verifyParams)) {
+            addJsonField(record, "status", "FAILED");
+            addJsonField(record, "error", string("FW image verification failed: ") + ops->err());
+            rc = false;
+        } else {
+            addJsonField(record, "status", "OK");
+        }
+    }
+    record += "}";
+    ops->FwCleanUp();
+    delete ops;
+    return rc;
+}
+
+void BatchQuerySubCommand::reportRecord(u_int32_t imageIdx, const string& record, bool success)
+{
+    mft_utils::MftLockGuard guard(_outLock);
+    _records[imageIdx] = record;
+    _recordReady[imageIdx] = true;
+    if (!success) {
+        _numOfFailures++;
+    }
+    // print every record whose predecessors are already printed, so the output keeps the input order
+    while (_nextRecordToPrint < _records.size() && _recordReady[_nextRecordToPrint]) {
+        fprintf(_out, "%s\n", _records[_nextRecordToPrint].c_str());
+        _records[_nextRecordToPrint].clear();
+        _nextRecordToPrint++;
+    }
+    fflush(_out);
+}
+
+void BatchQuerySubCommand::queryImageJob(void *ctx, u_int32_t imageIdx)
+{
+    BatchQuerySubCommand *self = (BatchQuerySubCommand*)ctx;
+    string record;
+    bool rc = self->queryImage(self->_images[imageIdx], record);
+    self->reportRecord(imageIdx, record, rc);
+}
+
+FlintStatus BatchQuerySubCommand::executeCommand()
+{
+    if (!basicVerifyParams() || !verifyParams()) {
+        return FLINT_FAILED;
+    }
+    if (!collectImages(_flintParams.cmd_params[0])) {
+        return FLINT_FAILED;
+    }
+    if (_flintParams.output_file_specified) {
+        _out = fopen(_flintParams.output_file.c_str(), "w");
+        if (_out == NULL) {
+            reportErr(true, FLINT_OPEN_FILE_ERROR, _flintParams.output_file.c_str(), strerror(errno));
+            return FLINT_FAILED;
+        }
+    }
+    u_int32_t numOfThreads = 0;
+    if (_flintParams.cmd_params.size() == 2) {
+        mft_utils::strToNum(_flintParams.cmd_params[1], numOfThreads, 0);
+    }
+    _records.assign(_images.size(), "");
+    _recordReady.assign(_images.size(), false);
+
+    mft_utils::MftThreadPool pool(numOfThreads);
+    pool.run((u_int32_t)_images.size(), queryImageJob, this);
+
+    if (_numOfFailures) {
+        reportErr(true, "%d out of %d images failed the query/verification\n", _numOfFailures, (int)_images.size());
+        return FLINT_FAILED;
+    }
+    return FLINT_SUCCESS;
+}
+
+#endif
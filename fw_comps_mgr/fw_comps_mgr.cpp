@@ -1044,6 +1044,10 @@ void FwCompsMgr::initialize(mfile *mf)
     _componentIndex = 0;
     _lastRegAccessStatus = ME_OK;
     _updateHandle = 0;
+    _currCompQuery = NULL;
+    _checkpointData = NULL;
+    _keepHandleForResume = false;
+    _checkpoint.init(mf);
     if (getFwSupport()) {
         GenerateHandle();
     }
@@ -1169,7 +1173,8 @@ FwCompsMgr::~FwCompsMgr()
     }
 #endif
     if (_mf) {
-        if (!_isDelayedActivationCommandSent) {
+        // a download interrupted by a transport error keeps its handle so the next burn can resume it
+        if (!_isDelayedActivationCommandSent && !_keepHandleForResume) {
             if (_lastFsmCtrl.control_state != FSMST_IDLE) {
                 controlFsm(FSM_CMD_CANCEL, FSMST_LOCKED);
                 controlFsm(FSM_CMD_RELEASE_UPDATE_HANDLE, FSMST_IDLE);
@@ -1362,14 +1367,162 @@ bool FwCompsMgr::queryComponentStatus(u_int32_t componentIndex,
     return true;
 }
 
+static bool isTransportError(reg_access_status_t rc)
+{
+    switch ((int)rc) {
+    case ME_CR_ERROR:
+    case ME_TIMEOUT:
+    case ME_MAD_SEND_FAILED:
+    case ME_PCI_READ_ERROR:
+    case ME_PCI_WRITE_ERROR:
+    case ME_PCI_IFC_TOUT:
+    case ME_ICMD_STATUS_CR_FAIL:
+    case ME_ICMD_BUSY:
+    case ME_ICMD_STATUS_SEMAPHORE_TO:
+    case ME_ICMD_STATUS_EXECUTE_TO:
+    case ME_ICMD_STATUS_IFC_BUSY:
+    case ME_CMDIF_BUSY:
+    case ME_CMDIF_TOUT:
+    case ME_MAD_BUSY:
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+void FwCompsMgr::updateBurnCheckpoint(u_int32_t offset, u_int32_t size)
+{
+    if (!_checkpointData) {
+        return;
+    }
+    if (!_checkpoint.advance(offset, size, _checkpointData + offset)) {
+        DPRINTF(("Burn checkpoint stopped at offset 0x%x\n", offset));
+        _checkpointData = NULL;
+    }
+}
+
+void FwCompsMgr::startCheckpoint(unsigned compPos, FwComponent& comp, bool resumed)
+{
+    _checkpointData = NULL;
+    if (!_checkpoint.isEnabled()) {
+        return;
+    }
+    if (!resumed) {
+        _checkpoint.start(_updateHandle, _deviceType, _deviceIndex, compPos, _componentIndex, comp.getSize());
+    }
+    _checkpointData = comp.getData().data();
+}
+
+/*
+ * Continue a download left in DOWNLOAD state by a previous run: the FW must still hold the
+ * checkpoint's update handle and the data sent so far must match the component being burned.
+ */
+bool FwCompsMgr::resumeFromCheckpoint(std::vector<FwComponent>& comps,
+                                      unsigned& compPos,
+                                      u_int32_t& offset)
+{
+    if (!_checkpoint.load()) {
+        return false;
+    }
+    burn_checkpoint_t& ckpt = _checkpoint.data();
+    bool heldByCheckpoint = controlFsm(FSM_QUERY) && _lastFsmCtrl.control_state != FSMST_IDLE &&
+                            (_lastFsmCtrl.update_handle & 0xffffff) == ckpt.update_handle;
+    bool match = heldByCheckpoint && _lastFsmCtrl.control_state == FSMST_DOWNLOAD &&
+                 ckpt.device_type == _deviceType && ckpt.device_index == _deviceIndex &&
+                 ckpt.comp_pos < comps.size() && ckpt.offset && (ckpt.offset % 4) == 0;
+    if (match) {
+        FwComponent& comp = comps[ckpt.comp_pos];
+        comp_query_st& compQuery = _compsQueryMap[comp.getType()];
+        match = compQuery.valid && compQuery.comp_status.component_index == ckpt.component_index &&
+                comp.getSize() == ckpt.component_size && ckpt.offset < ckpt.component_size &&
+                BurnCheckpoint::hashData(BURN_CHECKPOINT_HASH_INIT, comp.getData().data(), ckpt.offset) == ckpt.hash;
+    }
+    if (!match) {
+        DPRINTF(("Burn checkpoint does not match the device state, starting from scratch\n"));
+        if (heldByCheckpoint) {
+            // the handle a previous run kept for this checkpoint won't be resumed, give it back
+            _updateHandle = ckpt.update_handle;
+            controlFsm(FSM_CMD_CANCEL, FSMST_LOCKED);
+            controlFsm(FSM_CMD_RELEASE_UPDATE_HANDLE, FSMST_IDLE);
+            GenerateHandle();
+        }
+        _checkpoint.remove();
+        return false;
+    }
+    _updateHandle = ckpt.update_handle;
+    compPos = ckpt.comp_pos;
+    offset = ckpt.offset;
+    printf("Resuming %s component download from offset 0x%x.\n",
+           FwComponent::getCompIdStr(comps[compPos].getType()), offset);
+    return true;
+}
+
+/*
+ * After a transport error, continue the download from the last acknowledged offset once the FSM
+ * answers again. Only when it stays unreachable (and can't be released anyway) the handle and the
+ * checkpoint are kept for the next run.
+ */
+bool FwCompsMgr::resumeAfterTransportError(FwComponent& comp, ProgressCallBackAdvSt *progressFuncAdv)
+{
+    for (int attempt = 0; attempt < BURN_CHECKPOINT_MAX_RESUMES; attempt++) {
+        if (!_checkpointData || !_checkpoint.data().offset || !isTransportError(_lastRegAccessStatus)) {
+            return false;
+        }
+        msleep(1000);
+        if (!controlFsm(FSM_QUERY)) {
+            if (isTransportError(_lastRegAccessStatus) && _checkpoint.save()) {
+                _keepHandleForResume = true;
+            }
+            return false;
+        }
+        if (_lastFsmCtrl.control_state != FSMST_DOWNLOAD ||
+            (_lastFsmCtrl.update_handle & 0xffffff) != _updateHandle) {
+            return false;
+        }
+        u_int32_t offset = _checkpoint.data().offset;
+        printf("Resuming %s component download from offset 0x%x.\n", _currComponentStr, offset);
+        if (accessComponent(offset, comp.getSize() - offset, (u_int32_t *)(comp.getData().data() + offset),
+                            MCDA_WRITE_COMP, progressFuncAdv)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/*
+ * FW can't read a component back while it is in DOWNLOAD state, so a resumed download is checked
+ * by the FW verification: if that fails the component is downloaded again from offset 0.
+ */
+bool FwCompsMgr::redownloadComponent(FwComponent& comp, ProgressCallBackAdvSt *progressFuncAdv)
+{
+    printf("Verifying the resumed %s component has failed, downloading it again.\n", _currComponentStr);
+    if (!controlFsm(FSM_CMD_CANCEL, FSMST_LOCKED)) {
+        DPRINTF(("Cancel instruction to FW component has failed!\n"));
+        return false;
+    }
+    if (!controlFsm(FSM_CMD_UPDATE_COMPONENT, FSMST_DOWNLOAD, comp.getSize(), FSMST_INITIALIZE, progressFuncAdv)) {
+        DPRINTF(("Initializing downloading FW component has failed!\n"));
+        return false;
+    }
+    if (!accessComponent(0, comp.getSize(), (u_int32_t *)(comp.getData().data()), MCDA_WRITE_COMP, progressFuncAdv)) {
+        DPRINTF(("Downloading FW component has failed!\n"));
+        return false;
+    }
+    return controlFsm(FSM_CMD_VERIFY_COMPONENT, FSMST_LOCKED, 0, FSMST_NA, progressFuncAdv);
+}
+
 bool FwCompsMgr::burnComponents(std::vector<FwComponent>& comps,
                                 ProgressCallBackAdvSt *progressFuncAdv)
 {
     unsigned i = 0;
+    unsigned resumeComp = 0;
+    u_int32_t resumeOffset = 0;
     if (!RefreshComponentsStatus()) {
         return false;
     }
-    if (!controlFsm(FSM_CMD_LOCK_UPDATE_HANDLE, FSMST_LOCKED)) {
+    bool resumed = _downloadTransferNeeded && resumeFromCheckpoint(comps, resumeComp, resumeOffset);
+    if (!resumed && !controlFsm(FSM_CMD_LOCK_UPDATE_HANDLE, FSMST_LOCKED)) {
         DPRINTF(("Cannot lock the handle!\n"));
         if (forceRelease() == false) {
             printf("FSM is locked.\n");
@@ -1377,7 +1530,7 @@ bool FwCompsMgr::burnComponents(std::vector<FwComponent>& comps,
         return false;
     }
     if (_downloadTransferNeeded == true) {
-        for (i = 0; i < comps.size(); i++) {
+        for (i = resumeComp; i < comps.size(); i++) {
             int component = comps[i].getType();
             _currCompQuery = &(_compsQueryMap[component]);
             if (!_currCompQuery->valid) {
@@ -1386,18 +1539,24 @@ bool FwCompsMgr::burnComponents(std::vector<FwComponent>& comps,
                 return false;
             }
             _componentIndex = _currCompQuery->comp_status.component_index;
-            if (!controlFsm(FSM_CMD_UPDATE_COMPONENT, FSMST_DOWNLOAD, comps[i].getSize(), FSMST_INITIALIZE, progressFuncAdv)) {
+            bool resumeDownload = resumed && i == resumeComp;
+            u_int32_t startOffset = resumeDownload ? resumeOffset : 0;
+            if (!resumeDownload &&
+                !controlFsm(FSM_CMD_UPDATE_COMPONENT, FSMST_DOWNLOAD, comps[i].getSize(), FSMST_INITIALIZE, progressFuncAdv)) {
                 DPRINTF(("Initializing downloading FW component has failed!\n"));
                 return false;
             }
             _currComponentStr = FwComponent::getCompIdStr(comps[i].getType());
-            if (!accessComponent(0, comps[i].getSize(), (u_int32_t *)(comps[i].getData().data()), MCDA_WRITE_COMP, progressFuncAdv)) {
+            startCheckpoint(i, comps[i], resumeDownload);
+            if (!accessComponent(startOffset, comps[i].getSize() - startOffset,
+                                 (u_int32_t *)(comps[i].getData().data() + startOffset), MCDA_WRITE_COMP, progressFuncAdv)) {
                 bool bRes = false;
                 if (isDMAAccess()) {
                     printf("Burning with DMA has failed, switching to Direct Access burn.\n");
                     bRes = fallbackToDirectAccess();
                     
                     if (bRes) {
+                        startCheckpoint(i, comps[i], false);
                         if (!controlFsm(FSM_CMD_CANCEL, FSMST_LOCKED)) {
                             DPRINTF(("Cancel instruction to FW component has failed!\n"));
                             return false;
@@ -1410,12 +1569,20 @@ bool FwCompsMgr::burnComponents(std::vector<FwComponent>& comps,
                         bRes = accessComponent(0, comps[i].getSize(), (u_int32_t *)(comps[i].getData().data()), MCDA_WRITE_COMP, progressFuncAdv);
                     }
                 }
+                if (!bRes) {
+                    bRes = resumeAfterTransportError(comps[i], progressFuncAdv);
+                    resumeDownload = resumeDownload || bRes;
+                }
                 if (!bRes) {
                     DPRINTF(("Downloading FW component has failed!\n"));
+                    _checkpointData = NULL;
                     return false;
                 }
             }
-            if (!controlFsm(FSM_CMD_VERIFY_COMPONENT, FSMST_LOCKED, 0, FSMST_NA, progressFuncAdv)) {
+            _checkpointData = NULL;
+            _checkpoint.remove();
+            if (!controlFsm(FSM_CMD_VERIFY_COMPONENT, FSMST_LOCKED, 0, FSMST_NA, progressFuncAdv) &&
+                (!resumeDownload || !redownloadComponent(comps[i], progressFuncAdv))) {
                 DPRINTF(("Verifying FW component has failed!\n"));
                 return false;
             }
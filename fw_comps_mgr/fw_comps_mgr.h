@@ -44,6 +44,7 @@
 #include "reg_access/reg_access.h"
 #include "mlxfwops/uefi_c/mft_uefi_common.h"
 #include "mlxfwops/lib/mlxfwops_com.h"
+#include "fw_comps_mgr_checkpoint.h"
 #ifndef UEFI_BUILD
 #include "tools_res_mgmt/tools_res_mgmt.h"
 #endif
@@ -387,6 +388,9 @@ public:
     bool GetComponentLinkxProperties(FwComponent::comps_ids_t compType, component_linkx_st *cmpLinkX);
     void GenerateHandle();
     bool isMCDDSupported() { return isDmaSupported; };
+    // called by the access objects for every chunk FW acknowledged during a component download
+    void updateBurnCheckpoint(u_int32_t offset, u_int32_t size);
+    const comp_cap_st* getCurrCompCap() { return _currCompQuery ? &(_currCompQuery->comp_cap) : (const comp_cap_st*)NULL; };
 private:
 
     typedef enum {
@@ -500,6 +504,12 @@ private:
     void           extractRomInfo(mgirReg *mgir, fwInfoT *fwQuery);
     bool           isDMAAccess();
     bool           fallbackToDirectAccess();
+    bool           resumeFromCheckpoint(std::vector<FwComponent>& comps,
+                                        unsigned& compPos,
+                                        u_int32_t& offset);
+    void           startCheckpoint(unsigned compPos, FwComponent& comp, bool resumed);
+    bool           resumeAfterTransportError(FwComponent& comp, ProgressCallBackAdvSt *progressFuncAdv);
+    bool           redownloadComponent(FwComponent& comp, ProgressCallBackAdvSt *progressFuncAdv);
     
     std::vector<comp_query_st> _compsQueryMap;
     bool _refreshed;
@@ -521,6 +531,9 @@ private:
     std::vector<u_int8_t> _productVerStr;
     bool isDmaSupported;
     AbstractComponentAccess* _accessObj;
+    BurnCheckpoint _checkpoint;
+    const u_int8_t *_checkpointData;
+    bool _keepHandleForResume;
     int _linkXDeviceSize;
     int _linkXDeviceIndex;
     bool _autoUpdate;
@@ -65,7 +65,14 @@ AbstractComponentAccess* ComponentAccessFactory::createDataAccessObject(FwCompsM
 #endif
 
     if (isMCDDRegisterSupported && isBmeSet){
-        DMAComponentAccess* dmaComponentAccess = new DMAComponentAccess(Manager, Mf);
+        u_int32_t queueDepth = DMA_DEFAULT_QUEUE_DEPTH;
+#ifndef UEFI_BUILD
+        const char *queueDepthStr = getenv(DMA_QUEUE_DEPTH_ENV);
+        if (queueDepthStr != NULL) {
+            queueDepth = strtoul(queueDepthStr, NULL, 0);
+        }
+#endif
+        DMAComponentAccess* dmaComponentAccess = new DMAComponentAccess(Manager, Mf, queueDepth);
         if (dmaComponentAccess->allocateMemory()) {
             return dmaComponentAccess;
         }
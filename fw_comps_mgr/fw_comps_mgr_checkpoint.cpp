@@ -0,0 +1,264 @@
+/*
+ * Copyright (C) Jan 2013 Mellanox Technologies Ltd. All rights reserved.
+ *
+ * This software is available to you under a choice of one of two
+ * licenses.  You may choose to be licensed under the terms of the GNU
+ * General Public License (GPL) Version 2, available from the file
+ * COPYING in the main directory of this source tree, or the
+ * OpenIB.org BSD license below:
+ *
+ *     Redistribution and use in source and binary forms, with or
+ *     without modification, are permitted provided that the following
+ *     conditions are met:
+ *
+ *      - Redistributions of source code must retain the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer.
+ *
+ *      - Redistributions in binary form must reproduce the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer in the documentation and/or other materials
+ *        provided with the distribution.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+/*
+ * fw_comps_mgr_checkpoint.cpp
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#if !defined(UEFI_BUILD) && !defined(__WIN__)
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+#include "fw_comps_mgr_checkpoint.h"
+
+#ifndef UEFI_BUILD
+#define BURN_CHECKPOINT_PREFIX "mft_burn_ckpt_"
+
+#ifdef __WIN__
+static std::string getCheckpointDir()
+{
+    const char *dir = getenv("TEMP");
+    return (dir && *dir) ? dir : ".";
+}
+#else
+#define BURN_CHECKPOINT_DIR "/var/tmp/mft_burn_ckpt"
+
+// the checkpoint decides where a burn continues, only a private dir of ours is used
+static std::string getCheckpointDir()
+{
+    struct stat st;
+    mkdir(BURN_CHECKPOINT_DIR, 0700);
+    if (lstat(BURN_CHECKPOINT_DIR, &st) || !S_ISDIR(st.st_mode) || st.st_uid != geteuid() ||
+        (st.st_mode & (S_IRWXG | S_IRWXO))) {
+        return "";
+    }
+    return BURN_CHECKPOINT_DIR;
+}
+#endif
+#endif
+
+bool BurnCheckpoint::init(mfile *mf)
+{
+    _enabled = false;
+#ifndef UEFI_BUILD
+    if (!getenv("ENABLE_BURN_CHECKPOINT") || !mf || !mf->dev_name || !mf->dev_name[0]) {
+        return false;
+    }
+    std::string dir = getCheckpointDir();
+    if (dir.empty()) {
+        return false;
+    }
+    // one checkpoint per device, keep only characters that are safe in a file name
+    std::string devName = mf->dev_name;
+    for (size_t i = 0; i < devName.size(); i++) {
+        char c = devName[i];
+        if (!((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '.' || c == '-')) {
+            devName[i] = '_';
+        }
+    }
+    _path = dir + "/" + BURN_CHECKPOINT_PREFIX + devName;
+    _enabled = true;
+#else
+    (void)mf;
+#endif
+    return _enabled;
+}
+
+u_int64_t BurnCheckpoint::hashData(u_int64_t hash, const u_int8_t *data, u_int32_t size)
+{
+    // FNV-1a
+    for (u_int32_t i = 0; i < size; i++) {
+        hash ^= data[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+void BurnCheckpoint::start(u_int32_t updateHandle, u_int32_t deviceType, u_int32_t deviceIndex, u_int32_t compPos,
+                           u_int32_t componentIndex, u_int32_t componentSize)
+{
+    _data.update_handle = updateHandle;
+    _data.device_type = deviceType;
+    _data.device_index = deviceIndex;
+    _data.comp_pos = compPos;
+    _data.component_index = componentIndex;
+    _data.component_size = componentSize;
+    _data.offset = 0;
+    _data.hash = BURN_CHECKPOINT_HASH_INIT;
+    _lastSavedOffset = 0;
+}
+
+bool BurnCheckpoint::advance(u_int32_t offset, u_int32_t size, const u_int8_t *data)
+{
+    if (offset != _data.offset || size > _data.component_size - offset) {
+        // acknowledged data must be contiguous, otherwise the hash is meaningless
+        return false;
+    }
+    _data.hash = hashData(_data.hash, data, size);
+    _data.offset += size;
+    if (_data.offset - _lastSavedOffset >= BURN_CHECKPOINT_SAVE_INTERVAL) {
+        return save();
+    }
+    return true;
+}
+
+bool BurnCheckpoint::save()
+{
+#ifndef UEFI_BUILD
+    if (!_enabled) {
+        return false;
+    }
+    // write a temporary file and rename it so an interruption never leaves a truncated checkpoint
+#ifndef __WIN__
+    std::string tmpPath = _path + ".XXXXXX";
+    int fd = mkstemp(&tmpPath[0]);
+    FILE *fp = fd < 0 ? NULL : fdopen(fd, "w");
+    if (!fp) {
+        if (fd >= 0) {
+            close(fd);
+            ::remove(tmpPath.c_str());
+        }
+        return false;
+    }
+#else
+    std::string tmpPath = _path + ".tmp";
+    FILE *fp = fopen(tmpPath.c_str(), "w");
+    if (!fp) {
+        return false;
+    }
+#endif
+    fprintf(fp, "version=%d\n", BURN_CHECKPOINT_VERSION);
+    fprintf(fp, "update_handle=0x%x\n", _data.update_handle);
+    fprintf(fp, "device_type=0x%x\n", _data.device_type);
+    fprintf(fp, "device_index=0x%x\n", _data.device_index);
+    fprintf(fp, "comp_pos=0x%x\n", _data.comp_pos);
+    fprintf(fp, "component_index=0x%x\n", _data.component_index);
+    fprintf(fp, "component_size=0x%x\n", _data.component_size);
+    fprintf(fp, "offset=0x%x\n", _data.offset);
+    fprintf(fp, "hash=0x%llx\n", (unsigned long long)_data.hash);
+    if (fclose(fp) || rename(tmpPath.c_str(), _path.c_str())) {
+        ::remove(tmpPath.c_str());
+        return false;
+    }
+    _lastSavedOffset = _data.offset;
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool BurnCheckpoint::load()
+{
+#ifndef UEFI_BUILD
+    if (!_enabled) {
+        return false;
+    }
+#ifndef __WIN__
+    struct stat st;
+    int fd = open(_path.c_str(), O_RDONLY | O_NOFOLLOW);
+    if (fd < 0) {
+        return false;
+    }
+    if (fstat(fd, &st) || !S_ISREG(st.st_mode) || st.st_uid != geteuid()) {
+        close(fd);
+        return false;
+    }
+    FILE *fp = fdopen(fd, "r");
+    if (!fp) {
+        close(fd);
+        return false;
+    }
+#else
+    FILE *fp = fopen(_path.c_str(), "r");
+    if (!fp) {
+        return false;
+    }
+#endif
+    burn_checkpoint_t ckpt;
+    memset(&ckpt, 0, sizeof(ckpt));
+    unsigned int version = 0;
+    unsigned int foundFields = 0;
+    char line[128];
+    while (fgets(line, sizeof(line), fp)) {
+        char *sep = strchr(line, '=');
+        if (!sep) {
+            continue;
+        }
+        *sep = '\0';
+        unsigned long long val = strtoull(sep + 1, NULL, 0);
+        if (!strcmp(line, "version")) {
+            version = (unsigned int)val;
+        } else if (!strcmp(line, "update_handle")) {
+            ckpt.update_handle = (u_int32_t)val;
+        } else if (!strcmp(line, "device_type")) {
+            ckpt.device_type = (u_int32_t)val;
+        } else if (!strcmp(line, "device_index")) {
+            ckpt.device_index = (u_int32_t)val;
+        } else if (!strcmp(line, "comp_pos")) {
+            ckpt.comp_pos = (u_int32_t)val;
+        } else if (!strcmp(line, "component_index")) {
+            ckpt.component_index = (u_int32_t)val;
+        } else if (!strcmp(line, "component_size")) {
+            ckpt.component_size = (u_int32_t)val;
+        } else if (!strcmp(line, "offset")) {
+            ckpt.offset = (u_int32_t)val;
+        } else if (!strcmp(line, "hash")) {
+            ckpt.hash = (u_int64_t)val;
+        } else {
+            continue;
+        }
+        foundFields++;
+    }
+    fclose(fp);
+    if (version != BURN_CHECKPOINT_VERSION || foundFields != 9) {
+        return false;
+    }
+    _data = ckpt;
+    _lastSavedOffset = ckpt.offset;
+    return true;
+#else
+    return false;
+#endif
+}
+
+void BurnCheckpoint::remove()
+{
+#ifndef UEFI_BUILD
+    if (_enabled) {
+        ::remove(_path.c_str());
+    }
+#endif
+}
@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) Jan 2013 Mellanox Technologies Ltd. All rights reserved.
+ *
+ * This software is available to you under a choice of one of two
+ * licenses.  You may choose to be licensed under the terms of the GNU
+ * General Public License (GPL) Version 2, available from the file
+ * COPYING in the main directory of this source tree, or the
+ * OpenIB.org BSD license below:
+ *
+ *     Redistribution and use in source and binary forms, with or
+ *     without modification, are permitted provided that the following
+ *     conditions are met:
+ *
+ *      - Redistributions of source code must retain the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer.
+ *
+ *      - Redistributions in binary form must reproduce the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer in the documentation and/or other materials
+ *        provided with the distribution.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+/*
+ * fw_comps_mgr_checkpoint.h
+ *
+ * Persists the progress of an MCDA/MCDD component download so that an
+ * interrupted burn can continue from the last acknowledged offset as long
+ * as the FW still holds the same update handle in DOWNLOAD state.
+ * Opt-in with ENABLE_BURN_CHECKPOINT, the files live in a 0700 directory
+ * owned by the effective user (/var/tmp/mft_burn_ckpt).
+ */
+
+#ifndef USER_MLXFWOPS_LIB_FW_COMPS_MGR_CHECKPOINT_H_
+#define USER_MLXFWOPS_LIB_FW_COMPS_MGR_CHECKPOINT_H_
+
+#include <string>
+#include <string.h>
+#include <mtcr.h>
+
+#define BURN_CHECKPOINT_VERSION 1
+// how much acknowledged data is sent between two writes of the checkpoint file
+#define BURN_CHECKPOINT_SAVE_INTERVAL (1024 * 1024)
+#define BURN_CHECKPOINT_HASH_INIT 0xcbf29ce484222325ULL
+// in-process resumes of one component after transport errors before giving up
+#define BURN_CHECKPOINT_MAX_RESUMES 3
+
+typedef struct {
+    u_int32_t update_handle;
+    u_int32_t device_type;
+    u_int32_t device_index;
+    u_int32_t comp_pos;         // position of the component in the burned components list
+    u_int32_t component_index;
+    u_int32_t component_size;
+    u_int32_t offset;           // data up to this offset was acknowledged by FW
+    u_int64_t hash;             // running hash of the data up to offset
+} burn_checkpoint_t;
+
+class BurnCheckpoint
+{
+public:
+    BurnCheckpoint() : _enabled(false), _lastSavedOffset(0) { memset(&_data, 0, sizeof(_data)); }
+    ~BurnCheckpoint() {}
+
+    // returns false unless ENABLE_BURN_CHECKPOINT is set and the device and checkpoint dir are usable
+    bool init(mfile *mf);
+    bool isEnabled() { return _enabled; }
+
+    // on success data() holds the stored checkpoint and tracking continues from its offset
+    bool load();
+    bool save();
+    void remove();
+
+    // start tracking a new component download from offset 0
+    void start(u_int32_t updateHandle, u_int32_t deviceType, u_int32_t deviceIndex, u_int32_t compPos,
+               u_int32_t componentIndex, u_int32_t componentSize);
+    // account for size acknowledged bytes (data points at offset), saves the file every BURN_CHECKPOINT_SAVE_INTERVAL
+    bool advance(u_int32_t offset, u_int32_t size, const u_int8_t *data);
+
+    burn_checkpoint_t& data() { return _data; }
+
+    static u_int64_t hashData(u_int64_t hash, const u_int8_t *data, u_int32_t size);
+
+private:
+    bool _enabled;
+    std::string _path;
+    burn_checkpoint_t _data;
+    u_int32_t _lastSavedOffset;
+};
+
+#endif /* USER_MLXFWOPS_LIB_FW_COMPS_MGR_CHECKPOINT_H_ */
@@ -51,6 +51,43 @@ static void mft_signal_set_handling(int isOn)
 
 typedef struct reg_access_hca_mcda_reg mcdaReg;
 
+#define MCDA_MAX_CHUNK_SIZE 0xfffc
+
+/*
+ * Largest MCDA data section that fits a single register access.
+ * mget_max_reg_size already accounts for GMP (large inband MADs), ICMD and tools HCR,
+ * writes are further limited by the component's mcda_max_write_size as reported by MCQI.
+ */
+u_int32_t DirectComponentAccess::getMaxChunkSize(access_type_t access)
+{
+    maccess_reg_method_t method = (access == MCDA_READ_COMP) ? MACCESS_REG_METHOD_GET : MACCESS_REG_METHOD_SET;
+    int maxRegSize = mget_max_reg_size(_mf, method);
+    u_int32_t chunkSize = maxRegSize > MCDA_REG_HEADER ? maxRegSize - MCDA_REG_HEADER : 4;
+    if (chunkSize > MCDA_MAX_CHUNK_SIZE) {
+        chunkSize = MCDA_MAX_CHUNK_SIZE;
+    }
+    // without a size advertised by FW keep the register's native data size
+    u_int32_t fwMaxSize = MAX_REG_DATA;
+    u_int32_t wordSize = 4;
+    const comp_cap_st *compCap = _manager->getCurrCompCap();
+    if (compCap) {
+        if (access != MCDA_READ_COMP && compCap->mcda_max_write_size) {
+            fwMaxSize = compCap->mcda_max_write_size;
+        }
+        if (compCap->log_mcda_word_size > 2 && compCap->log_mcda_word_size < 16) {
+            wordSize = 1 << compCap->log_mcda_word_size;
+        }
+    }
+    if (chunkSize > fwMaxSize) {
+        chunkSize = fwMaxSize;
+    }
+    if (chunkSize >= wordSize) {
+        chunkSize -= chunkSize % wordSize;
+    }
+    chunkSize &= ~0x3;
+    return chunkSize ? chunkSize : 4;
+}
+
 bool DirectComponentAccess::accessComponent(u_int32_t updateHandle, u_int32_t offset,
     u_int32_t size,
     u_int32_t* data,
@@ -67,26 +104,19 @@ bool DirectComponentAccess::accessComponent(u_int32_t updateHandle, u_int32_t of
     if (progressFuncAdv && progressFuncAdv->func) {
         snprintf(stage, MAX_MSG_SIZE, "%s %s component", (access == MCDA_READ_COMP) ? "Reading" : "Writing", currComponentStr);
     }
-    int maxDataSize = mget_max_reg_size(_mf, (access == MCDA_READ_COMP) ? MACCESS_REG_METHOD_GET : MACCESS_REG_METHOD_SET)
-        - sizeof(accessData);
-    if (maxDataSize > MAX_REG_DATA) {
-            maxDataSize = MAX_REG_DATA;
-    }
-    if (_mf->flags & MDEVS_IB && _mf->tp == MST_IB && maxDataSize > INBAND_MAX_REG_SIZE) {
-        maxDataSize = INBAND_MAX_REG_SIZE - MCDA_REG_HEADER;
-    }
-    std::vector<u_int32_t> dataToRW(maxDataSize, 0);
+    int maxDataSize = (int)getMaxChunkSize(access);
+    DPRINTF(("MCDA chunk size: 0x%x\n", maxDataSize));
+    std::vector<u_int32_t> dataToRW(maxDataSize / 4, 0);
     while (leftSize > 0)    {
         memset(&accessData, 0, sizeof(mcdaReg));
 
-        memcpy(accessData.data, dataToRW.data(), sizeof(accessData.data));
         accessData.update_handle = updateHandle;
         accessData.offset = offset + (size - leftSize);
         accessData.size = leftSize > maxDataSize ? maxDataSize : leftSize;
         mft_signal_set_handling(1);
 
         if (access == MCDA_READ_COMP) {
-            reg_access_status_t rc = reg_access_mcda(_mf, REG_ACCESS_METHOD_GET, &accessData);
+            reg_access_status_t rc = reg_access_mcda_var(_mf, REG_ACCESS_METHOD_GET, &accessData, dataToRW.data());
             _manager->deal_with_signal();
             if (rc) {
                 setLastFwError(_manager->regErrTrans(rc));
@@ -94,21 +124,21 @@ bool DirectComponentAccess::accessComponent(u_int32_t updateHandle, u_int32_t of
                 return false;
             }
             for (i = 0; i < accessData.size / 4; i++) {
-                data[(size - leftSize) / 4 + i] = __le32_to_cpu(accessData.data[i]);
+                data[(size - leftSize) / 4 + i] = __le32_to_cpu(dataToRW[i]);
             }
-            //printf("data[%#02x]: %#08x\n", (i-1)*4, data[(size - leftSize)/4 + i-1]);
         }
         else {
             for (i = 0; i < accessData.size / 4; i++) {
-                accessData.data[i] = __cpu_to_le32(data[(size - leftSize) / 4 + i]);
+                dataToRW[i] = __cpu_to_le32(data[(size - leftSize) / 4 + i]);
             }
-            reg_access_status_t rc = reg_access_mcda(_mf, REG_ACCESS_METHOD_SET, &accessData);
+            reg_access_status_t rc = reg_access_mcda_var(_mf, REG_ACCESS_METHOD_SET, &accessData, dataToRW.data());
             _manager->deal_with_signal();
             if (rc) {
                 setLastFwError(_manager->regErrTrans(rc));
                 _lastRegisterAccessStatus = rc;
                 return false;
             }
+            _manager->updateBurnCheckpoint(accessData.offset, accessData.size);
         }
         int newPercentage = (((size - leftSize) * 100) / size);
 #ifdef UEFI_BUILD
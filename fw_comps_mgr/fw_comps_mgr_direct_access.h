@@ -60,5 +60,6 @@ public:
 
     private:
         void setLastFwError(fw_comps_error_t error) {_lastFwError = error;}
+        u_int32_t getMaxChunkSize(access_type_t access);
 };
 #endif
@@ -38,6 +38,8 @@
  */
 
 #include <math.h>
+#include <string.h>
+#include <time.h>
 #include "fw_comps_mgr_dma_access.h"
 #include "bit_slice.h"
 
@@ -98,77 +100,150 @@ void printData(u_int32_t* data, int data_size, int format)
 }
 #endif
 
-bool DMAComponentAccess::prepareParameters(u_int32_t updateHandle, mcddReg* accessData,
-    int offset, u_int32_t* data, int data_size, int access, int leftSize,
-     mtcr_page_addresses page,  mtcr_page_addresses mailbox_page)
+DMAComponentAccess::DMAComponentAccess(FwCompsMgr* Manager, mfile * Mf, u_int32_t queueDepth) :
+    AbstractComponentAccess(Manager, Mf), _queueDepth(queueDepth), _lastFwError(FWCOMPS_SUCCESS),
+    _lastRegisterAccessStatus(ME_OK)
+{
+    if (_queueDepth < DMA_MIN_QUEUE_DEPTH) {
+        _queueDepth = DMA_MIN_QUEUE_DEPTH;
+    } else if (_queueDepth > DMA_MAX_QUEUE_DEPTH) {
+        _queueDepth = DMA_MAX_QUEUE_DEPTH;
+    }
+}
+
+void DMAComponentAccess::prepareParameters(u_int32_t updateHandle, mcddReg* accessData, u_int32_t offset,
+    u_int32_t size, mtcr_page_addresses page, mtcr_page_addresses mailbox_page)
 {
     accessData->update_handle = updateHandle;
     accessData->offset = offset;
-    accessData->size = leftSize > PAGE_SIZE ? PAGE_SIZE : leftSize;
+    accessData->size = size;
     accessData->data_page_phys_addr_lsb = EXTRACT64(page.dma_address, 0, 32);
     accessData->data_page_phys_addr_msb = EXTRACT64(page.dma_address, 32, 32);
     accessData->mailbox_page_phys_addr_lsb = EXTRACT64(mailbox_page.dma_address, 0, 32);
     accessData->mailbox_page_phys_addr_msb = EXTRACT64(mailbox_page.dma_address, 32, 32);
-    int currentOffset = data_size - leftSize;
-    if (access == MCDA_WRITE_COMP) {
-        u_int32_t* data_ptr = (u_int32_t*)page.virtual_address;
-        for (int i = 0; i < accessData->size / 4; i++) {
-            *data_ptr = ___my_swab32(data[(currentOffset) / 4 + i]);
-            data_ptr++;
-        }
+}
+
+void DMAComponentAccess::writeToDataPage(mtcr_page_addresses page, u_int32_t* data, u_int32_t size)
+{
+    u_int32_t* data_ptr = (u_int32_t*)page.virtual_address;
+    for (u_int32_t i = 0; i < size / 4; i++) {
+        data_ptr[i] = ___my_swab32(data[i]);
     }
-    return true;
 }
 
 bool DMAComponentAccess::allocateMemory()
 {
     mtcr_page_info page_info;
+    u_int32_t pagesAmount = _queueDepth + 1;
 
 #ifndef UEFI_BUILD
-    if (get_dma_pages(_mf, &page_info,
-                      FMPT_ALLOCATED_LIST_LENGTH)) {
-        return false;
+    if (get_dma_pages(_mf, &page_info, pagesAmount)) {
+        // older drivers may not give us a full ring, fall back to the basic double buffering
+        if (pagesAmount == FMPT_ALLOCATED_LIST_LENGTH) {
+            return false;
+        }
+        DPRINTF(("DMAComponentAccess::allocateMemory failed to get %d pages, retrying with %d\n",
+                 pagesAmount, FMPT_ALLOCATED_LIST_LENGTH));
+        _queueDepth = DMA_MIN_QUEUE_DEPTH;
+        pagesAmount = FMPT_ALLOCATED_LIST_LENGTH;
+        if (get_dma_pages(_mf, &page_info, pagesAmount)) {
+            return false;
+        }
     }
 #else
     return false;
 #endif
 
-    for (int page_counter = 0;
-            page_counter < FMPT_ALLOCATED_LIST_LENGTH;
+    for (u_int32_t page_counter = 0;
+            page_counter < pagesAmount;
             page_counter++) {
 
 #if _MCDD_DEBUG_
         u_int32_t va_lsb =
-            EXTRACT64(page_info.page_addresses_array[page_counter]->virtual_address, 0, 32);
+            EXTRACT64(page_info.page_addresses_array[page_counter].virtual_address, 0, 32);
         u_int32_t va_msb =
-            EXTRACT64(page_info.page_addresses_array[page_counter]->virtual_address, 32, 32);
-        u_int32_t pa_lsb = 
-            EXTRACT64(page_info.page_addresses_array[page_counter]->dma_address, 0, 32);
-        u_int32_t pa_msb = 
-            EXTRACT64(page_info.page_addresses_array[page_counter]->dma_address, 32, 32);
+            EXTRACT64(page_info.page_addresses_array[page_counter].virtual_address, 32, 32);
+        u_int32_t pa_lsb =
+            EXTRACT64(page_info.page_addresses_array[page_counter].dma_address, 0, 32);
+        u_int32_t pa_msb =
+            EXTRACT64(page_info.page_addresses_array[page_counter].dma_address, 32, 32);
 
-        DPRINTF(("Allocated for page %d data PA 0x%08x%08x VA 0x%08x%08x \r\n", i, pa_msb, pa_lsb, va_msb, va_lsb));
+        DPRINTF(("Allocated for page %d data PA 0x%08x%08x VA 0x%08x%08x \r\n", page_counter, pa_msb, pa_lsb, va_msb, va_lsb));
 #endif
         _allocatedListVect.push_back(page_info.page_addresses_array[page_counter]);
     }
+    DPRINTF(("DMAComponentAccess::allocateMemory queue depth %d\n", _queueDepth));
     return true;
 }
 
-bool DMAComponentAccess::readFromDataPage(mcddReg* accessData,  mtcr_page_addresses page, u_int32_t* data, int data_size, int leftSize)
+void DMAComponentAccess::readFromDataPage(mtcr_page_addresses page, u_int32_t* data, u_int32_t size)
 {
     u_int32_t* data_ptr = (u_int32_t*)page.virtual_address;
-    int currentOffset = (data_size - leftSize) / 4;
-    for (int i = 0; i < accessData->size / 4; i++) {
-        data[currentOffset + i] = ___my_swab32(*data_ptr);
-        data_ptr++;
-#if _MCDD_DEBUG_ 
+    for (u_int32_t i = 0; i < size / 4; i++) {
+        data[i] = ___my_swab32(data_ptr[i]);
+#if _MCDD_DEBUG_
         if (i % 100 == 0)
-            DPRINTF(("\nReading data[%#02x]: %#08x\n", (i) * 4, data[(data_size - leftSize) / 4 + i]));
+            DPRINTF(("\nReading data[%#02x]: %#08x\n", (i) * 4, data[i]));
 #endif
     }
+}
+
+bool DMAComponentAccess::waitForFirmware(mtcr_page_addresses mailbox_page)
+{
+    tools_open_mcdd_descriptor mailbox;
+    int nMaximumSleepTime = 0;
+
+    // This is because the FW will change the status from 0 to BUSY, when it starts the reading/writing operation.
+    // meanwhile, the SW has to wait until FW is really starting.
+    // It's possible, though, that we will not enter to this loop at all or only sometimes.
+    tools_open_mcdd_descriptor_unpack(&mailbox, (const u_int8_t*)mailbox_page.virtual_address);
+    DPRINTF(("AccessComponent1 status %d err %d reserved3 %d\n", mailbox.status, mailbox.error, mailbox.reserved3));
+    while (mailbox.status == FFS_FW_UNKNOWN) {
+        msleep(TIMETOSLEEP);
+        tools_open_mcdd_descriptor_unpack(&mailbox, (const u_int8_t*)mailbox_page.virtual_address);
+        nMaximumSleepTime += TIMETOSLEEP;
+        if (nMaximumSleepTime >= MAXIMUM_SLEEP_TIME_MS) {
+            setLastError(FWCOMPS_ABORTED);
+            return false;
+        }
+    }
+
+    // here the FW started to work
+    msleep(TIMETOSLEEP);
+    tools_open_mcdd_descriptor_unpack(&mailbox, (const u_int8_t*)mailbox_page.virtual_address);
+    DPRINTF(("AccessComponent2 status %d err %d reserved3 %d\n", mailbox.status, mailbox.error, mailbox.reserved3));
+
+    nMaximumSleepTime = 0;
+    while (mailbox.status == FFS_FW_BUSY) {
+        msleep(TIMETOSLEEP);
+        tools_open_mcdd_descriptor_unpack(&mailbox, (const u_int8_t*)mailbox_page.virtual_address);
+        nMaximumSleepTime += TIMETOSLEEP;
+        if (nMaximumSleepTime >= MAXIMUM_SLEEP_TIME_MS) {
+            setLastError(FWCOMPS_ABORTED);
+            return false;
+        }
+    }
+    tools_open_mcdd_descriptor_unpack(&mailbox, (const u_int8_t*)mailbox_page.virtual_address);
+    DPRINTF(("AccessComponent3 status %d err %d reserved3 %d\n", mailbox.status, mailbox.error, mailbox.reserved3));
+
+    if (mailbox.status == FFS_FW_ERROR) {
+        fw_comps_error_t fw_err = (fw_comps_error_t)(mailbox.error + FWCOMPS_MCC_ERR_CODES);//return error to high level app. Errors are defined as MCC errors
+        setLastError(fw_err);
+        DPRINTF(("CRITICAL : DMAComponentAccess::AccessComponent status %d err %d FW ERROR: %#x\n", mailbox.status, mailbox.error, fw_err));
+        return false;
+    }
     return true;
 }
 
+#if !defined(UEFI_BUILD) && !defined(__WIN__)
+static double getTimeInSec()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+#endif
+
 bool DMAComponentAccess::accessComponent(u_int32_t updateHandle, u_int32_t offset,
     u_int32_t data_size,
     u_int32_t* data,
@@ -180,34 +255,35 @@ bool DMAComponentAccess::accessComponent(u_int32_t updateHandle, u_int32_t offse
     try
     {
 #endif
-        int leftSize = (int)data_size;
-        int CurrentPage = FMPT_FIRST_PAGE;
         char stage[MAX_MSG_SIZE] = { 0 };
         int progressPercentage = -1;
-        int currentOffset = 0;
-        int nMaximumSleepTime = 0;
-        tools_open_mcdd_descriptor mailboxVirtPtr_1;
+        u_int32_t numOfChunks = (data_size + PAGE_SIZE - 1) / PAGE_SIZE;
+        u_int32_t filledChunks = 0; // write: chunks already copied into the ring
+        bool readPending = false;   // read: the previous chunk is done by FW but not yet copied out of the ring
         if (progressFuncAdv && progressFuncAdv->func) {
             snprintf(stage, MAX_MSG_SIZE, "%s %s component", (access == MCDA_READ_COMP) ? "Reading" : "Writing", currComponentStr);
         }
         //updateHandle &= ~0xff000000;
-        DPRINTF(("DMAComponentAccess::AccessComponent BEGIN size %d access %s\n", data_size, (access == MCDA_READ_COMP) ? "READ" : "WRITE"));
+        DPRINTF(("DMAComponentAccess::AccessComponent BEGIN size %d access %s queue depth %d\n", data_size,
+                 (access == MCDA_READ_COMP) ? "READ" : "WRITE", _queueDepth));
         mcddReg accessData;
-        mtcr_page_addresses page = _allocatedListVect[CurrentPage];
-        mtcr_page_addresses mailboxPage = _allocatedListVect[FMPT_MAILBOX_PAGE];
-        //tools_open_mcdd_descriptor* mailboxVirtPtr = (tools_open_mcdd_descriptor*)mailboxPage.va;
-        int maxDataSize = data_size > PAGE_SIZE ? PAGE_SIZE : data_size;
         memset(&accessData, 0, TOOLS_OPEN_MCDD_REG_SIZE);
+#if !defined(UEFI_BUILD) && !defined(__WIN__)
+        double startTime = getTimeInSec();
+#endif
 
         if (access == MCDA_READ_COMP) {
             memset(data , 0, data_size);
         }
-        prepareParameters(updateHandle, &accessData, offset + (data_size - leftSize), data, data_size, access, leftSize, page, mailboxPage);
-        int nIteration = 0;
-        while (leftSize > 0) {
-            memset((u_int8_t*)mailboxPage.virtual_address, 0, TOOLS_OPEN_MCDD_DESCRIPTOR_SIZE);
-            memset(&mailboxVirtPtr_1, 0, TOOLS_OPEN_MCDD_DESCRIPTOR_SIZE);//set zero before each transaction
-            maxDataSize = leftSize > PAGE_SIZE ? PAGE_SIZE : leftSize;
+        for (u_int32_t chunk = 0; chunk < numOfChunks; chunk++) {
+            u_int32_t chunkOffset = chunk * PAGE_SIZE;
+            u_int32_t chunkSize = (data_size - chunkOffset) > PAGE_SIZE ? PAGE_SIZE : (data_size - chunkOffset);
+            if (access == MCDA_WRITE_COMP && filledChunks == chunk) {
+                writeToDataPage(dataPage(chunk), data + chunkOffset / 4, chunkSize);
+                filledChunks++;
+            }
+            prepareParameters(updateHandle, &accessData, offset + chunkOffset, chunkSize, dataPage(chunk), mailboxPage());
+            memset((u_int8_t*)mailboxPage().virtual_address, 0, TOOLS_OPEN_MCDD_DESCRIPTOR_SIZE);
             mft_signal_set_handling(1);
 
             reg_access_status_t rc = reg_access_mcdd(_mf, (access == MCDA_READ_COMP) ? REG_ACCESS_METHOD_GET : REG_ACCESS_METHOD_SET, &accessData);
@@ -219,77 +295,35 @@ bool DMAComponentAccess::accessComponent(u_int32_t updateHandle, u_int32_t offse
                 return false;
             }
 
-            //if we write a data, meawhile use a time for prepare next data page
+            // while FW consumes the current page, fill the free pages of the ring with the next chunks
+            // (on read, copy out the page FW finished in the previous iteration)
             if (access == MCDA_WRITE_COMP) {
-                leftSize -= maxDataSize;
-                if (leftSize > 0)
-                {
-                    if(FMPT_FIRST_PAGE == CurrentPage)
-                        CurrentPage = FMPT_SECOND_PAGE;
-                    else
-                        CurrentPage = FMPT_FIRST_PAGE;
-
-                    page = _allocatedListVect[CurrentPage];
-                    currentOffset = offset + (data_size - leftSize);
-                    prepareParameters(updateHandle, &accessData, currentOffset, data, data_size, access, leftSize, page, mailboxPage);
+                while (filledChunks < numOfChunks && filledChunks < chunk + _queueDepth) {
+                    u_int32_t nextOffset = filledChunks * PAGE_SIZE;
+                    u_int32_t nextSize = (data_size - nextOffset) > PAGE_SIZE ? PAGE_SIZE : (data_size - nextOffset);
+                    writeToDataPage(dataPage(filledChunks), data + nextOffset / 4, nextSize);
+                    filledChunks++;
                 }
+            } else if (readPending) {
+                readFromDataPage(dataPage(chunk - 1), data + (chunkOffset - PAGE_SIZE) / 4, PAGE_SIZE);
+                readPending = false;
             }
 
-            // This is because the FW will change the status from 0 to BUSY, when it starts the reading/writing operation.
-            // meanwhile, the SW has to wait until FW is really starting.
-            // It's possible, though, that we will not enter to this loop at all or only sometimes.
-            tools_open_mcdd_descriptor_unpack(&mailboxVirtPtr_1, (const u_int8_t*)mailboxPage.virtual_address);
-            DPRINTF(("AccessComponent1 status %d err %d reserved3 %d\n", mailboxVirtPtr_1.status, mailboxVirtPtr_1.error, mailboxVirtPtr_1.reserved3));
-            nMaximumSleepTime = 0;
-            while (mailboxVirtPtr_1.status == FFS_FW_UNKNOWN) {
-                msleep(TIMETOSLEEP);
-                tools_open_mcdd_descriptor_unpack(&mailboxVirtPtr_1, (const u_int8_t*)mailboxPage.virtual_address);
-                nMaximumSleepTime += TIMETOSLEEP;
-                if(nMaximumSleepTime >= MAXIMUM_SLEEP_TIME_MS) {
-                    setLastError(FWCOMPS_ABORTED);
-                    return false;
-                }
-            }
-
-            // here the FW started to work
-            msleep(TIMETOSLEEP);
-            tools_open_mcdd_descriptor_unpack(&mailboxVirtPtr_1, (const u_int8_t*)mailboxPage.virtual_address);
-            DPRINTF(("AccessComponent2 status %d err %d reserved3 %d\n", mailboxVirtPtr_1.status, mailboxVirtPtr_1.error, mailboxVirtPtr_1.reserved3));
-
-            nMaximumSleepTime = 0;
-            while (mailboxVirtPtr_1.status == FFS_FW_BUSY) {
-                msleep(TIMETOSLEEP);
-                tools_open_mcdd_descriptor_unpack(&mailboxVirtPtr_1, (const u_int8_t*)mailboxPage.virtual_address);
-                nMaximumSleepTime += TIMETOSLEEP;
-                if(nMaximumSleepTime >= MAXIMUM_SLEEP_TIME_MS) {
-                    setLastError(FWCOMPS_ABORTED);
-                    return false;
-                }
-            }
-            tools_open_mcdd_descriptor_unpack(&mailboxVirtPtr_1, (const u_int8_t*)mailboxPage.virtual_address);
-            DPRINTF(("AccessComponent3 status %d err %d reserved3 %d\n", mailboxVirtPtr_1.status, mailboxVirtPtr_1.error, mailboxVirtPtr_1.reserved3));
-
-            if (mailboxVirtPtr_1.status == FFS_FW_ERROR) {
-                fw_comps_error_t fw_err = (fw_comps_error_t)(mailboxVirtPtr_1.error + FWCOMPS_MCC_ERR_CODES);//return error to high level app. Errors are defined as MCC errors
-                setLastError(fw_err);
-                DPRINTF(("CRITICAL : DMAComponentAccess::AccessComponent status %d err %d FW ERROR: %#x\n", mailboxVirtPtr_1.status, mailboxVirtPtr_1.error, fw_err));
+            if (!waitForFirmware(mailboxPage())) {
                 return false;
             }
 
-            // read the data from FW (from page.virtual_address -> to 'data' array)
-            if (access == MCDA_READ_COMP) {
-                DPRINTF(("READ mailboxVirtPtr->status = %d\r\n", mailboxVirtPtr_1.status));
-                readFromDataPage(&accessData, page, data, data_size, leftSize);
-                leftSize -= maxDataSize;
-                if (leftSize > 0) {
-                    CurrentPage == FMPT_FIRST_PAGE ? CurrentPage = FMPT_SECOND_PAGE : CurrentPage = FMPT_FIRST_PAGE;
-                    page = _allocatedListVect[CurrentPage];//change the page
-                    prepareParameters(updateHandle, &accessData, offset + (data_size - leftSize), data, data_size, access, leftSize, page, mailboxPage);
-                    //prepare auxilary data for next iteration
+            if (access == MCDA_WRITE_COMP) {
+                _manager->updateBurnCheckpoint(offset + chunkOffset, chunkSize);
+            } else {
+                DPRINTF(("READ chunk %d done\r\n", chunk));
+                if (chunk == numOfChunks - 1) {
+                    readFromDataPage(dataPage(chunk), data + chunkOffset / 4, chunkSize);
+                } else {
+                    readPending = true;
                 }
             }
-            nIteration++;
-            int newPercentage = (((data_size - leftSize) * 100) / data_size);
+            int newPercentage = (int)(((u_int64_t)(chunkOffset + chunkSize) * 100) / data_size);
 #ifdef UEFI_BUILD
         if (newPercentage > progressPercentage &&
             progressFuncAdv && progressFuncAdv->uefi_func) {
@@ -312,6 +346,17 @@ bool DMAComponentAccess::accessComponent(u_int32_t updateHandle, u_int32_t offse
 #endif
         }
 
+#if !defined(UEFI_BUILD) && !defined(__WIN__)
+        double elapsedTime = getTimeInSec() - startTime;
+        if (elapsedTime > 0) {
+            double rate = (data_size / (1024.0 * 1024.0)) / elapsedTime;
+            DPRINTF(("DMAComponentAccess::AccessComponent %d bytes in %.3f sec (%.2f MB/s)\n", data_size, elapsedTime, rate));
+            if (access == MCDA_WRITE_COMP && progressFuncAdv && progressFuncAdv->func) {
+                size_t stageLen = strlen(stage);
+                snprintf(stage + stageLen, MAX_MSG_SIZE - stageLen, " (%.2f MB/s)", rate);
+            }
+        }
+#endif
         if (progressFuncAdv && progressFuncAdv->func) {
             if (progressFuncAdv->func(0, stage,
                 PROG_OK, progressFuncAdv->opaque)) {
@@ -45,6 +45,12 @@
 
 typedef struct tools_open_mcdd_reg mcddReg;
 
+// number of data pages the host may fill ahead of the FW (the mailbox page comes on top of them)
+#define DMA_DEFAULT_QUEUE_DEPTH 4
+#define DMA_MIN_QUEUE_DEPTH (FMPT_MAILBOX_PAGE - FMPT_FIRST_PAGE)
+#define DMA_MAX_QUEUE_DEPTH (MAX_PAGES_SIZE - 1)
+#define DMA_QUEUE_DEPTH_ENV "MCDD_DMA_QUEUE_DEPTH"
+
 class DMAComponentAccess : public AbstractComponentAccess
 {
 public:
@@ -55,17 +61,23 @@ public:
         const char* currComponentStr,
         ProgressCallBackAdvSt *progressFuncAdv);
     bool allocateMemory();
-    DMAComponentAccess(FwCompsMgr* Manager, mfile * Mf) : AbstractComponentAccess(Manager, Mf) {}
+    DMAComponentAccess(FwCompsMgr* Manager, mfile * Mf, u_int32_t queueDepth = DMA_DEFAULT_QUEUE_DEPTH);
     virtual ~DMAComponentAccess() {}
     virtual fw_comps_error_t getLastFirmwareError() { return _lastFwError; }
     virtual reg_access_status_t  getLastRegisterAccessStatus() {return _lastRegisterAccessStatus;}
+    u_int32_t getQueueDepth() { return _queueDepth; }
 
 private:
-    bool prepareParameters(u_int32_t _updateHandle, mcddReg* accessData,
-        int offset, u_int32_t* data, int data_size, int access, int leftSize,
+    void prepareParameters(u_int32_t updateHandle, mcddReg* accessData, u_int32_t offset, u_int32_t size,
         mtcr_page_addresses page, mtcr_page_addresses mailbox_page);
-    bool readFromDataPage(mcddReg* accessData, mtcr_page_addresses page, u_int32_t* data, int data_size, int leftSize);
+    void writeToDataPage(mtcr_page_addresses page, u_int32_t* data, u_int32_t size);
+    void readFromDataPage(mtcr_page_addresses page, u_int32_t* data, u_int32_t size);
+    bool waitForFirmware(mtcr_page_addresses mailbox_page);
+    // the data pages are used as a ring, chunk N of a transfer always goes to page N % _queueDepth
+    mtcr_page_addresses& dataPage(u_int32_t chunk) { return _allocatedListVect[chunk % _queueDepth]; }
+    mtcr_page_addresses& mailboxPage() { return _allocatedListVect[_queueDepth]; }
     std::vector <mtcr_page_addresses> _allocatedListVect;
+    u_int32_t _queueDepth;
     fw_comps_error_t _lastFwError;
     reg_access_status_t _lastRegisterAccessStatus;
     void setLastError(fw_comps_error_t error) {_lastFwError = error;}
@@ -39,6 +39,12 @@
 #include <errno.h>
 #include <string.h>
 #include <compatibility.h>
+#ifndef __WIN__
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
 
 //                                         0x(major)(minor)
 //                           0x00000001;  #0x(0000)(0001)
@@ -59,13 +65,28 @@ struct mfa_desc {
     u_int8_t *toc;
     u_int8_t *data_ptr;
     int open_method;
+    int crc_state;
+    xz_block_index_t *data_index;
     char err_str[256];
 };
 
 
 enum mfa_open_methods {
     MFA_OPEN_BUF,
-    MFA_OPEN_FILE
+    MFA_OPEN_FILE,
+    MFA_OPEN_MMAP
+};
+
+
+/*
+ * Archives opened from a file only get their header checked on open, the CRC
+ * of the whole archive is computed on the first image extraction (or by
+ * mfa_verify) so queries that only look at the map don't read the data section.
+ */
+enum mfa_crc_states {
+    MFA_CRC_UNCHECKED,
+    MFA_CRC_OK,
+    MFA_CRC_BAD
 };
 
 
@@ -76,12 +97,13 @@ enum header_types {
 
 
 int mfa_verify_archive(u_int8_t *buf, long sz);
+int mfa_verify_header(u_int8_t *buf, long sz);
 int mfa_read_map(mfa_desc *mfa_d);
 int parse_section_header(char *buf, int len, int *header_type, int *nrecs);
 int mfa_read_toc(struct mfa_desc *mfa_d);
 
 
-static int _mfa_open_buf(mfa_desc **mfa_d, u_int8_t *arbuf, int size)
+static int _mfa_open_buf(mfa_desc **mfa_d, u_int8_t *arbuf, int size, int verify_crc)
 {
     int res = 0;
 
@@ -91,8 +113,16 @@ static int _mfa_open_buf(mfa_desc **mfa_d, u_int8_t *arbuf, int size)
     }
     memset(*mfa_d, 0, sizeof(mfa_desc));
 
-    if ((res = mfa_verify_archive(arbuf, size))) {
-        goto clean_up;
+    if (verify_crc) {
+        if ((res = mfa_verify_archive(arbuf, size))) {
+            goto clean_up;
+        }
+        (*mfa_d)->crc_state = MFA_CRC_OK;
+    } else {
+        if ((res = mfa_verify_header(arbuf, size))) {
+            goto clean_up;
+        }
+        (*mfa_d)->crc_state = MFA_CRC_UNCHECKED;
     }
 
     (*mfa_d)->buffer = arbuf;
@@ -124,7 +154,7 @@ int mfa_open_buf(mfa_desc **mfa_d, u_int8_t *arbuf, int size)
 {
     int res;
 
-    res = _mfa_open_buf(mfa_d, arbuf, size);
+    res = _mfa_open_buf(mfa_d, arbuf, size, 1);
     if (res == MFA_OK) {
         (*mfa_d)->open_method = MFA_OPEN_BUF;
     }
@@ -132,6 +162,46 @@ int mfa_open_buf(mfa_desc **mfa_d, u_int8_t *arbuf, int size)
 }
 
 
+#ifndef __WIN__
+/*
+ * Maps the archive read-only instead of reading all of it, the map and TOC are
+ * parsed straight from the mapping and the image data is only paged in when an
+ * image is extracted. Returns 1 if the file can't be mapped so the caller falls
+ * back to reading it (MFA_DISABLE_MMAP forces that).
+ */
+static int mfa_open_file_mmap(mfa_desc **mfa_d, char *fname)
+{
+    int res;
+    int fd;
+    struct stat st;
+    void *addr;
+
+    if (getenv("MFA_DISABLE_MMAP")) {
+        return 1;
+    }
+    if ((fd = open(fname, O_RDONLY)) < 0) {
+        return _ERR(MFA_ERR_FILE_OPEN);
+    }
+    if (fstat(fd, &st) || !S_ISREG(st.st_mode) || st.st_size <= 0 || st.st_size > 0x7fffffff) {
+        close(fd);
+        return 1;
+    }
+    addr = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (addr == MAP_FAILED) {
+        return 1;
+    }
+
+    if ((res = _mfa_open_buf(mfa_d, (u_int8_t*)addr, (int)st.st_size, 0)) != MFA_OK) {
+        munmap(addr, st.st_size);
+        return res;
+    }
+    (*mfa_d)->open_method = MFA_OPEN_MMAP;
+    return MFA_OK;
+}
+#endif
+
+
 int mfa_open_file(mfa_desc **mfa_d, char *fname)
 {
     int res = MFA_OK;
@@ -140,6 +210,12 @@ int mfa_open_file(mfa_desc **mfa_d, char *fname)
     long int fsize;
     long int sz;
 
+#ifndef __WIN__
+    if ((res = mfa_open_file_mmap(mfa_d, fname)) <= 0) {
+        return res;
+    }
+    res = MFA_OK;
+#endif
     if ((fp = fopen(fname, "rb")) == NULL) {
         return _ERR(MFA_ERR_FILE_OPEN);
     }
@@ -168,7 +244,7 @@ int mfa_open_file(mfa_desc **mfa_d, char *fname)
         goto err_clean_up;
     }
 
-    if ((res = _mfa_open_buf(mfa_d, buf, fsize)) != MFA_OK) {
+    if ((res = _mfa_open_buf(mfa_d, buf, fsize, 0)) != MFA_OK) {
         goto err_clean_up;
     }
 
@@ -196,20 +272,61 @@ int mfa_close(struct mfa_desc *mfa_d)
         free(mfa_d->buffer);
         mfa_d->buffer = NULL;
     }
+#ifndef __WIN__
+    if (mfa_d->open_method == MFA_OPEN_MMAP) {
+        munmap(mfa_d->buffer, mfa_d->bufsz);
+        mfa_d->buffer = NULL;
+    }
+#endif
     if (mfa_d->toc != NULL) {
         free(mfa_d->toc);
         mfa_d->toc = NULL;
     }
+    mfasec_free_data_index(mfa_d->data_index);
     free(mfa_d);
     return MFA_OK;
 }
 
 
+int mfa_verify(mfa_desc *mfa_d)
+{
+    if (mfa_d->crc_state == MFA_CRC_UNCHECKED) {
+        mfa_d->crc_state = mfa_verify_archive(mfa_d->buffer, mfa_d->bufsz) ? MFA_CRC_BAD : MFA_CRC_OK;
+    }
+    if (mfa_d->crc_state == MFA_CRC_BAD) {
+        return _ERR_STR(mfa_d, MFA_ERR_ARCHV_CRC, "Archive CRC check failed");
+    }
+    return MFA_OK;
+}
+
+
 int mfa_verify_archive(u_int8_t *buf, long sz)
 {
-    int i;
+    int res;
     u_int32_t crc;
     u_int32_t ar_crc;
+
+    if ((res = mfa_verify_header(buf, sz))) {
+        return res;
+    }
+
+    //Archive CRC
+    ar_crc = *((u_int32_t*)&buf[sz - 4]);
+    ar_crc = __be32_to_cpu(ar_crc);
+
+    crc = mfasec_crc32(buf, sz - 4, 0);
+    if (crc != ar_crc) {
+        //printf("CRC32 = %08x expected = %08x\n", crc, ar_crc);
+        return _ERR(MFA_ERR_ARCHV_CRC);
+    }
+
+    return MFA_OK;
+}
+
+
+int mfa_verify_header(u_int8_t *buf, long sz)
+{
+    int i;
     u_int32_t ver;
     u_int32_t major;
     u_int32_t minor;
@@ -239,16 +356,6 @@ int mfa_verify_archive(u_int8_t *buf, long sz)
         return _ERR(MFA_ERR_ARCHV_VER_UNSUPP);
     }
 
-    //Archive CRC
-    ar_crc = *((u_int32_t*)&buf[sz - 4]);
-    ar_crc = __be32_to_cpu(ar_crc);
-
-    crc = mfasec_crc32(buf, sz - 4, 0);
-    if (crc != ar_crc) {
-        //printf("CRC32 = %08x expected = %08x\n", crc, ar_crc);
-        return _ERR(MFA_ERR_ARCHV_CRC);
-    }
-
     return MFA_OK;
 }
 
@@ -271,6 +378,11 @@ int mfa_read_map(struct mfa_desc *mfa_d)
 
     section_hdr *map_hdr = (section_hdr*) &mfa_d->buffer[MAP_SECTION_OFFSET];
 
+    // the CRC may not have been checked yet, don't trust the section sizes
+    if (MAP_SECTION_OFFSET + sizeof(section_hdr) > (size_t)mfa_d->bufsz ||
+        MAP_SECTION_OFFSET + sizeof(section_hdr) + (size_t)__be32_to_cpu(map_hdr->size) > (size_t)mfa_d->bufsz) {
+        return _ERR(MFA_ERR_ARCHV_FORMAT);
+    }
     res = mfasec_get_map(&mfa_d->buffer[MAP_SECTION_OFFSET], __be32_to_cpu(map_hdr->size) + sizeof(section_hdr), &buf);
     if (res < 0) {
         goto clean_up;
@@ -289,7 +401,14 @@ int mfa_read_toc(struct mfa_desc *mfa_d)
     int res;
 
     section_hdr *map_hdr = (section_hdr*) &mfa_d->buffer[MAP_SECTION_OFFSET];
-    section_hdr *toc_hdr = (section_hdr*) &mfa_d->buffer[MAP_SECTION_OFFSET + __be32_to_cpu(map_hdr->size) + sizeof(section_hdr)];
+    size_t toc_offset = MAP_SECTION_OFFSET + __be32_to_cpu(map_hdr->size) + sizeof(section_hdr);
+    if (toc_offset + sizeof(section_hdr) > (size_t)mfa_d->bufsz) {
+        return _ERR(MFA_ERR_ARCHV_FORMAT);
+    }
+    section_hdr *toc_hdr = (section_hdr*) &mfa_d->buffer[toc_offset];
+    if (toc_offset + 2 * sizeof(section_hdr) + (size_t)__be32_to_cpu(toc_hdr->size) > (size_t)mfa_d->bufsz) {
+        return _ERR(MFA_ERR_ARCHV_FORMAT);
+    }
     mfa_d->data_ptr = &mfa_d->buffer[MAP_SECTION_OFFSET + __be32_to_cpu(map_hdr->size) + 2 * sizeof(section_hdr) + __be32_to_cpu(toc_hdr->size)];
 
     res = mfasec_get_toc((u_int8_t*)toc_hdr, __be32_to_cpu(toc_hdr->size) + sizeof(section_hdr), &buf);
@@ -461,6 +580,9 @@ ssize_t mfa_get_image(mfa_desc *mfa_d, char *board_type_id, u_int8_t type, char
     }
 
     *buffer = NULL;
+    if ((res = mfa_verify(mfa_d)) < 0) {
+        return res;
+    }
     int n = mfa_map_get_num_images(map_entry);
     ssize_t total_size = 0;
 
@@ -513,8 +635,8 @@ ssize_t mfa_get_image(mfa_desc *mfa_d, char *board_type_id, u_int8_t type, char
         if (toce_ar[i]->data_size == 0) {
             continue;
         }
-        int rc = mfasec_get_data_chunk(mfa_d->data_ptr, (mfa_d->buffer + mfa_d->bufsz) - mfa_d->data_ptr, toce_ar[i]->data_offset,
-                                       toce_ar[i]->data_size, &((*buffer)[accum_size]));
+        int rc = mfasec_get_data_chunk_idx(mfa_d->data_ptr, (mfa_d->buffer + mfa_d->bufsz) - mfa_d->data_ptr, &mfa_d->data_index,
+                                           toce_ar[i]->data_offset, toce_ar[i]->data_size, &((*buffer)[accum_size]));
         if (rc < 0) {
             res = _ERR_STR(mfa_d, -rc, "Failed to get image");
             goto img_alloc_clean_up;
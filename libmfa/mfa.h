@@ -53,6 +53,7 @@ void        mfa_init(); //Must be called before any MFA function to perform one
 int         mfa_open_buf(mfa_desc**, u_int8_t *arbuf, int size);
 int         mfa_open_file(mfa_desc**, char *fname);
 int         mfa_close(mfa_desc *mfa_d);
+int         mfa_verify(mfa_desc *mfa_d); //Checks the archive CRC, mfa_open_file defers it to the first image extraction
 ssize_t     mfa_get_image(mfa_desc *mfa_d, char *board_type_id, u_int8_t type, char *selector_tag, u_int8_t **buffer);
 char*       mfa_get_board_metadata(mfa_desc *mfa_d, char *board_type_id, char *key);
 void        mfa_release_image(u_int8_t *buffer);
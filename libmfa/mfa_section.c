@@ -190,18 +190,26 @@ ssize_t  mfasec_get_toc(u_int8_t *inbuf, size_t inbufsz, u_int8_t **outbuf)
     return res;
 }
 
-#define BUF_SIZE 1024
-
-enum read_states {
-    SEEK,
-    COPY
-};
+#define BUF_SIZE 0x4000
 
 int mfasec_get_data_chunk(u_int8_t *data_sec_ptr, size_t data_sec_len, size_t chunk_offset, size_t length, u_int8_t *outbuf)
+{
+    return mfasec_get_data_chunk_idx(data_sec_ptr, data_sec_len, NULL, chunk_offset, length, outbuf);
+}
+
+
+/*
+ * When index is given, the block index of a compressed data section is built
+ * into *index on the first call (the caller frees it with mfasec_free_data_index)
+ * and decompression starts at the block that holds chunk_offset instead of at
+ * the start of the section.
+ */
+int mfasec_get_data_chunk_idx(u_int8_t *data_sec_ptr, size_t data_sec_len, xz_block_index_t **index,
+                              size_t chunk_offset, size_t length, u_int8_t *outbuf)
 {
     int res = 0;
     int rc;
-    xzhandle_t *xzh;
+    xzhandle_t *xzh = NULL;
     u_int8_t *buf = NULL;
     size_t src_sz;
 
@@ -216,7 +224,9 @@ int mfasec_get_data_chunk(u_int8_t *data_sec_ptr, size_t data_sec_len, size_t ch
     src_sz = __be32_to_cpu(hdr->size);
 
     if (hdr->flags & SFLAG_XZ_COMPRESSED) {
-        size_t sz;
+        ssize_t sz;
+        size_t pos = 0;
+        size_t rlen = 0;
         buf = (u_int8_t*)malloc(BUF_SIZE);
         if (buf == NULL) {
             return _ERR(MFA_ERR_MEM_ALLOC);
@@ -230,47 +240,45 @@ int mfasec_get_data_chunk(u_int8_t *data_sec_ptr, size_t data_sec_len, size_t ch
             res = _ERR(MFA_ERR_DECOMPRESSION);
             goto clean_up;
         }
-        if (sz < (chunk_offset + length)) {
+        if ((size_t)sz < (chunk_offset + length)) {
             res = _ERR(MFA_ERR_DECOMPRESSION);
             goto clean_up;
         }
 
-        //Read section into buffer
-        xzh = xz_open_buf(ptr, src_sz);
+        if (index != NULL) {
+            if (*index == NULL) {
+                *index = xz_build_block_index(ptr, src_sz);
+            }
+            if (*index != NULL) {
+                xzh = xz_open_buf_at(ptr, src_sz, *index, chunk_offset, &pos);
+            }
+        }
+        if (xzh == NULL) {
+            //Read section into buffer
+            xzh = xz_open_buf(ptr, src_sz);
+            pos = 0;
+        }
         if (xzh == NULL) {
             res = _ERR(MFA_ERR_DECOMPRESSION);
             goto clean_up;
         }
 
-        size_t index = 0;
-        size_t rlen = 0;
-        int state = SEEK;
-        do {
-            rc = xz_read(xzh, buf, BUF_SIZE);
-            if (rc > 0) {
-                index += rc;
+        // skip to the chunk, then decompress it straight into the output buffer
+        while (rlen < length) {
+            if (pos < chunk_offset) {
+                size_t skip = chunk_offset - pos;
+                rc = xz_read(xzh, buf, skip < BUF_SIZE ? skip : BUF_SIZE);
             } else {
-                break;
-            }
-
-            if (state == SEEK) {
-                if (index > chunk_offset) {
-                    rlen += index - chunk_offset;
-                    memcpy(outbuf, &buf[rc - (rlen)], rlen);
-                    state = COPY;
+                rc = xz_read(xzh, &outbuf[rlen], length - rlen);
+                if (rc > 0) {
+                    rlen += rc;
                 }
-            } else if (state == COPY) {
-                size_t delta = rc;
-                if ((rlen + rc) > length) {
-                    delta = length - rlen;
-                }
-                memcpy(&outbuf[rlen], buf, delta);
-                rlen += delta;
             }
-            if (rlen == length) {
+            if (rc <= 0) {
                 break;
             }
-        } while (rc == BUF_SIZE);
+            pos += rc;
+        }
 
         xz_close(xzh);
 
@@ -291,6 +299,12 @@ clean_up:
 }
 
 
+void mfasec_free_data_index(xz_block_index_t *index)
+{
+    xz_free_block_index(index);
+}
+
+
 char* mfasec_get_sub_image_type_str(int t)
 {
     char *tstr;
@@ -45,6 +45,11 @@
 #define XZ_IOBUF_SIZE 4096
 #define _ERR(errcode) (-errcode)
 
+#define XZ_STREAM_HDR_SZ    12
+#define XZ_STREAM_FTR_SZ    12
+#define XZ_MAX_NUM_SZ       9
+#define XZ_MAX_SEGS         3
+
 #define MXZ_ERR_MEM_ALLOC 1
 #define MXZ_ERR_DECODER_INIT 2
 
@@ -55,13 +60,34 @@ typedef struct {
 
 static uint8_t xz_has_init = 0;
 
+/*
+ * The decoder input is a list of segments, a plain stream is a single segment.
+ * A stream opened at a block is fed as the original stream header, the blocks
+ * from that block on and an index+footer rebuilt for those blocks only, so the
+ * decoder sees a valid stream without touching the preceding blocks.
+ */
 struct xzhandle_t {
-    const u_int8_t *buf;
-    ssize_t size;
-    ssize_t pos;
+    const u_int8_t *segs[XZ_MAX_SEGS];
+    size_t seg_sizes[XZ_MAX_SEGS];
+    int nsegs;
+    int cur_seg;
+    u_int8_t *tail;
     xz_env *envptr;
 };
 
+typedef struct {
+    size_t comp_offset;     // from the start of the stream
+    size_t uncomp_offset;
+    u_int64_t unpadded;
+    u_int64_t uncomp_size;
+} xz_block_info_t;
+
+struct xz_block_index_t {
+    size_t index_offset;    // start of the stream index, i.e. the end of the last block
+    u_int32_t num_blocks;
+    xz_block_info_t *blocks;
+};
+
 
 void xz_init()
 {
@@ -189,6 +215,176 @@ ssize_t xz_stream_len(u_int8_t *buffer, ssize_t len)
 }
 
 
+static size_t encode_xz_num(u_int8_t buf[], u_int64_t num)
+{
+    size_t i = 0;
+    while (num >= 0x80) {
+        buf[i++] = (u_int8_t)num | 0x80;
+        num >>= 7;
+    }
+    buf[i++] = (u_int8_t)num;
+    return i;
+}
+
+
+static void put_le32(u_int8_t *buf, u_int32_t val)
+{
+    buf[0] = (u_int8_t)val;
+    buf[1] = (u_int8_t)(val >> 8);
+    buf[2] = (u_int8_t)(val >> 16);
+    buf[3] = (u_int8_t)(val >> 24);
+}
+
+
+xz_block_index_t* xz_build_block_index(const u_int8_t *buffer, ssize_t len)
+{
+    ssize_t pos = len - 1;
+    ssize_t index_start;
+    ssize_t index_end;
+    u_int32_t backward_size;
+    u_int64_t num_blocks = 0;
+    size_t comp_offset = XZ_STREAM_HDR_SZ;
+    size_t uncomp_offset = 0;
+    size_t idx;
+    u_int32_t i;
+    xz_block_index_t *index;
+
+    if (len < XZ_STREAM_HDR_SZ + XZ_STREAM_FTR_SZ) {
+        return NULL;
+    }
+    // skip stream padding
+    while (pos > 0 && buffer[pos] == 0) {
+        pos--;
+    }
+    if (pos < XZ_STREAM_HDR_SZ + XZ_STREAM_FTR_SZ - 1 || buffer[pos] != 'Z' || buffer[pos - 1] != 'Y') {
+        return NULL;
+    }
+    index_end = pos - (XZ_STREAM_FTR_SZ - 1);
+    backward_size = __le32_to_cpu(*((u_int32_t*)&buffer[index_end + 4]));
+    backward_size = (backward_size + 1) * 4;
+    index_start = index_end - backward_size;
+    if (index_start < XZ_STREAM_HDR_SZ || buffer[index_start] != 0) {
+        return NULL;
+    }
+    pos = index_start + 1;
+    idx = decode_xz_num(&buffer[pos], index_end - pos, &num_blocks);
+    if (!idx || num_blocks == 0 || num_blocks > (u_int64_t)backward_size) {
+        return NULL;
+    }
+    pos += idx;
+
+    index = (xz_block_index_t*)malloc(sizeof(xz_block_index_t));
+    if (index == NULL) {
+        return NULL;
+    }
+    index->blocks = (xz_block_info_t*)malloc(sizeof(xz_block_info_t) * num_blocks);
+    if (index->blocks == NULL) {
+        free(index);
+        return NULL;
+    }
+    index->num_blocks = (u_int32_t)num_blocks;
+    index->index_offset = index_start;
+    for (i = 0; i < index->num_blocks; i++) {
+        xz_block_info_t *block = &index->blocks[i];
+        idx = decode_xz_num(&buffer[pos], index_end - pos, &block->unpadded);
+        pos += idx;
+        if (idx) {
+            idx = decode_xz_num(&buffer[pos], index_end - pos, &block->uncomp_size);
+            pos += idx;
+        }
+        if (!idx) {
+            xz_free_block_index(index);
+            return NULL;
+        }
+        block->comp_offset = comp_offset;
+        block->uncomp_offset = uncomp_offset;
+        comp_offset += (block->unpadded + 3) & ~(u_int64_t)3;
+        uncomp_offset += block->uncomp_size;
+    }
+    if (comp_offset != (size_t)index_start) {
+        xz_free_block_index(index);
+        return NULL;
+    }
+    return index;
+}
+
+
+void xz_free_block_index(xz_block_index_t *index)
+{
+    if (index == NULL) {
+        return;
+    }
+    free(index->blocks);
+    free(index);
+}
+
+
+u_int32_t xz_get_num_blocks(xz_block_index_t *index)
+{
+    return index->num_blocks;
+}
+
+
+xzhandle_t* xz_open_buf_at(const u_int8_t *buf, size_t size, xz_block_index_t *index, size_t uncomp_offset, size_t *block_uncomp_offset)
+{
+    u_int32_t first = 0;
+    u_int32_t i;
+    size_t tail_size;
+    size_t pos = 0;
+    u_int8_t *tail;
+    xzhandle_t *xzh;
+
+    // last block that starts at or before the requested offset
+    while (first + 1 < index->num_blocks && index->blocks[first + 1].uncomp_offset <= uncomp_offset) {
+        first++;
+    }
+    if (first == 0) {
+        *block_uncomp_offset = 0;
+        return xz_open_buf(buf, size);
+    }
+
+    // index indicator + records count + records + padding + CRC32, then the footer
+    tail_size = 1 + XZ_MAX_NUM_SZ + (index->num_blocks - first) * 2 * XZ_MAX_NUM_SZ + 3 + 4 + XZ_STREAM_FTR_SZ;
+    tail = (u_int8_t*)malloc(tail_size);
+    if (tail == NULL) {
+        return NULL;
+    }
+    tail[pos++] = 0;
+    pos += encode_xz_num(&tail[pos], index->num_blocks - first);
+    for (i = first; i < index->num_blocks; i++) {
+        pos += encode_xz_num(&tail[pos], index->blocks[i].unpadded);
+        pos += encode_xz_num(&tail[pos], index->blocks[i].uncomp_size);
+    }
+    while (pos & 3) {
+        tail[pos++] = 0;
+    }
+    put_le32(&tail[pos], xz_io_crc32(tail, pos, 0));
+    pos += 4;
+    // footer: CRC32 of backward size and flags, backward size, stream flags (as in the header), magic
+    put_le32(&tail[pos + 4], (u_int32_t)(pos / 4 - 1));
+    tail[pos + 8] = buf[6];
+    tail[pos + 9] = buf[7];
+    put_le32(&tail[pos], xz_io_crc32(&tail[pos + 4], 6, 0));
+    tail[pos + 10] = 'Y';
+    tail[pos + 11] = 'Z';
+    pos += XZ_STREAM_FTR_SZ;
+
+    xzh = xz_open_buf(buf, XZ_STREAM_HDR_SZ);
+    if (xzh == NULL) {
+        free(tail);
+        return NULL;
+    }
+    xzh->segs[1] = &buf[index->blocks[first].comp_offset];
+    xzh->seg_sizes[1] = index->index_offset - index->blocks[first].comp_offset;
+    xzh->segs[2] = tail;
+    xzh->seg_sizes[2] = pos;
+    xzh->nsegs = 3;
+    xzh->tail = tail;
+    *block_uncomp_offset = index->blocks[first].uncomp_offset;
+    return xzh;
+}
+
+
 xzhandle_t* xz_open_buf(const u_int8_t *buf, size_t size)
 {
     xzhandle_t *xzh;
@@ -208,9 +404,10 @@ xzhandle_t* xz_open_buf(const u_int8_t *buf, size_t size)
         free(env);
         return NULL;
     }
-    xzh->buf = buf;
-    xzh->size = size;
-    xzh->pos = 0;
+    memset(xzh, 0, sizeof(xzhandle_t));
+    xzh->segs[0] = buf;
+    xzh->seg_sizes[0] = size;
+    xzh->nsegs = 1;
     xzh->envptr = env;
 
     return xzh;
@@ -222,6 +419,7 @@ void xz_close(xzhandle_t *xzh)
     xz_env *e = xzh->envptr;
     xz_dec_end(e->s);
     free(e);
+    free(xzh->tail);
     free(xzh);
 }
 
@@ -233,8 +431,8 @@ int xz_read(xzhandle_t *xzh, u_int8_t *buf, size_t len)
 
     e = xzh->envptr;
     if (e->b.in == NULL) {
-        e->b.in = (uint8_t*)&xzh->buf[xzh->pos];
-        e->b.in_size = xzh->size;
+        e->b.in = (uint8_t*)xzh->segs[0];
+        e->b.in_size = xzh->seg_sizes[0];
         e->b.in_pos = 0;
     }
 
@@ -242,6 +440,12 @@ int xz_read(xzhandle_t *xzh, u_int8_t *buf, size_t len)
     e->b.out_size = len;
     e->b.out_pos = 0;
     do {
+        if (e->b.in_pos == e->b.in_size && xzh->cur_seg + 1 < xzh->nsegs) {
+            xzh->cur_seg++;
+            e->b.in = (uint8_t*)xzh->segs[xzh->cur_seg];
+            e->b.in_size = xzh->seg_sizes[xzh->cur_seg];
+            e->b.in_pos = 0;
+        }
         ret = xz_dec_run(e->s, &e->b);
 
         if (e->b.out_pos == e->b.out_size) {
@@ -36,6 +36,7 @@
 #include <compatibility.h>
 
 typedef struct xzhandle_t xzhandle_t;
+typedef struct xz_block_index_t xz_block_index_t;
 
 void        xz_init();
 u_int32_t   xz_io_crc32(const u_int8_t *buf, size_t size, u_int32_t crc);
@@ -45,5 +46,11 @@ xzhandle_t* xz_open_buf(const u_int8_t *buf, size_t size);
 void        xz_close(xzhandle_t *xzh);
 int         xz_read(xzhandle_t *xzh, u_int8_t *buf, size_t len);
 
+// Block index of a single xz stream, used to start decoding at the block that holds a given offset
+xz_block_index_t* xz_build_block_index(const u_int8_t *buffer, ssize_t len);
+void        xz_free_block_index(xz_block_index_t *index);
+u_int32_t   xz_get_num_blocks(xz_block_index_t *index);
+xzhandle_t* xz_open_buf_at(const u_int8_t *buf, size_t size, xz_block_index_t *index, size_t uncomp_offset, size_t *block_uncomp_offset);
+
 #endif
 
@@ -0,0 +1,281 @@
+/*
+ * Copyright (c) 2021 Mellanox Technologies Ltd.  All rights reserved.
+ *
+ * This software is available to you under a choice of one of two
+ * licenses.  You may choose to be licensed under the terms of the GNU
+ * General Public License (GPL) Version 2, available from the file
+ * COPYING in the main directory of this source tree, or the
+ * OpenIB.org BSD license below:
+ *
+ *     Redistribution and use in source and binary forms, with or
+ *     without modification, are permitted provided that the following
+ *     conditions are met:
+ *
+ *      - Redistributions of source code must retain the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer.
+ *
+ *      - Redistributions in binary form must reproduce the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer in the documentation and/or other materials
+ *        provided with the distribution.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *  mft_thread_pool.cpp
+ */
+
+#include <time.h>
+#include <unistd.h>
+#include <vector>
+
+#include "mft_thread_pool.h"
+
+using namespace std;
+
+namespace mft_utils
+{
+
+#define MFT_THREAD_POOL_MAX_THREADS 64
+
+MftThreadPool::MftThreadPool(u_int32_t numOfThreads) :
+    _numOfThreads(numOfThreads), _numOfJobs(0), _nextJob(0), _jobFunc(NULL), _ctx(NULL)
+{
+    if (_numOfThreads == 0) {
+        _numOfThreads = getDefaultNumOfThreads();
+    }
+    if (_numOfThreads > MFT_THREAD_POOL_MAX_THREADS) {
+        _numOfThreads = MFT_THREAD_POOL_MAX_THREADS;
+    }
+}
+
+u_int32_t MftThreadPool::getDefaultNumOfThreads()
+{
+    long numOfCpus = sysconf(_SC_NPROCESSORS_ONLN);
+    if (numOfCpus <= 0) {
+        return 1;
+    }
+    return numOfCpus > MFT_THREAD_POOL_MAX_THREADS ? MFT_THREAD_POOL_MAX_THREADS : (u_int32_t)numOfCpus;
+}
+
+bool MftThreadPool::getNextJob(u_int32_t& jobIdx)
+{
+    MftLockGuard guard(_jobsLock);
+    if (_nextJob >= _numOfJobs) {
+        return false;
+    }
+    jobIdx = _nextJob++;
+    return true;
+}
+
+void* MftThreadPool::workerMain(void *pool)
+{
+    MftThreadPool *self = (MftThreadPool*)pool;
+    u_int32_t jobIdx;
+    while (self->getNextJob(jobIdx)) {
+        self->_jobFunc(self->_ctx, jobIdx);
+    }
+    return NULL;
+}
+
+void MftThreadPool::run(u_int32_t numOfJobs, mft_job_func_t jobFunc, void *ctx)
+{
+    _numOfJobs = numOfJobs;
+    _nextJob = 0;
+    _jobFunc = jobFunc;
+    _ctx = ctx;
+    if (numOfJobs == 0) {
+        return;
+    }
+    u_int32_t numOfWorkers = numOfJobs < _numOfThreads ? numOfJobs : _numOfThreads;
+    if (numOfWorkers == 1) {
+        // no point in spawning a thread for a single worker
+        workerMain(this);
+        return;
+    }
+    vector<pthread_t> workers;
+    for (u_int32_t i = 0; i < numOfWorkers; i++) {
+        pthread_t tid;
+        if (pthread_create(&tid, NULL, workerMain, this)) {
+            break;
+        }
+        workers.push_back(tid);
+    }
+    if (workers.empty()) {
+        // could not start any thread, do the work on the calling thread
+        workerMain(this);
+        return;
+    }
+    for (vector<pthread_t>::iterator it = workers.begin(); it != workers.end(); ++it) {
+        pthread_join(*it, NULL);
+    }
+}
+
+/*
+ * State of a runWithTimeout call. It is shared with the (detached) workers and
+ * released by whoever drops the last reference, since a worker stuck in an
+ * abandoned job may outlive the call.
+ */
+typedef enum {
+    TIMED_JOB_PENDING = 0,
+    TIMED_JOB_RUNNING,
+    TIMED_JOB_DONE,
+    TIMED_JOB_ABANDONED
+} timed_job_status_t;
+
+typedef struct {
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    u_int32_t refCount;
+    u_int32_t liveWorkers;
+    u_int32_t numOfJobs;
+    u_int32_t nextJob;
+    u_int32_t numOfFinished;
+    mft_job_func_t jobFunc;
+    void *ctx;
+    vector<u_int8_t> status;
+    vector<time_t> startTime;
+} timed_run_state_t;
+
+static time_t monotonicSec()
+{
+    struct timespec ts;
+    if (clock_gettime(CLOCK_MONOTONIC, &ts)) {
+        return time(NULL);
+    }
+    return ts.tv_sec;
+}
+
+// called with state->lock held, the lock is released
+static void releaseTimedRunState(timed_run_state_t *state)
+{
+    bool last = --state->refCount == 0;
+    pthread_mutex_unlock(&state->lock);
+    if (last) {
+        pthread_cond_destroy(&state->cond);
+        pthread_mutex_destroy(&state->lock);
+        delete state;
+    }
+}
+
+static void* timedWorkerMain(void *arg)
+{
+    timed_run_state_t *state = (timed_run_state_t*)arg;
+    pthread_mutex_lock(&state->lock);
+    while (state->nextJob < state->numOfJobs) {
+        u_int32_t jobIdx = state->nextJob++;
+        state->status[jobIdx] = TIMED_JOB_RUNNING;
+        state->startTime[jobIdx] = monotonicSec();
+        pthread_mutex_unlock(&state->lock);
+        state->jobFunc(state->ctx, jobIdx);
+        pthread_mutex_lock(&state->lock);
+        if (state->status[jobIdx] == TIMED_JOB_ABANDONED) {
+            // another worker already took our place
+            releaseTimedRunState(state);
+            return NULL;
+        }
+        state->status[jobIdx] = TIMED_JOB_DONE;
+        state->numOfFinished++;
+        pthread_cond_signal(&state->cond);
+    }
+    state->liveWorkers--;
+    pthread_cond_signal(&state->cond);
+    releaseTimedRunState(state);
+    return NULL;
+}
+
+// called with state->lock held
+static bool startTimedWorker(timed_run_state_t *state)
+{
+    pthread_t tid;
+    pthread_attr_t attr;
+    if (pthread_attr_init(&attr)) {
+        return false;
+    }
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+    state->refCount++;
+    state->liveWorkers++;
+    bool started = pthread_create(&tid, &attr, timedWorkerMain, state) == 0;
+    pthread_attr_destroy(&attr);
+    if (!started) {
+        state->refCount--;
+        state->liveWorkers--;
+    }
+    return started;
+}
+
+void MftThreadPool::runWithTimeout(u_int32_t numOfJobs, mft_job_func_t jobFunc, void *ctx,
+                                   u_int32_t jobTimeoutSec, vector<bool>& jobTimedOut)
+{
+    jobTimedOut.assign(numOfJobs, false);
+    if (numOfJobs == 0) {
+        return;
+    }
+    if (jobTimeoutSec == 0) {
+        run(numOfJobs, jobFunc, ctx);
+        return;
+    }
+    timed_run_state_t *state = new timed_run_state_t;
+    pthread_mutex_init(&state->lock, NULL);
+    pthread_cond_init(&state->cond, NULL);
+    state->refCount = 1;
+    state->liveWorkers = 0;
+    state->numOfJobs = numOfJobs;
+    state->nextJob = 0;
+    state->numOfFinished = 0;
+    state->jobFunc = jobFunc;
+    state->ctx = ctx;
+    state->status.assign(numOfJobs, TIMED_JOB_PENDING);
+    state->startTime.assign(numOfJobs, 0);
+
+    pthread_mutex_lock(&state->lock);
+    u_int32_t numOfWorkers = numOfJobs < _numOfThreads ? numOfJobs : _numOfThreads;
+    for (u_int32_t i = 0; i < numOfWorkers; i++) {
+        if (!startTimedWorker(state)) {
+            break;
+        }
+    }
+    if (state->liveWorkers == 0) {
+        // could not start any thread, run without a timeout on the calling thread
+        releaseTimedRunState(state);
+        run(numOfJobs, jobFunc, ctx);
+        return;
+    }
+    while (state->numOfFinished < numOfJobs) {
+        struct timespec wakeUp;
+        clock_gettime(CLOCK_REALTIME, &wakeUp);
+        wakeUp.tv_sec += 1;
+        pthread_cond_timedwait(&state->cond, &state->lock, &wakeUp);
+        time_t now = monotonicSec();
+        for (u_int32_t i = 0; i < numOfJobs; i++) {
+            if (state->status[i] != TIMED_JOB_RUNNING || now - state->startTime[i] < (time_t)jobTimeoutSec) {
+                continue;
+            }
+            state->status[i] = TIMED_JOB_ABANDONED;
+            state->numOfFinished++;
+            state->liveWorkers--;
+            jobTimedOut[i] = true;
+            if (state->nextJob < numOfJobs) {
+                startTimedWorker(state);
+            }
+        }
+        if (state->liveWorkers == 0 && state->nextJob < numOfJobs) {
+            // no worker left to pick up the remaining jobs
+            for (; state->nextJob < numOfJobs; state->nextJob++) {
+                state->status[state->nextJob] = TIMED_JOB_ABANDONED;
+                state->numOfFinished++;
+                jobTimedOut[state->nextJob] = true;
+            }
+        }
+    }
+    releaseTimedRunState(state);
+}
+
+}
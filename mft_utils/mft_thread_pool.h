@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2021 Mellanox Technologies Ltd.  All rights reserved.
+ *
+ * This software is available to you under a choice of one of two
+ * licenses.  You may choose to be licensed under the terms of the GNU
+ * General Public License (GPL) Version 2, available from the file
+ * COPYING in the main directory of this source tree, or the
+ * OpenIB.org BSD license below:
+ *
+ *     Redistribution and use in source and binary forms, with or
+ *     without modification, are permitted provided that the following
+ *     conditions are met:
+ *
+ *      - Redistributions of source code must retain the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer.
+ *
+ *      - Redistributions in binary form must reproduce the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer in the documentation and/or other materials
+ *        provided with the distribution.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *  mft_thread_pool.h
+ *
+ *  A small bounded pool of worker threads used by the tools that work on
+ *  several independent devices/files at once.
+ */
+
+#ifndef MFT_THREAD_POOL_H_
+#define MFT_THREAD_POOL_H_
+
+#include <pthread.h>
+#include <vector>
+
+#include <compatibility.h>
+
+namespace mft_utils
+{
+
+/*
+ * Scoped pthread mutex, locked for the lifetime of the MftLockGuard object.
+ * A recursive mutex may be locked again by the thread that holds it (e.g. from a signal handler).
+ */
+class MftMutex
+{
+public:
+    explicit MftMutex(bool recursive = false)
+    {
+        pthread_mutexattr_t attr;
+        pthread_mutexattr_init(&attr);
+        if (recursive) {
+            pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+        }
+        pthread_mutex_init(&_mutex, &attr);
+        pthread_mutexattr_destroy(&attr);
+    }
+    ~MftMutex() { pthread_mutex_destroy(&_mutex); }
+    void lock() { pthread_mutex_lock(&_mutex); }
+    void unlock() { pthread_mutex_unlock(&_mutex); }
+private:
+    friend class MftCondition;
+    MftMutex(const MftMutex&);
+    MftMutex& operator=(const MftMutex&);
+    pthread_mutex_t _mutex;
+};
+
+/*
+ * Condition variable to wait on with a (non recursive) MftMutex held.
+ */
+class MftCondition
+{
+public:
+    MftCondition() { pthread_cond_init(&_cond, NULL); }
+    ~MftCondition() { pthread_cond_destroy(&_cond); }
+    void wait(MftMutex& mutex) { pthread_cond_wait(&_cond, &mutex._mutex); }
+    void broadcast() { pthread_cond_broadcast(&_cond); }
+private:
+    MftCondition(const MftCondition&);
+    MftCondition& operator=(const MftCondition&);
+    pthread_cond_t _cond;
+};
+
+class MftLockGuard
+{
+public:
+    explicit MftLockGuard(MftMutex& mutex) : _mutex(mutex) { _mutex.lock(); }
+    ~MftLockGuard() { _mutex.unlock(); }
+private:
+    MftLockGuard(const MftLockGuard&);
+    MftLockGuard& operator=(const MftLockGuard&);
+    MftMutex& _mutex;
+};
+
+typedef void (*mft_job_func_t)(void *ctx, u_int32_t jobIdx);
+
+/*
+ * Runs jobFunc(ctx, i) for every i in [0, numOfJobs) on at most numOfThreads
+ * worker threads. Jobs are handed out in index order, so callers that need
+ * deterministic output should store per-job results and print them by index.
+ */
+class MftThreadPool
+{
+public:
+    explicit MftThreadPool(u_int32_t numOfThreads = 0);
+    ~MftThreadPool() {}
+    // blocks until all jobs are done
+    void run(u_int32_t numOfJobs, mft_job_func_t jobFunc, void *ctx);
+    // blocks until every job is done or has been running for more than jobTimeoutSec.
+    // jobTimedOut[i] is set for the jobs that were given up on, their workers are left
+    // running detached so ctx and anything those jobs touch must never be released.
+    void runWithTimeout(u_int32_t numOfJobs, mft_job_func_t jobFunc, void *ctx,
+                        u_int32_t jobTimeoutSec, std::vector<bool>& jobTimedOut);
+    u_int32_t getNumOfThreads() const { return _numOfThreads; }
+    static u_int32_t getDefaultNumOfThreads();
+private:
+    static void* workerMain(void *pool);
+    bool getNextJob(u_int32_t& jobIdx);
+
+    u_int32_t _numOfThreads;
+    u_int32_t _numOfJobs;
+    u_int32_t _nextJob;
+    mft_job_func_t _jobFunc;
+    void *_ctx;
+    MftMutex _jobsLock;
+};
+
+}
+#endif /* MFT_THREAD_POOL_H_ */
@@ -159,4 +159,42 @@ u_int32_t least_common_multiple(u_int32_t a, u_int32_t b)
     return (a * b) / greatest_common_divisor(a, b);
 }
 
+string json_escape(const string& str)
+{
+    string res;
+    for (string::const_iterator it = str.begin(); it != str.end(); ++it) {
+        switch (*it) {
+        case '"':
+            res += "\\\"";
+            break;
+
+        case '\\':
+            res += "\\\\";
+            break;
+
+        case '\n':
+            res += "\\n";
+            break;
+
+        case '\r':
+            res += "\\r";
+            break;
+
+        case '\t':
+            res += "\\t";
+            break;
+
+        default:
+            if ((unsigned char)*it < 0x20) {
+                char hex[8];
+                snprintf(hex, sizeof(hex), "\\u%04x", (unsigned char)*it);
+                res += hex;
+            } else {
+                res += *it;
+            }
+        }
+    }
+    return res;
+}
+
 }
@@ -70,5 +70,8 @@ string to_uppercase_copy(string str);
 u_int32_t greatest_common_divisor(u_int32_t a, u_int32_t b);
 u_int32_t least_common_multiple(u_int32_t a, u_int32_t b);
 
+// escapes str for use inside a JSON string literal (the quotes are not added)
+string json_escape(const string& str);
+
 }
 #endif /* MFT_UTILS_H_ */
@@ -51,6 +51,7 @@ using namespace boost;
 #include "mlxarchive_mfa2_package_gen.h"
 #include <cmdparser/cmdparser.h>
 #include "mlxarchive.h"
+#include "mft_utils.h"
 
 #define IDENT            "    "
 #define IDENT2           IDENT IDENT
@@ -77,6 +78,10 @@ using namespace boost;
 #define VERSION_FLAG_SHORT          'v'
 #define MFA2_FILE_FLAG              "mfa2-file"
 #define MFA2_FILE_FLAG_SHORT        'm'
+#define XZ_PRESET_FLAG              "xz-preset"
+#define XZ_PRESET_FLAG_SHORT        ' '
+#define THREADS_FLAG                "threads"
+#define THREADS_FLAG_SHORT          ' '
 
 using namespace mlxarchive;
 bool writeToFile(const string&, const vector<u_int8_t>&);
@@ -94,6 +99,8 @@ Mlxarchive::Mlxarchive() :
     _version  = "";
     _mfa2file = "";
     _printMiniDump = false;
+    _xzPreset = MFA2_DEFAULT_XZ_PRESET;
+    _xzThreads = 0;
 }
 
 /************************************
@@ -108,6 +115,8 @@ void Mlxarchive::initCmdParser()
     AddOptions(OUT_FILE_FLAG,     OUT_FILE_FLAG_SHORT, "out_file", "Output file");
     AddOptions(BINS_DIR_FLAG,     BINS_DIR_FLAG_SHORT, "bins_dir", "Directory with the binaries files");
     AddOptions(MFA2_FILE_FLAG,    MFA2_FILE_FLAG_SHORT, "mfa2_file", "Mfa2 file to parse");
+    AddOptions(XZ_PRESET_FLAG,    XZ_PRESET_FLAG_SHORT, "preset", "xz compression preset (0-9) of the components, default is 9");
+    AddOptions(THREADS_FLAG,      THREADS_FLAG_SHORT,   "threads", "Number of compression threads, default is one per CPU");
     _cmdParser.AddRequester(this);
 }
 
@@ -209,6 +218,19 @@ ParseStatus Mlxarchive::HandleOption(string name, string value)
         }
         _mfa2file = value;
         return PARSE_OK;
+    } else if (name == XZ_PRESET_FLAG || name == THREADS_FLAG) {
+        u_int32_t num = 0;
+        if (value.empty() || value[0] == '-' || !mft_utils::strToNum(value, num, 0) ||
+            (name == XZ_PRESET_FLAG && num > 9)) {
+            cout << "Invalid value for " << name << ": " << value << endl;
+            return PARSE_ERROR;
+        }
+        if (name == XZ_PRESET_FLAG) {
+            _xzPreset = num;
+        } else {
+            _xzThreads = num;
+        }
+        return PARSE_OK;
     }
     else{
         cout << "Unknown flag specified" << endl;
@@ -239,6 +261,7 @@ int Mlxarchive::run(int argc, char **argv)
     string version = _version;
 
     buff.clear();
+    mfa2PackageGen.setCompressionParams(_xzPreset, _xzThreads);
     mfa2PackageGen.generateBinFromFWDirectory(dir, version, buff);
     //Save output to a file
     if (!writeToFile(outputFile, buff)) {
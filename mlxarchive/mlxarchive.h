@@ -55,5 +55,7 @@ namespace mlxarchive {
         std::string _version;
         std::string _mfa2file;
         bool _printMiniDump;
+        u_int32_t _xzPreset;
+        u_int32_t _xzThreads;
     };
 }
@@ -100,25 +100,31 @@ void MFA2::pack(vector<u_int8_t>& buff)
 
     _packageDescriptor.setComponentsBlockOffset(buff.size());
 
-    //compress components block
+    //compress components block, every component starts a new xz block so it can be extracted
+    //without decompressing the components before it
     vector<u_int8_t> componentsBlockBuff;
+    vector<u_int32_t> componentsOffsets;
     VECTOR_ITERATOR(Component, _components, it) {
         (*it).setComponentBinaryOffset(componentsBlockBuff.size());
+        componentsOffsets.push_back(componentsBlockBuff.size());
         (*it).packData(componentsBlockBuff);
     }
-    u_int32_t zippedSize = componentsBlockBuff.size();
-    zippedSize = xz_compress_crc32(8, componentsBlockBuff.data(),
-            componentsBlockBuff.size(), NULL, 0);
-    if (zippedSize <= 0)
-    {
-        //TODO throw exception
-        printf("-E- Error while compressing\n");
-        exit(1);
+    //the components data is the same in both passes of generateBinary, compress it only once
+    if (_zippedComponentsBlock.empty()) {
+        u_int8_t *zippedData = NULL;
+        int32_t zippedSize = xz_compress_mt_crc32(_xzPreset, _xzThreads, componentsBlockBuff.data(),
+                componentsBlockBuff.size(), componentsOffsets.data(), componentsOffsets.size(), &zippedData);
+        if (zippedSize <= 0)
+        {
+            //TODO throw exception
+            printf("-E- Error while compressing: %s\n", xz_get_error(zippedSize));
+            exit(1);
+        }
+        _zippedComponentsBlock.assign(zippedData, zippedData + zippedSize);
+        free(zippedData);
     }
-    _packageDescriptor.setComponentsBlockArchiveSize(zippedSize);
-    vector<u_int8_t> zippedComponentBlockBuff(zippedSize);
-    xz_compress_crc32(9, componentsBlockBuff.data(), componentsBlockBuff.size(),
-            zippedComponentBlockBuff.data(), zippedSize);
+    const vector<u_int8_t>& zippedComponentBlockBuff = _zippedComponentsBlock;
+    _packageDescriptor.setComponentsBlockArchiveSize(zippedComponentBlockBuff.size());
 
     //compute descriptors SHA256
     vector<u_int8_t> descriptorsBuff;
@@ -244,24 +250,22 @@ void MFA2::dump() {
 
 bool MFA2::extractComponent(Component* requiredComponent, vector<u_int8_t>& fwBinaryData)
 {
-    PackageDescriptor packageDescriptor = getPackageDescriptor();
-    u_int64_t totalSize = packageDescriptor.getComponentsBlockSize();
-    u_int32_t zipOffset = packageDescriptor.getComponentsBlockOffset();
-
-    vector<u_int8_t> unzippedBlockBuff;
-    unzippedBlockBuff.resize(totalSize);
-    vector<u_int8_t> zippedBuff = getBuffer();
-    u_int8_t* zippedData = (u_int8_t*)zippedBuff.data() + zipOffset;
-    int32_t retVal = xz_decompress_crc32(zippedData, zippedBuff.size() - zipOffset, unzippedBlockBuff.data(), totalSize);
-    if (retVal != (int32_t)totalSize) {
-        printf("Decompress error occurred %s\n", xz_get_error(retVal));
+    u_int32_t zipOffset = _packageDescriptor.getComponentsBlockOffset();
+    u_int32_t zipSize = _packageDescriptor.getComponentsBlockArchiveSize();
+    if (mfa2Buffer.size() < zipOffset || mfa2Buffer.size() - zipOffset < zipSize) {
+        printf("Decompress error occurred: components block is out of range\n");
         return false;
     }
-    u_int32_t requiredOffset = requiredComponent->getBinaryComponentOffset();
+    u_int8_t* zippedData = mfa2Buffer.data() + zipOffset;
+    //skip 16 bytes of the fingerprint, decompress only the component itself
+    u_int64_t requiredOffset = requiredComponent->getBinaryComponentOffset() + strlen(FINGERPRINT_MFA2);
     u_int32_t componentBinarySize = requiredComponent->getComponentBinarySize() - strlen(FINGERPRINT_MFA2);
     fwBinaryData.resize(componentBinarySize);
-    for (unsigned int index = 0; index < componentBinarySize; index++) {
-        fwBinaryData[index] = unzippedBlockBuff[requiredOffset + index + strlen(FINGERPRINT_MFA2)];//skip 16 bytes from decompressed file !
+    int32_t retVal = xz_decompress_range(zippedData, zipSize, requiredOffset,
+                                         fwBinaryData.data(), componentBinarySize);
+    if (retVal != (int32_t)componentBinarySize) {
+        printf("Decompress error occurred %s\n", xz_get_error(retVal));
+        return false;
     }
     return true;
 }
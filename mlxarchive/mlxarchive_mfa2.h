@@ -53,7 +53,7 @@
 
 using namespace std;
 
-
+#define MFA2_DEFAULT_XZ_PRESET 9
 
 namespace mfa2 {
     typedef map <string, Component> map_string_to_component;
@@ -66,6 +66,9 @@ namespace mfa2 {
         vector<Component>        _components;
         string                   _latestComponentKey;
         long _zipOffset;
+        u_int32_t _xzPreset;
+        u_int32_t _xzThreads;
+        vector<u_int8_t> _zippedComponentsBlock;
         //void updateSHA256();
         vector<u_int8_t> mfa2Buffer;
         void pack(vector<u_int8_t>& buff);
@@ -79,11 +82,17 @@ namespace mfa2 {
             _fingerPrint(MFA2_FINGER_PRINT),
             _packageDescriptor(packageDescriptor),
             _deviceDescriptors(deviceDescriptors),
-            _components(components), _zipOffset(0){};
+            _components(components), _zipOffset(0),
+            _xzPreset(MFA2_DEFAULT_XZ_PRESET), _xzThreads(0){};
 
         virtual ~MFA2() {}
         static MFA2 * LoadMFA2Package(const string & file_name);
         void generateBinary(vector<u_int8_t>& buff);
+        // xz preset (0-9) and number of compression threads (0 - one per CPU) of the components block
+        void setCompressionParams(u_int32_t xzPreset, u_int32_t xzThreads) {
+            _xzPreset = xzPreset;
+            _xzThreads = xzThreads;
+        }
         void dump();
         void minidump();
         PackageDescriptor getPackageDescriptor() const {
@@ -114,7 +123,7 @@ namespace mfa2 {
             _zipOffset = zipOffset;
         }
 
-        vector<u_int8_t> getBuffer() {
+        const vector<u_int8_t>& getBuffer() const {
             return mfa2Buffer;
         }
         map_string_to_component getMatchingComponents(char* psid, u_int16_t fw_ver[3]);
@@ -132,6 +132,7 @@ public:
     const VersionExtension & getVersionExtension() const {return _version;}
     u_int64_t getComponentsBlockSize  ();
     u_int32_t getComponentsBlockOffset  ();
+    u_int32_t getComponentsBlockArchiveSize  ();
 };
 
 inline void PackageDescriptor::setComponentsBlockOffset(u_int64_t offset)
@@ -149,6 +150,11 @@ inline void PackageDescriptor::setComponentsBlockArchiveSize(u_int32_t size)
     _componentsBlockArchiveSize = size;
 }
 
+inline u_int32_t PackageDescriptor::getComponentsBlockArchiveSize()
+{
+    return _componentsBlockArchiveSize;
+}
+
 inline void PackageDescriptor::setComponentsBlockSize(u_int64_t size)
 {
     _componentsBlockSize = size;
@@ -56,6 +56,7 @@ void MFA2PackageGen::generateBinFromJSON(const string& jsonFile,
     MFA2 mfa2(builder.getPackageDescriptor(),
             builder.getDeviceDescriptors(),
             builder.getComponents());
+    mfa2.setCompressionParams(_xzPreset, _xzThreads);
     mfa2.generateBinary(buff);
 
     //mfa2.patch(buff);
@@ -68,5 +69,6 @@ void MFA2PackageGen::generateBinFromFWDirectory(const string& directory, const s
     MFA2 mfa2(builder.getPackageDescriptor(),
             builder.getDeviceDescriptors(),
             builder.getComponents());
+    mfa2.setCompressionParams(_xzPreset, _xzThreads);
     mfa2.generateBinary(buff);
 }
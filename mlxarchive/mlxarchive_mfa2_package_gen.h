@@ -54,9 +54,15 @@ using namespace mfa2;
 class MFA2PackageGen {
 
 private:
+    u_int32_t _xzPreset;
+    u_int32_t _xzThreads;
 
 public:
-    MFA2PackageGen() {};
+    MFA2PackageGen() : _xzPreset(MFA2_DEFAULT_XZ_PRESET), _xzThreads(0) {};
+    void setCompressionParams(u_int32_t xzPreset, u_int32_t xzThreads) {
+        _xzPreset = xzPreset;
+        _xzThreads = xzThreads;
+    }
 
     void generateBinFromJSON(const string& jsonFile, vector<u_int8_t>& buff) const;
     void generateBinFromFWDirectory(const string& directory, const string& version, vector<u_int8_t>& buff) const;
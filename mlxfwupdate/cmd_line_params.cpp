@@ -82,6 +82,12 @@ CmdLineParams::CmdLineParams()
     dl              = false;
     no_extract_list = false;
     numberOfRetrials = 5;
+    query_threads = 0;
+    query_timeout = 300;
+    parallel_burns = 1;
+    json_progress = false;
+    build_index = false;
+    no_index = false;
 
 #ifdef __WIN__
     char execName[1024];
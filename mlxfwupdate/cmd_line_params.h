@@ -99,6 +99,12 @@ public:
     bool no_extract_list;
     int numberOfRetrials;
     bool no_fw_ctrl;
+    int query_threads;
+    int query_timeout;
+    int parallel_burns;
+    bool json_progress;
+    bool build_index;
+    bool no_index;
 };
 
 #endif
@@ -42,6 +42,7 @@
 #include "mft_utils.h"
 #include "cmd_line_parser.h"
 #include "cmd_line_params.h"
+#include "image_index.h"
 #include "tools_version.h"
 
 #ifdef MST_UL
@@ -214,6 +215,24 @@ using namespace mft_utils;
 #define NO_FW_CTRL_L        "no_fw_ctrl"
 #define NO_FW_CTRL_S        ' '
 
+#define QUERY_THREADS_L     "query-threads"
+#define QUERY_THREADS_S     ' '
+
+#define QUERY_TIMEOUT_L     "query-timeout"
+#define QUERY_TIMEOUT_S     ' '
+
+#define PARALLEL_L          "parallel"
+#define PARALLEL_S          ' '
+
+#define JSON_PROGRESS_L     "json-progress"
+#define JSON_PROGRESS_S     ' '
+
+#define BUILD_INDEX_L       "build-index"
+#define BUILD_INDEX_S       ' '
+
+#define NO_INDEX_L          "no-index"
+#define NO_INDEX_S          ' '
+
 string toolName = "";
 /************************************
 * Function: CmdLineParser
@@ -374,6 +393,36 @@ void CmdLineParser::initOptions()
                      "",
                      "Don't use FW Ctrl update");
 
+    this->AddOptions(QUERY_THREADS_L,
+                     QUERY_THREADS_S,
+                     "NumOfThreads",
+                     "Number of devices queried (or image files indexed) in parallel, default is one per online CPU (1 queries one device at a time)");
+
+    this->AddOptions(QUERY_TIMEOUT_L,
+                     QUERY_TIMEOUT_S,
+                     "Seconds",
+                     "Give up on a device whose query takes longer than this, default is 300 (0 waits forever)");
+
+    this->AddOptions(PARALLEL_L,
+                     PARALLEL_S,
+                     "NumOfDevices",
+                     "Burn up to this many devices at once, devices sharing a flash are still burned one after the other");
+
+    this->AddOptions(JSON_PROGRESS_L,
+                     JSON_PROGRESS_S,
+                     "",
+                     "Report the progress of parallel burns as JSON lines");
+
+    this->AddOptions(BUILD_INDEX_L,
+                     BUILD_INDEX_S,
+                     "",
+                     "Build the PSID index (" IMAGE_INDEX_FILE_NAME ") of the image directory, used with --" USE_IMG_DIR_L);
+
+    this->AddOptions(NO_INDEX_L,
+                     NO_INDEX_S,
+                     "",
+                     "Don't use the PSID index of the image directory, open every image file");
+
     this->AddOptions(YES_L,
                      YES_S,
                      "",
@@ -823,6 +872,33 @@ ParseStatus CmdLineParser::HandleOption(string name, string value)
             return PARSE_ERROR;
         }
         return PARSE_OK;
+    } else if (name == QUERY_THREADS_L || name == QUERY_TIMEOUT_L || name == PARALLEL_L) {
+        u_int32_t num = 0;
+        if (!value.size() || value[0] == '-' || !mft_utils::strToNum(value, num, 0) || num > 0x7fffffff) {
+            cout << "-E- Could not parse val: " << value << "\n";
+            return PARSE_ERROR_SHOW_USAGE;
+        }
+        if (name == QUERY_THREADS_L) {
+            _cmdLineParams->query_threads = (int)num;
+        } else if (name == QUERY_TIMEOUT_L) {
+            _cmdLineParams->query_timeout = (int)num;
+        } else {
+            if (num == 0) {
+                cout << "-E- Number of parallel burns must be at least 1\n";
+                return PARSE_ERROR;
+            }
+            _cmdLineParams->parallel_burns = (int)num;
+        }
+        return PARSE_OK;
+    } else if (name == JSON_PROGRESS_L) {
+        _cmdLineParams->json_progress = true;
+        return PARSE_OK;
+    } else if (name == BUILD_INDEX_L) {
+        _cmdLineParams->build_index = true;
+        return PARSE_OK;
+    } else if (name == NO_INDEX_L) {
+        _cmdLineParams->no_index = true;
+        return PARSE_OK;
     } else {
         cout << "Unknown Flag: " << name << "\n";
         return PARSE_ERROR_SHOW_USAGE;
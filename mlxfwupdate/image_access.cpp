@@ -96,11 +96,9 @@ bool ImageAccess::hasMFAs(string directory)
 }
 int ImageAccess::queryDirPsid(string &path, string &psid, string &selector_tag, int image_type, vector<PsidQueryItem> &riv)
 {
-    int res = 0;
     DIR *d;
     struct dirent *dir;
-    int found = 0;
-    int rc;
+    vector<string> files;
 
     d = opendir(path.c_str());
     if (d == NULL) {
@@ -108,7 +106,6 @@ int ImageAccess::queryDirPsid(string &path, string &psid, string &selector_tag,
     }
 
     while ((dir = readdir(d)) != NULL) {
-        PsidQueryItem ro;
         string fl = dir->d_name;
         if (fl == "." || fl == "..") {
             continue;
@@ -116,11 +113,25 @@ int ImageAccess::queryDirPsid(string &path, string &psid, string &selector_tag,
         string fpath = path;
         fpath += "/";
         fpath += fl;
+        files.push_back(fpath);
+    }
+    closedir(d);
 
-        rc = this->queryPsid(fpath.c_str(), psid, selector_tag, image_type, ro);
+    return queryFilesPsid(files, psid, selector_tag, image_type, riv);
+}
+
+int ImageAccess::queryFilesPsid(const vector<string> &files, string &psid, string &selector_tag, int image_type,
+                                vector<PsidQueryItem> &riv)
+{
+    int res = 0;
+    int found = 0;
+    int rc;
+
+    for (unsigned i = 0; i < files.size(); i++) {
+        PsidQueryItem ro;
+        rc = this->queryPsid(files[i], psid, selector_tag, image_type, ro);
         if (rc < 0) {
-            res = -1;
-            goto clean_up;
+            return -1;
         }
         if (rc == 1) {
             riv.push_back(ro);
@@ -134,8 +145,6 @@ int ImageAccess::queryDirPsid(string &path, string &psid, string &selector_tag,
         res = -2;
     }
 
-clean_up:
-    closedir(d);
     return res;
 }
 
@@ -593,7 +602,9 @@ bool ImageAccess::extract_pldm_image_info(const u_int8_t * buff, u_int32_t size,
 int ImageAccess::get_pldm_content(const string & fname,
         vector<PsidQueryItem> &riv) {
     PldmBuffer pldm_buff;
-    pldm_buff.loadFile(fname);
+    if (!pldm_buff.loadFile(fname)) {
+        return -1;
+    }
     PldmPkg pldm;
     pldm.unpack(pldm_buff);
 
@@ -604,9 +615,13 @@ int ImageAccess::get_pldm_content(const string & fname,
         item.psid = rec->getDevicePsid();
         item.description = rec->getDescription();
         int image_index = rec->getComponentImageIndex();
-        PldmComponenetImage * image_obj = pldm.getComponentImage(image_index);
-        extract_pldm_image_info(image_obj->getComponentData(),
-                image_obj->getComponentSize(), item);
+        if (image_index >= 0 && image_index < pldm.getComponentImageCount()) {
+            PldmComponenetImage * image_obj = pldm.getComponentImage(image_index);
+            if (image_obj->getComponentData()) {
+                extract_pldm_image_info(image_obj->getComponentData(),
+                        image_obj->getComponentSize(), item);
+            }
+        }
         riv.push_back(item);
     }
 
@@ -57,6 +57,9 @@ public:
     ImageAccess(int compareFFV);
     ~ImageAccess();
     int queryDirPsid(string &path, string &psid, string &selector_tag, int image_type, vector<PsidQueryItem> &riv);
+    // like queryDirPsid, over the given files only
+    int queryFilesPsid(const vector<string> &files, string &psid, string &selector_tag, int image_type,
+                       vector<PsidQueryItem> &riv);
     int queryPsid(const string &fname, const string &psid, string &selector_tag, int image_type, PsidQueryItem &ri);
     int getImage(const string &fname, u_int8_t **filebuf);
     int getImage(const string &fname, const string &psid, string &selector_tag, int image_type, u_int8_t **filebuf);
@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2021 Mellanox Technologies Ltd.  All rights reserved.
+ *
+ * This software is available to you under a choice of one of two
+ * licenses.  You may choose to be licensed under the terms of the GNU
+ * General Public License (GPL) Version 2, available from the file
+ * COPYING in the main directory of this source tree, or the
+ * OpenIB.org BSD license below:
+ *
+ *     Redistribution and use in source and binary forms, with or
+ *     without modification, are permitted provided that the following
+ *     conditions are met:
+ *
+ *      - Redistributions of source code must retain the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer.
+ *
+ *      - Redistributions in binary form must reproduce the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer in the documentation and/or other materials
+ *        provided with the distribution.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include <mfa.h>
+
+#include "image_cache.h"
+#include "image_access.h"
+
+#define DEFAULT_IMAGE_CACHE_MB 1024
+
+ImageCache& ImageCache::getInstance()
+{
+    static ImageCache instance;
+    return instance;
+}
+
+
+ImageCache::ImageCache() : _totalSize(0), _maxSize((u_int64_t)DEFAULT_IMAGE_CACHE_MB << 20), _useCounter(0)
+{
+    const char *maxSizeMb = getenv("MLXFWMANAGER_IMAGE_CACHE_MB");
+    if (maxSizeMb) {
+        _maxSize = strtoull(maxSizeMb, NULL, 0) << 20;
+    }
+}
+
+
+ImageCache::~ImageCache()
+{
+    for (map<string, cache_entry_t*>::iterator it = _entries.begin(); it != _entries.end(); it++) {
+        mfa_release_image(it->second->buf);
+        delete it->second;
+    }
+}
+
+
+void ImageCache::setMaxSize(u_int64_t maxSize)
+{
+    mft_utils::MftLockGuard guard(_lock);
+    _maxSize = maxSize;
+    evict();
+}
+
+
+int ImageCache::acquire(const string &mfaPath, const string &psid, const string &selectorTag, int imageType,
+                        u_int8_t **buf, string &errMsg)
+{
+    char typeStr[16];
+    snprintf(typeStr, sizeof(typeStr), "%d", imageType);
+    string key = mfaPath + '\0' + psid + '\0' + typeStr + '\0' + selectorTag;
+    cache_entry_t *entry;
+
+    _lock.lock();
+    map<string, cache_entry_t*>::iterator it = _entries.find(key);
+    if (it != _entries.end()) {
+        entry = it->second;
+        entry->refCount++;
+        while (entry->loading) {
+            _loaded.wait(_lock);
+        }
+        if (entry->detached) {
+            // the extraction failed
+            errMsg = entry->errMsg;
+            putEntry(entry);
+            _lock.unlock();
+            return -1;
+        }
+        entry->lastUse = ++_useCounter;
+        *buf = entry->buf;
+        _lock.unlock();
+        return entry->size;
+    }
+
+    entry = new cache_entry_t;
+    entry->key = key;
+    entry->buf = NULL;
+    entry->size = 0;
+    entry->refCount = 1;
+    entry->loading = true;
+    entry->detached = false;
+    entry->lastUse = ++_useCounter;
+    _entries[key] = entry;
+    _lock.unlock();
+
+    // extract outside of the lock, other entries can be served meanwhile
+    ImageAccess imgacc(0);
+    string tag = selectorTag;
+    u_int8_t *data = NULL;
+    int size = imgacc.getImage(mfaPath, psid, tag, imageType, &data);
+
+    _lock.lock();
+    entry->loading = false;
+    if (size < 0) {
+        entry->errMsg = "Failed to get the image of " + psid + " from " + mfaPath;
+        entry->detached = true;
+        _entries.erase(key);
+        errMsg = entry->errMsg;
+        putEntry(entry);
+        _loaded.broadcast();
+        _lock.unlock();
+        return -1;
+    }
+    entry->buf = data;
+    entry->size = size;
+    _entriesByBuf[data] = entry;
+    _totalSize += size;
+    *buf = data;
+    _loaded.broadcast();
+    evict();
+    _lock.unlock();
+    return size;
+}
+
+
+void ImageCache::release(u_int8_t *buf)
+{
+    mft_utils::MftLockGuard guard(_lock);
+    map<u_int8_t*, cache_entry_t*>::iterator it = _entriesByBuf.find(buf);
+    if (it == _entriesByBuf.end()) {
+        return;
+    }
+    it->second->lastUse = ++_useCounter;
+    putEntry(it->second);
+    evict();
+}
+
+
+// must be called with _lock held
+void ImageCache::putEntry(cache_entry_t *entry)
+{
+    entry->refCount--;
+    if (entry->refCount == 0 && entry->detached) {
+        if (entry->buf) {
+            _entriesByBuf.erase(entry->buf);
+            _totalSize -= entry->size;
+            mfa_release_image(entry->buf);
+        }
+        delete entry;
+    }
+}
+
+
+// must be called with _lock held, drops the least recently used unreferenced entries
+void ImageCache::evict()
+{
+    while (_totalSize > _maxSize) {
+        cache_entry_t *lru = NULL;
+        for (map<string, cache_entry_t*>::iterator it = _entries.begin(); it != _entries.end(); it++) {
+            cache_entry_t *entry = it->second;
+            if (entry->refCount || entry->loading) {
+                continue;
+            }
+            if (!lru || entry->lastUse < lru->lastUse) {
+                lru = entry;
+            }
+        }
+        if (!lru) {
+            break;
+        }
+        _entries.erase(lru->key);
+        lru->detached = true;
+        lru->refCount++;
+        putEntry(lru);
+    }
+}
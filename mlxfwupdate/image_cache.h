@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2021 Mellanox Technologies Ltd.  All rights reserved.
+ *
+ * This software is available to you under a choice of one of two
+ * licenses.  You may choose to be licensed under the terms of the GNU
+ * General Public License (GPL) Version 2, available from the file
+ * COPYING in the main directory of this source tree, or the
+ * OpenIB.org BSD license below:
+ *
+ *     Redistribution and use in source and binary forms, with or
+ *     without modification, are permitted provided that the following
+ *     conditions are met:
+ *
+ *      - Redistributions of source code must retain the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer.
+ *
+ *      - Redistributions in binary form must reproduce the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer in the documentation and/or other materials
+ *        provided with the distribution.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef __IMAGE_CACHE_H__
+#define __IMAGE_CACHE_H__
+
+#include <map>
+#include <string>
+#include <compatibility.h>
+#include <mft_thread_pool.h>
+
+using namespace std;
+
+/*
+ * Process wide cache of images extracted from MFA archives, keyed by archive
+ * path, board type ID, image type and selector tag. Devices that take their
+ * image from the same archive entry share one decompressed buffer, concurrent
+ * requests for an entry wait for the single extraction in flight. Unreferenced
+ * entries are evicted in LRU order once the cache grows over its size limit
+ * (MLXFWMANAGER_IMAGE_CACHE_MB, default 1024).
+ */
+class ImageCache {
+public:
+    static ImageCache& getInstance();
+    // returns the image size and a buffer that stays valid until release(), -1 on error
+    int  acquire(const string &mfaPath, const string &psid, const string &selectorTag, int imageType,
+                 u_int8_t **buf, string &errMsg);
+    void release(u_int8_t *buf);
+    void setMaxSize(u_int64_t maxSize);
+
+private:
+    typedef struct cache_entry {
+        string key;
+        u_int8_t *buf;
+        int size;
+        int refCount;
+        bool loading;
+        bool detached;
+        string errMsg;
+        u_int64_t lastUse;
+    } cache_entry_t;
+
+    ImageCache();
+    ~ImageCache();
+    ImageCache(const ImageCache&);
+    ImageCache& operator=(const ImageCache&);
+    void putEntry(cache_entry_t *entry);
+    void evict();
+
+    map<string, cache_entry_t*> _entries;
+    map<u_int8_t*, cache_entry_t*> _entriesByBuf;
+    u_int64_t _totalSize;
+    u_int64_t _maxSize;
+    u_int64_t _useCounter;
+    mft_utils::MftMutex _lock;
+    mft_utils::MftCondition _loaded;
+};
+
+#endif
@@ -0,0 +1,249 @@
+/*
+ * Copyright (c) 2021 Mellanox Technologies Ltd.  All rights reserved.
+ *
+ * This software is available to you under a choice of one of two
+ * licenses.  You may choose to be licensed under the terms of the GNU
+ * General Public License (GPL) Version 2, available from the file
+ * COPYING in the main directory of this source tree, or the
+ * OpenIB.org BSD license below:
+ *
+ *     Redistribution and use in source and binary forms, with or
+ *     without modification, are permitted provided that the following
+ *     conditions are met:
+ *
+ *      - Redistributions of source code must retain the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer.
+ *
+ *      - Redistributions in binary form must reproduce the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer in the documentation and/or other materials
+ *        provided with the distribution.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <fstream>
+#include <sstream>
+#include <mft_thread_pool.h>
+
+#include "image_index.h"
+#include "image_access.h"
+
+#define IMAGE_INDEX_MAGIC "MLXFWMANAGER_INDEX 1"
+
+// modification time in ns where the platform has it, so rewrites within a second are still noticed
+static int64_t fileMtime(const struct stat &st)
+{
+#if defined(__linux__)
+    return (int64_t)st.st_mtim.tv_sec * 1000000000 + st.st_mtim.tv_nsec;
+#else
+    return (int64_t)st.st_mtime;
+#endif
+}
+
+
+ImageIndex::ImageIndex(const string &dir) : _dir(dir), _numRescanned(0), _modified(false)
+{
+    _indexPath = _dir + "/" + IMAGE_INDEX_FILE_NAME;
+}
+
+
+/*
+ * Index file format, one record per line:
+ *   F <size> <mtime> <indexed> <file name>
+ *   P <psid> <version>      (PSIDs of the preceding F record)
+ */
+void ImageIndex::load()
+{
+    ifstream in(_indexPath.c_str());
+    string line;
+    index_entry_t *entry = NULL;
+
+    if (!in.good() || !getline(in, line) || line != IMAGE_INDEX_MAGIC) {
+        return;
+    }
+    while (getline(in, line)) {
+        istringstream iss(line);
+        string tag;
+        iss >> tag;
+        if (tag == "F") {
+            index_entry_t e;
+            int indexed = 0;
+            iss >> e.size >> e.mtime >> indexed;
+            iss.get();
+            if (iss.fail() || !getline(iss, e.name) || e.name.empty()) {
+                entry = NULL;
+                continue;
+            }
+            e.indexed = indexed != 0;
+            entry = &(_entries[e.name] = e);
+        } else if (tag == "P" && entry) {
+            index_psid_t p;
+            iss >> p.psid >> p.version;
+            if (!p.psid.empty()) {
+                entry->psids.push_back(p);
+            }
+        }
+    }
+}
+
+
+void ImageIndex::scanJob(void *ctx, u_int32_t jobIdx)
+{
+    index_entry_t *entry = ((ImageIndex*)ctx)->_toScan[jobIdx];
+    string fpath = ((ImageIndex*)ctx)->_dir + "/" + entry->name;
+    int type = ImageAccess::getFileSignature(fpath);
+    vector<PsidQueryItem> items;
+    ImageAccess imgacc(0);
+
+    entry->indexed = false;
+    entry->psids.clear();
+    if (type != IMG_SIG_TYPE_MFA && type != IMG_SIG_TYPE_BIN) {
+        return;
+    }
+    if (imgacc.get_file_content(fpath, items)) {
+        return;
+    }
+    for (unsigned i = 0; i < items.size(); i++) {
+        index_psid_t p;
+        p.psid = items[i].psid;
+        p.version = "-";
+        const ImgVersion *fwVer = items[i].findImageVersion("FW");
+        if (fwVer) {
+            p.version = ((ImgVersion*)fwVer)->getPrintableVersion(0, false);
+        }
+        entry->psids.push_back(p);
+    }
+    entry->indexed = true;
+}
+
+
+bool ImageIndex::refresh(int numThreads, string &errMsg, bool rescan)
+{
+    DIR *d;
+    struct dirent *dir;
+    map<string, index_entry_t> current;
+
+    load();
+    d = opendir(_dir.c_str());
+    if (d == NULL) {
+        errMsg = "-E- Failed to open directory: " + _dir + "\n";
+        return false;
+    }
+    while ((dir = readdir(d)) != NULL) {
+        string fl = dir->d_name;
+        struct stat st;
+        // skip the index itself and temporary files of concurrent writers
+        if (fl == "." || fl == ".." || fl.compare(0, strlen(IMAGE_INDEX_FILE_NAME), IMAGE_INDEX_FILE_NAME) == 0) {
+            continue;
+        }
+        if (stat((_dir + "/" + fl).c_str(), &st) || !S_ISREG(st.st_mode)) {
+            continue;
+        }
+        map<string, index_entry_t>::iterator it = _entries.find(fl);
+        if (it != _entries.end() && it->second.size == (u_int64_t)st.st_size &&
+            it->second.mtime == fileMtime(st)) {
+            current[fl] = it->second;
+            continue;
+        }
+        index_entry_t &e = current[fl];
+        e.name = fl;
+        e.size = st.st_size;
+        e.mtime = fileMtime(st);
+        e.indexed = false;
+    }
+    closedir(d);
+
+    _modified = current.size() != _entries.size();
+    _entries.swap(current);
+    _toScan.clear();
+    for (map<string, index_entry_t>::iterator it = _entries.begin(); it != _entries.end(); it++) {
+        map<string, index_entry_t>::iterator old = current.find(it->first);
+        if (old == current.end() || old->second.size != it->second.size || old->second.mtime != it->second.mtime) {
+            _toScan.push_back(&it->second);
+        }
+    }
+    if (!rescan) {
+        _toScan.clear();
+    }
+    _numRescanned = _toScan.size();
+    if (_numRescanned) {
+        mft_utils::MftThreadPool pool(numThreads);
+        pool.run(_toScan.size(), scanJob, this);
+        _modified = true;
+    }
+    _toScan.clear();
+    return true;
+}
+
+
+bool ImageIndex::save(string &errMsg)
+{
+    if (!_modified) {
+        return true;
+    }
+    ostringstream tmpPath;
+    tmpPath << _indexPath << ".tmp." << getpid();
+    ofstream out(tmpPath.str().c_str());
+    if (!out.good()) {
+        errMsg = "-E- Failed to write image index: " + tmpPath.str() + "\n";
+        return false;
+    }
+    out << IMAGE_INDEX_MAGIC << "\n";
+    for (map<string, index_entry_t>::const_iterator it = _entries.begin(); it != _entries.end(); it++) {
+        const index_entry_t &e = it->second;
+        out << "F " << e.size << " " << e.mtime << " " << (e.indexed ? 1 : 0) << " " << e.name << "\n";
+        for (unsigned i = 0; i < e.psids.size(); i++) {
+            out << "P " << e.psids[i].psid << " " << e.psids[i].version << "\n";
+        }
+    }
+    out.close();
+    // concurrent runs each write their own file, the last rename wins
+    if (out.fail() || rename(tmpPath.str().c_str(), _indexPath.c_str())) {
+        remove(tmpPath.str().c_str());
+        errMsg = "-E- Failed to write image index: " + _indexPath + "\n";
+        return false;
+    }
+    _modified = false;
+    return true;
+}
+
+
+void ImageIndex::getCandidates(const string &psid, vector<string> &files) const
+{
+    for (map<string, index_entry_t>::const_iterator it = _entries.begin(); it != _entries.end(); it++) {
+        const index_entry_t &e = it->second;
+        bool match = !e.indexed;
+        for (unsigned i = 0; !match && i < e.psids.size(); i++) {
+            match = e.psids[i].psid == psid;
+        }
+        if (match) {
+            files.push_back(_dir + "/" + e.name);
+        }
+    }
+}
+
+
+u_int32_t ImageIndex::getNumIndexed() const
+{
+    u_int32_t num = 0;
+    for (map<string, index_entry_t>::const_iterator it = _entries.begin(); it != _entries.end(); it++) {
+        if (it->second.indexed) {
+            num++;
+        }
+    }
+    return num;
+}
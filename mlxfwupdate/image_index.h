@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2021 Mellanox Technologies Ltd.  All rights reserved.
+ *
+ * This software is available to you under a choice of one of two
+ * licenses.  You may choose to be licensed under the terms of the GNU
+ * General Public License (GPL) Version 2, available from the file
+ * COPYING in the main directory of this source tree, or the
+ * OpenIB.org BSD license below:
+ *
+ *     Redistribution and use in source and binary forms, with or
+ *     without modification, are permitted provided that the following
+ *     conditions are met:
+ *
+ *      - Redistributions of source code must retain the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer.
+ *
+ *      - Redistributions in binary form must reproduce the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer in the documentation and/or other materials
+ *        provided with the distribution.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef __IMAGE_INDEX_H__
+#define __IMAGE_INDEX_H__
+
+#include <map>
+#include <string>
+#include <vector>
+#include <compatibility.h>
+
+using namespace std;
+
+#define IMAGE_INDEX_FILE_NAME ".mlxfwmanager_index"
+
+/*
+ * Index of the board types (PSIDs) held by every image file of an image
+ * directory, kept in IMAGE_INDEX_FILE_NAME next to the images. An entry is
+ * trusted as long as the file size and mtime it was built from still match,
+ * so only new or changed files have to be opened to find the files holding a
+ * PSID. Files the index cannot describe (e.g. PLDM packages or files that
+ * failed to parse) are always reported as candidates. Only --build-index
+ * writes the index, queries use it read-only.
+ */
+class ImageIndex {
+public:
+    ImageIndex(const string &dir);
+    // loads the index file and rescans new and changed files on numThreads threads (0: one per CPU),
+    // without rescan they are left unindexed and so reported as candidates
+    bool refresh(int numThreads, string &errMsg, bool rescan = true);
+    // writes the index back if refresh() changed it
+    bool save(string &errMsg);
+    void getCandidates(const string &psid, vector<string> &files) const;
+    u_int32_t getNumFiles() const { return _entries.size(); }
+    u_int32_t getNumRescanned() const { return _numRescanned; }
+    u_int32_t getNumIndexed() const;
+
+private:
+    typedef struct index_psid {
+        string psid;
+        string version;
+    } index_psid_t;
+
+    typedef struct index_entry {
+        string name;
+        u_int64_t size;
+        int64_t mtime;
+        bool indexed;
+        vector<index_psid_t> psids;
+    } index_entry_t;
+
+    void load();
+    static void scanJob(void *ctx, u_int32_t jobIdx);
+
+    string _dir;
+    string _indexPath;
+    map<string, index_entry_t> _entries;
+    vector<index_entry_t*> _toScan;
+    u_int32_t _numRescanned;
+    bool _modified;
+};
+
+#endif
@@ -43,6 +43,7 @@
 #include <stdio.h>
 #include <string.h>
 #include "image_access.h"
+#include "image_cache.h"
 #include "mvpd/mvpd.h"
 
 #if !defined(__WIN__) && !defined(__FreeBSD__)
@@ -498,11 +499,22 @@ int MlnxDev::preBurn(string mfa_file, f_prog_func prog_cb, bool burnFailsafe,
     memset(&dev_fw_query, 0, sizeof(dev_fw_query));
     memset(&img_fw_query, 0, sizeof(img_fw_query));
     _burnSuccess = 0;
-    int sza = imgacc.getImage(mfa_file, &filebuf);
-    if (sza < 0) {
-        _errMsg = imgacc.getLastErrMsg();
-        _log    += imgacc.getLog();
-        return -1;
+    // MFA images are shared with the other devices that burn the same archive entry
+    bool cachedImage = ImageAccess::getFileSignature(mfa_file) == IMG_SIG_TYPE_MFA;
+    int sza;
+    if (cachedImage) {
+        sza = ImageCache::getInstance().acquire(mfa_file, _psid, "", 1, &filebuf, _errMsg);
+        if (sza < 0) {
+            _log += _errMsg;
+            return -1;
+        }
+    } else {
+        sza = imgacc.getImage(mfa_file, &filebuf);
+        if (sza < 0) {
+            _errMsg = imgacc.getLastErrMsg();
+            _log    += imgacc.getLog();
+            return -1;
+        }
     }
 
     if (!openImg((u_int32_t*)filebuf, (u_int32_t)sza)) {
@@ -573,7 +585,7 @@ int MlnxDev::preBurn(string mfa_file, f_prog_func prog_cb, bool burnFailsafe,
 
     _preBurnInit = true;
     UnlockDevice(_devFwOps);
-    free(filebuf);
+    releaseImage(filebuf, cachedImage);
     return 0;
 
 clean_up_on_error:
@@ -588,10 +600,19 @@ clean_up_on_error:
         delete _imgFwOps;
         _imgFwOps = NULL;
     }
-    free(filebuf);
+    releaseImage(filebuf, cachedImage);
     return -1;
 }
 
+void MlnxDev::releaseImage(u_int8_t *filebuf, bool cachedImage)
+{
+    if (cachedImage) {
+        ImageCache::getInstance().release(filebuf);
+    } else {
+        free(filebuf);
+    }
+}
+
 int MlnxDev::burn(bool& imageWasCached)
 {
     int res = 0, rc = 0;
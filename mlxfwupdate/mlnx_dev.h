@@ -110,6 +110,7 @@ private:
     int  queryFwops();
     bool OpenDev();
     bool openImg(u_int32_t *fileBuffer, u_int32_t bufferSize);
+    void releaseImage(u_int8_t *filebuf, bool cachedImage);
     port_type_t findPortType(int port);
     void initUniqueId();
     bool equals(MlnxDev *dev);
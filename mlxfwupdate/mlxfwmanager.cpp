@@ -34,6 +34,7 @@
 
 
 #include "mlxfwmanager.h"
+#include "mft_utils.h"
 #ifdef _MSC_VER
 #include <direct.h>
 #include <dirent.h>
@@ -90,6 +91,10 @@ int mainEntry(int argc, char *argv[])
     int (*progressCB)(int);
     int (*advProgressCB)(int, const char*, prog_t, void*);
     ServerRequest *srq = NULL;
+    vector<MlnxDev*> *queryDevs = NULL;
+    vector<string> queryDevNames;
+    vector<bool> queryTimedOut;
+    bool queryAbandoned = false;
     initHandler();
     CmdLineParser cmdParser(&cmd_params, argv, argc);
     logDir = getLogDir(toolName);
@@ -167,6 +172,7 @@ int mainEntry(int argc, char *argv[])
             res = ERR_CODE_CREATE_OUTPUT_FILE_FAIL;
             goto early_err_clean_up;
         }
+        InterruptOutFd = fileno(FOut);
     }
     if (cmd_params.download_os.length()) {
         IS_OKAY_To_INTERRUPT = true;
@@ -213,6 +219,11 @@ int mainEntry(int argc, char *argv[])
         goto clean_up;
     }
 
+    if (cmd_params.build_index) {
+        res = build_image_index(cmd_params, config);
+        goto clean_up;
+    }
+
     if (cmd_params.extract_all) {
         IS_OKAY_To_INTERRUPT = true;
         res = extract_all(cmd_params, config, srq);
@@ -298,6 +309,7 @@ int mainEntry(int argc, char *argv[])
 
     //Query all Devs
     print_out("Querying Mellanox devices firmware ...\n");
+    queryDevs = new vector<MlnxDev*>();
     for (int i = 0; i < devs_num; i++) {
         MlnxDev *dev;
         if (cmd_params.device_names.size()) {
@@ -319,7 +331,20 @@ int mainEntry(int argc, char *argv[])
         if (cmd_params.no_fw_ctrl) {
             dev->setNoFwCtrl();
         }
-        dev->query();
+        queryDevs->push_back(dev);
+        queryDevNames.push_back(dev->getDevName());
+    }
+    queryDevices(queryDevs, cmd_params, queryTimedOut);
+    // results are handled in the original device order, whatever order the queries completed in
+    for (int i = 0; i < (int)queryDevs->size(); i++) {
+        MlnxDev *dev = (*queryDevs)[i];
+        if (queryTimedOut[i]) {
+            // the query is still running on a detached thread, the device object must stay alive
+            print_err("-E- Query of device %s timed out after %d seconds\n", queryDevNames[i].c_str(), cmd_params.query_timeout);
+            res = ERR_CODE_QUERY_FAILED;
+            queryAbandoned = true;
+            continue;
+        }
         if (!dev->isQuerySuccess()) {
             res = ERR_CODE_QUERY_FAILED;
         } else {
@@ -354,7 +379,8 @@ int mainEntry(int argc, char *argv[])
         } else if (cmd_params.use_mfa_file) {
             mpath = adjustRelPath(cmd_params.mfa_file, config.adjuster_path);
         }
-        rc = queryMFAs(srq, mpath, psid_list, dev_types_list, psidUpdateInfo, cmd_params.update_online, errorMsg, fw_version_list);
+        rc = queryMFAs(srq, mpath, psid_list, dev_types_list, psidUpdateInfo, cmd_params.update_online, errorMsg, fw_version_list,
+                       !cmd_params.no_index, cmd_params.query_threads);
         if (rc < 0) {
             //print_err("-E- No relevant image files or info could be found\n");
             err_continue++;
@@ -459,41 +485,43 @@ int mainEntry(int argc, char *argv[])
             }
         }
     }
-    for (int i = 0; i < (int)devs.size(); i++) {
-        if (status_strings[i].size() != 0) {
-            print_out("Device #%d: %s\n", (i + 1), status_strings[i].c_str());
-            continue;
-        } else {
-            print_out("Device #%d: %s", (i + 1), "Updating FW ...     \n");
-        }
-        burn_cnt++;
-        string mfa_file = config.mfa_path;
-        string tmp = psidUpdateInfo[devs[i]->getPsid()].url;
-        if (!cmd_params.use_mfa_file) {
-            size_t pos = tmp.rfind("/");
-            if (pos != string::npos) {
-                tmp = tmp.substr(pos + 1);
-            }
-            mfa_file += "/";
-            mfa_file += tmp;
-        } else {
-            mfa_file = tmp;
+    if (cmd_params.parallel_burns > 1) {
+        // preBurn and its questions stay on this thread, only the burns themselves run in parallel
+        vector<int> burnDevs;
+        int (*parallelProgressCB)(int) = progressCB_nodisplay;
+        int (*parallelAdvProgressCB)(int, const char*, prog_t, void*) = NULL;
+        if (cmd_params.show_progress || cmd_params.json_progress) {
+            parallelProgressCB = progressCB_parallel;
+            parallelAdvProgressCB = (f_prog_func_adv) & advProgressFunc_parallel;
         }
-        bool imageWasCached = false;
-        vector<string> questions;
-        bool isTimeConsumingFixesNeeded = false;
-        rc0 = devs[i]->preBurn(mfa_file, progressCB, cmd_params.burnFailsafe,
-                               isTimeConsumingFixesNeeded, questions, advProgressCB);
-        if (rc0) {
-            if (abort_request) {
-                print_out("\b\b\b\bInterrupted\n");
-                res = ERR_CODE_INTERRUPTED;
-                devs[i]->clearSemaphore();
-                goto early_err_clean_up;
-            } else {
-                print_out("\b\b\b\bFail : %s \n", devs[i]->getLastErrMsg().c_str());
+        initParallelProgress(devs.size(), cmd_params.json_progress);
+        for (int i = 0; i < (int)devs.size(); i++) {
+            if (status_strings[i].size() != 0) {
+                print_out("Device #%d: %s\n", (i + 1), status_strings[i].c_str());
+                continue;
+            }
+            print_out("Device #%d: %s", (i + 1), "Preparing FW update ...\n");
+            burn_cnt++;
+            string mfa_file = getDevMfaFile(devs[i], config, cmd_params, psidUpdateInfo);
+            vector<string> questions;
+            bool isTimeConsumingFixesNeeded = false;
+            setParallelProgressDev(i);
+            rc0 = devs[i]->preBurn(mfa_file, parallelProgressCB, cmd_params.burnFailsafe,
+                                   isTimeConsumingFixesNeeded, questions, parallelAdvProgressCB);
+            if (rc0) {
+                if (abort_request) {
+                    print_out("Device #%d: Interrupted\n", (i + 1));
+                    res = ERR_CODE_INTERRUPTED;
+                    devs[i]->clearSemaphore();
+                    goto early_err_clean_up;
+                }
+                print_out("Device #%d: Fail : %s \n", (i + 1), devs[i]->getLastErrMsg().c_str());
+                rc |= rc0;
+                if (FLog != NULL) {
+                    fprintf(FLog, "%s\n", devs[i]->getLog().c_str());
+                }
+                continue;
             }
-        } else {
             for (unsigned int questionIndex = 0; questionIndex < questions.size(); questionIndex++) {
                 print_out("%s", questions[questionIndex].c_str());
                 int answer = prompt("Perform update? [y/N]: ", cmd_params.yes_no_);
@@ -502,17 +530,33 @@ int mainEntry(int argc, char *argv[])
                     goto clean_up;
                 }
             }
-            if (isTimeConsumingFixesNeeded) {
-                print_out("Preparing...\n");
-            }
-            rc0 = devs[i]->burn(imageWasCached);
-            if (!rc0) {
-                print_out("\b\b\b\bDone\n");
-                burn_success_cnt++;
-                if (imageWasCached) {
-                    print_out("Image was successfully cached by driver.\n");
-                }
+            burnDevs.push_back(i);
+        }
+        setParallelProgressDev(-1);
+        if (burnDevs.size()) {
+            print_out("Updating FW on %d device(s) ...\n", (int)burnDevs.size());
+        }
+        rc |= burnDevicesInParallel(devs, burnDevs, cmd_params, burn_success_cnt);
+        if (abort_request) {
+            res = ERR_CODE_INTERRUPTED;
+            goto early_err_clean_up;
+        }
+    } else {
+        for (int i = 0; i < (int)devs.size(); i++) {
+            if (status_strings[i].size() != 0) {
+                print_out("Device #%d: %s\n", (i + 1), status_strings[i].c_str());
+                continue;
             } else {
+                print_out("Device #%d: %s", (i + 1), "Updating FW ...     \n");
+            }
+            burn_cnt++;
+            string mfa_file = getDevMfaFile(devs[i], config, cmd_params, psidUpdateInfo);
+            bool imageWasCached = false;
+            vector<string> questions;
+            bool isTimeConsumingFixesNeeded = false;
+            rc0 = devs[i]->preBurn(mfa_file, progressCB, cmd_params.burnFailsafe,
+                                   isTimeConsumingFixesNeeded, questions, advProgressCB);
+            if (rc0) {
                 if (abort_request) {
                     print_out("\b\b\b\bInterrupted\n");
                     res = ERR_CODE_INTERRUPTED;
@@ -521,11 +565,40 @@ int mainEntry(int argc, char *argv[])
                 } else {
                     print_out("\b\b\b\bFail : %s \n", devs[i]->getLastErrMsg().c_str());
                 }
+            } else {
+                for (unsigned int questionIndex = 0; questionIndex < questions.size(); questionIndex++) {
+                    print_out("%s", questions[questionIndex].c_str());
+                    int answer = prompt("Perform update? [y/N]: ", cmd_params.yes_no_);
+                    if (!answer) {
+                        print_out("No updates performed\n");
+                        goto clean_up;
+                    }
+                }
+                if (isTimeConsumingFixesNeeded) {
+                    print_out("Preparing...\n");
+                }
+                rc0 = devs[i]->burn(imageWasCached);
+                if (!rc0) {
+                    print_out("\b\b\b\bDone\n");
+                    burn_success_cnt++;
+                    if (imageWasCached) {
+                        print_out("Image was successfully cached by driver.\n");
+                    }
+                } else {
+                    if (abort_request) {
+                        print_out("\b\b\b\bInterrupted\n");
+                        res = ERR_CODE_INTERRUPTED;
+                        devs[i]->clearSemaphore();
+                        goto early_err_clean_up;
+                    } else {
+                        print_out("\b\b\b\bFail : %s \n", devs[i]->getLastErrMsg().c_str());
+                    }
+                }
+            }
+            rc |= rc0;
+            if (FLog != NULL) {
+                fprintf(FLog, "%s\n", devs[i]->getLog().c_str());
             }
-        }
-        rc |= rc0;
-        if (FLog != NULL) {
-            fprintf(FLog, "%s\n", devs[i]->getLog().c_str());
         }
     }
 
@@ -587,14 +660,210 @@ early_err_clean_up:
         }
     }
 
-    mdevices_info_destroy(devsinfo, devs_num);
-
     for (int i = 0; i < (int)devs.size(); i++) {
         delete devs[i];
     }
+    // abandoned queries may still use the devices info and the query list
+    if (!queryAbandoned) {
+        mdevices_info_destroy(devsinfo, devs_num);
+        if (queryDevs) {
+            delete queryDevs;
+        }
+    }
     return mapRetValue(res, config.setupType);
 }
 
+static void queryDevJob(void *ctx, u_int32_t jobIdx)
+{
+    vector<MlnxDev*> *queryDevs = (vector<MlnxDev*>*)ctx;
+    (*queryDevs)[jobIdx]->query();
+}
+
+void queryDevices(vector<MlnxDev*> *queryDevs, CmdLineParams &cmd_params, vector<bool> &timedOut)
+{
+    mft_utils::MftThreadPool pool(cmd_params.query_threads);
+    pool.runWithTimeout(queryDevs->size(), queryDevJob, queryDevs, cmd_params.query_timeout, timedOut);
+}
+
+string getDevMfaFile(MlnxDev *dev, config_t &config, CmdLineParams &cmd_params, map<string, PsidQueryItem> &psidUpdateInfo)
+{
+    string mfa_file = config.mfa_path;
+    string tmp = psidUpdateInfo[dev->getPsid()].url;
+    if (!cmd_params.use_mfa_file) {
+        size_t pos = tmp.rfind("/");
+        if (pos != string::npos) {
+            tmp = tmp.substr(pos + 1);
+        }
+        mfa_file += "/";
+        mfa_file += tmp;
+    } else {
+        mfa_file = tmp;
+    }
+    return mfa_file;
+}
+
+/*
+ * Returns the PCI function (dddd:bb:dd.f) the device resolves to, or "" when it
+ * is not a PCI device. Devices given by name are opened to resolve them, so that
+ * an mst device and the BDF of the same function are recognized as one device.
+ */
+static string getPciFunction(MlnxDev *dev)
+{
+    char bdf[32] = {0};
+    dev_info *devInfo = dev->getDevInfo();
+    if (devInfo && (devInfo->type & MDEVS_TAVOR_CR)) {
+        snprintf(bdf, sizeof(bdf), "%04x:%02x:%02x.%x", devInfo->pci.domain, devInfo->pci.bus, devInfo->pci.dev, devInfo->pci.func);
+        return bdf;
+    }
+#ifndef __WIN__
+    mfile *mf = mopen(dev->getDevName().c_str());
+    if (mf == NULL) {
+        return bdf;
+    }
+    if (mf->dinfo && (mf->dinfo->type & MDEVS_TAVOR_CR)) {
+        snprintf(bdf, sizeof(bdf), "%04x:%02x:%02x.%x", mf->dinfo->pci.domain, mf->dinfo->pci.bus, mf->dinfo->pci.dev, mf->dinfo->pci.func);
+    }
+    mclose(mf);
+#endif
+    return bdf;
+}
+
+/*
+ * Functions of the same PCI device (or mst devices that differ only by the
+ * function suffix, e.g. mt4119_pciconf0 and mt4119_pciconf0.1) share a flash,
+ * so they must never be burned at the same time.
+ */
+static string getFlashGroupKey(MlnxDev *dev, const string &pciFunction)
+{
+    if (pciFunction.size()) {
+        return pciFunction.substr(0, pciFunction.rfind('.'));
+    }
+    string key = dev->getDevName();
+    size_t pos = key.rfind('.');
+    if (pos != string::npos && pos + 1 < key.size() &&
+        key.find_first_not_of("0123456789", pos + 1) == string::npos) {
+        key = key.substr(0, pos);
+    }
+    return key;
+}
+
+typedef struct parallel_burn_ctx {
+    vector<MlnxDev*> *devs;
+    vector<vector<int> > groups;
+    vector<int> burnRc;
+    vector<u_int8_t> imageCached;
+    vector<u_int8_t> burnStarted;
+} parallel_burn_ctx_t;
+
+static void burnFlashGroupJob(void *ctx, u_int32_t jobIdx)
+{
+    parallel_burn_ctx_t *burnCtx = (parallel_burn_ctx_t*)ctx;
+    vector<int> &group = burnCtx->groups[jobIdx];
+    for (unsigned int i = 0; i < group.size(); i++) {
+        int devIdx = group[i];
+        if (abort_request) {
+            break;
+        }
+        bool imageWasCached = false;
+        setParallelProgressDev(devIdx);
+        burnCtx->burnStarted[devIdx] = 1;
+        burnCtx->burnRc[devIdx] = (*burnCtx->devs)[devIdx]->burn(imageWasCached);
+        burnCtx->imageCached[devIdx] = imageWasCached ? 1 : 0;
+    }
+    setParallelProgressDev(-1);
+}
+
+/*
+ * Burns the devices in burnDevs (indexes into devs, already pre-burned) with up
+ * to cmd_params.parallel_burns concurrent burns. A failing device does not stop
+ * the others, the results are reported in device order once all burns are done.
+ */
+int burnDevicesInParallel(vector<MlnxDev*> &devs, vector<int> &burnDevs, CmdLineParams &cmd_params, int &burn_success_cnt)
+{
+    int rc = 0;
+    parallel_burn_ctx_t burnCtx;
+    map<string, int> groupIdx;
+    map<string, int> functionOwner;
+    // device locking is a no-op on Linux, a function given twice (e.g. by mst name and by BDF) is burned once
+    vector<int> sameAs(devs.size(), -1);
+    burnCtx.devs = &devs;
+    burnCtx.burnRc.resize(devs.size(), -1);
+    burnCtx.imageCached.resize(devs.size(), 0);
+    burnCtx.burnStarted.resize(devs.size(), 0);
+    for (unsigned int i = 0; i < burnDevs.size(); i++) {
+        string pciFunction = getPciFunction(devs[burnDevs[i]]);
+        if (pciFunction.size()) {
+            map<string, int>::iterator owner = functionOwner.find(pciFunction);
+            if (owner != functionOwner.end()) {
+                sameAs[burnDevs[i]] = owner->second;
+                continue;
+            }
+            functionOwner[pciFunction] = burnDevs[i];
+        }
+        string key = getFlashGroupKey(devs[burnDevs[i]], pciFunction);
+        map<string, int>::iterator it = groupIdx.find(key);
+        if (it == groupIdx.end()) {
+            groupIdx[key] = burnCtx.groups.size();
+            burnCtx.groups.push_back(vector<int>());
+            burnCtx.groups.back().push_back(burnDevs[i]);
+        } else {
+            burnCtx.groups[it->second].push_back(burnDevs[i]);
+        }
+    }
+    if (burnCtx.groups.size()) {
+        mft_utils::MftThreadPool pool(cmd_params.parallel_burns);
+        pool.run(burnCtx.groups.size(), burnFlashGroupJob, &burnCtx);
+    }
+
+    for (unsigned int i = 0; i < burnDevs.size(); i++) {
+        int devIdx = burnDevs[i];
+        MlnxDev *dev = devs[devIdx];
+        MlnxDev *burnedDev = dev;
+        if (sameAs[devIdx] >= 0) {
+            int ownerIdx = sameAs[devIdx];
+            burnedDev = devs[ownerIdx];
+            burnCtx.burnRc[devIdx] = burnCtx.burnRc[ownerIdx];
+            burnCtx.imageCached[devIdx] = burnCtx.imageCached[ownerIdx];
+            if (!cmd_params.json_progress) {
+                print_out("Device #%d: Same device as #%d, burned once\n", devIdx + 1, ownerIdx + 1);
+            }
+        }
+        int rc0 = burnCtx.burnRc[devIdx];
+        string status;
+        string msg;
+        if (!rc0) {
+            status = "done";
+            burn_success_cnt++;
+        } else if (abort_request) {
+            status = "interrupted";
+            if (burnCtx.burnStarted[devIdx]) {
+                dev->clearSemaphore();
+            }
+        } else {
+            status = "failed";
+            msg = burnedDev->getLastErrMsg();
+        }
+        if (cmd_params.json_progress) {
+            print_out("{\"device\":%d,\"status\":\"%s\",\"cached\":%s,\"message\":\"%s\"}\n", devIdx + 1, status.c_str(),
+                      burnCtx.imageCached[devIdx] ? "true" : "false", mft_utils::json_escape(msg).c_str());
+        } else if (!rc0) {
+            print_out("Device #%d: Done\n", devIdx + 1);
+            if (burnCtx.imageCached[devIdx]) {
+                print_out("Image was successfully cached by driver.\n");
+            }
+        } else if (abort_request) {
+            print_out("Device #%d: Interrupted\n", devIdx + 1);
+        } else {
+            print_out("Device #%d: Fail : %s \n", devIdx + 1, msg.c_str());
+        }
+        rc |= rc0;
+        if (FLog != NULL) {
+            fprintf(FLog, "%s\n", dev->getLog().c_str());
+        }
+    }
+    return rc;
+}
+
 int extract_all(CmdLineParams &cmd_params, config_t &config, ServerRequest *srq)
 {
 
@@ -648,7 +917,8 @@ int extract_image(CmdLineParams &cmd_params, config_t &config, ServerRequest *sr
         mpath = adjustRelPath(cmd_params.mfa_file, config.adjuster_path);
     }
 
-    rc = queryMFAs(srq, mpath, psid_list, dev_types_list, psidUpdateInfo, cmd_params.update_online, errorMsg, fw_version_list);
+    rc = queryMFAs(srq, mpath, psid_list, dev_types_list, psidUpdateInfo, cmd_params.update_online, errorMsg, fw_version_list,
+                   !cmd_params.no_index, cmd_params.query_threads);
     if (rc < 0) {
         print_err("-E- Failed while reading file(s)\n");
         res = ERR_CODE_IMG_NOT_FOUND;
@@ -1283,18 +1553,40 @@ int isFile(string path)
 }
 
 
-int  getMFAListFromPSIDs(string mfa_path, vector<string> &psid_list, vector<PsidQueryItem> &results, string &errorMsg)
+int  getMFAListFromPSIDs(string mfa_path, vector<string> &psid_list, vector<PsidQueryItem> &results, string &errorMsg,
+                         bool use_index, int index_threads)
 {
     int rc;
     ImageAccess imgacc(CompareFFV);
     string arch = "";
     int res = 0;
+    ImageIndex *index = NULL;
+
+    if (use_index && isDirectory(mfa_path)) {
+        // read-only, only --build-index writes the index. New and changed files are left
+        // unindexed, so they are opened by the query itself. A missing or unreadable index
+        // only costs speed, never fail the query on it
+        string indexErr;
+        index = new ImageIndex(mfa_path);
+        if (!index->refresh(index_threads, indexErr, false)) {
+            delete index;
+            index = NULL;
+        }
+    }
 
     for (unsigned i = 0; i < psid_list.size(); i++) {
         int _FileOrDir = 0;
         vector<PsidQueryItem> riv;
         PsidQueryItem ri;
-        if (isDirectory(mfa_path)) {
+        if (index) {
+            vector<string> files;
+            _FileOrDir = 1;
+            index->getCandidates(psid_list[i], files);
+            rc = imgacc.queryFilesPsid(files, psid_list[i], arch, 1, riv);
+            if (imgacc.getlastWarning().length()) {
+                errorMsg += imgacc.getlastWarning();
+            }
+        } else if (isDirectory(mfa_path)) {
             _FileOrDir = 1;
             rc = imgacc.queryDirPsid(mfa_path, psid_list[i], arch, 1, riv);
             if (imgacc.getlastWarning().length()) {
@@ -1308,6 +1600,7 @@ int  getMFAListFromPSIDs(string mfa_path, vector<string> &psid_list, vector<Psid
             }
         } else {
             errorMsg += "-E- Bad path: " + mfa_path + "\n";
+            delete index;
             return -1;
         }
         if (rc == 1) {
@@ -1316,6 +1609,7 @@ int  getMFAListFromPSIDs(string mfa_path, vector<string> &psid_list, vector<Psid
             //print_err("No image files found for PSID:%s in path: %s\n", psid_list[i].c_str(), mfa_path.c_str());
         } else if (rc == -1) {
             //print_err("Error querying files for PSID: %s\n",psid_list[i].c_str());
+            delete index;
             return -1;
         } else if (rc < -1) {
             errorMsg += "-E- There are multiple image sources for device with PSID=" + psid_list[i] + " found in files:\n";
@@ -1332,12 +1626,14 @@ int  getMFAListFromPSIDs(string mfa_path, vector<string> &psid_list, vector<Psid
             results.push_back(ri);
         }
     }
+    delete index;
     return 0;
 }
 
 
 int queryMFAs(ServerRequest *srq, string &mfa_path, vector<string> &psid_list, vector<dm_dev_id_t> &dev_types_list,
-              map<string, PsidQueryItem> &psidUpdateInfo, int online_update, string &errorMsg, vector<string> &fw_version_list)
+              map<string, PsidQueryItem> &psidUpdateInfo, int online_update, string &errorMsg, vector<string> &fw_version_list,
+              bool use_index, int index_threads)
 {
     int res = -1;
     int rc = 0;
@@ -1354,7 +1650,7 @@ int queryMFAs(ServerRequest *srq, string &mfa_path, vector<string> &psid_list, v
         srq->getError(res, errorMsg);
     } else {
         //Query Local MFAs
-        rc = getMFAListFromPSIDs(mfa_path, psid_list, results, errorMsg);
+        rc = getMFAListFromPSIDs(mfa_path, psid_list, results, errorMsg, use_index, index_threads);
         if (rc == -1) {
             //fprintf(stderr, "-E- Failed during PSID local query.\n");
             goto clean_up;
@@ -1450,6 +1746,89 @@ int advProgressFunc_display(int completion, const char *stage, prog_t type, int
 }
 
 
+/*
+ * Progress of parallel burns: the callbacks have no context argument, so the
+ * device a thread is working on is kept in a thread specific key. Every device
+ * gets its own line per stage change and per 10% step instead of redrawing a
+ * shared line.
+ */
+typedef struct parallel_progress {
+    string stage;
+    int step;
+} parallel_progress_t;
+
+static pthread_key_t ParallelProgressDevKey;
+static vector<parallel_progress_t> ParallelProgress;
+static bool ParallelProgressJson = false;
+
+void initParallelProgress(int numOfDevs, bool json)
+{
+    pthread_key_create(&ParallelProgressDevKey, NULL);
+    ParallelProgress.resize(numOfDevs);
+    for (int i = 0; i < numOfDevs; i++) {
+        ParallelProgress[i].step = -1;
+    }
+    ParallelProgressJson = json;
+}
+
+void setParallelProgressDev(int devIdx)
+{
+    pthread_setspecific(ParallelProgressDevKey, (void*)(intptr_t)(devIdx + 1));
+}
+
+static void reportParallelProgress(const char *stage, int completion, bool done)
+{
+    int devIdx = (int)(intptr_t)pthread_getspecific(ParallelProgressDevKey) - 1;
+    if (devIdx < 0 || devIdx >= (int)ParallelProgress.size()) {
+        return;
+    }
+    string stageStr = stage ? stage : "Burning FW";
+    int step = done ? 10 : (completion < 0 ? -1 : completion / 10);
+    mft_utils::MftLockGuard printGuard(PrintLock);
+    parallel_progress_t &prog = ParallelProgress[devIdx];
+    if (prog.stage == stageStr && prog.step == step) {
+        return;
+    }
+    prog.stage = stageStr;
+    prog.step = step;
+    if (ParallelProgressJson) {
+        print_out("{\"device\":%d,\"stage\":\"%s\",\"progress\":%d,\"status\":\"%s\"}\n", devIdx + 1,
+                  mft_utils::json_escape(stageStr).c_str(), done ? 100 : completion, done ? "ok" : "in_progress");
+    } else if (done) {
+        print_out("Device #%d: %s - OK\n", devIdx + 1, stageStr.c_str());
+    } else if (completion < 0) {
+        print_out("Device #%d: %s ...\n", devIdx + 1, stageStr.c_str());
+    } else {
+        print_out("Device #%d: %s - %3d%%\n", devIdx + 1, stageStr.c_str(), completion);
+    }
+}
+
+int progressCB_parallel(int completion)
+{
+    reportParallelProgress(NULL, completion, false);
+    return abort_request;
+}
+
+int advProgressFunc_parallel(int completion, const char *stage, prog_t type, int *unknownProgress)
+{
+    (void) unknownProgress;
+    switch (type) {
+    case PROG_WITH_PRECENTAGE:
+        reportParallelProgress(stage, completion, false);
+        break;
+
+    case PROG_OK:
+        reportParallelProgress(stage, 100, true);
+        break;
+
+    case PROG_STRING_ONLY:
+    case PROG_WITHOUT_PRECENTAGE:
+        reportParallelProgress(stage, -1, false);
+        break;
+    }
+    return abort_request;
+}
+
 int progressCB_nodisplay(int completion)
 {
     (void) completion;
@@ -1642,6 +2021,29 @@ int list_files_content(config_t &config)
     return res;
 }
 
+int build_image_index(CmdLineParams &cmd_params, config_t &config)
+{
+    string errMsg;
+
+    if (config.path_is_file || !isDirectory(config.mfa_path)) {
+        print_err("-E- Please specify an image directory to index, use -D option\n");
+        return ERR_CODE_BAD_CMD_ARGS;
+    }
+    print_out("-I- Indexing image files in %s ...\n", config.mfa_path.c_str());
+    ImageIndex index(config.mfa_path);
+    if (!index.refresh(cmd_params.query_threads, errMsg)) {
+        print_err("%s", errMsg.c_str());
+        return ERR_CODE_IMG_NOT_FOUND;
+    }
+    if (!index.save(errMsg)) {
+        print_err("%s", errMsg.c_str());
+        return ERR_CODE_WRITE_FILE_FAIL;
+    }
+    print_out("-I- %u files, %u indexed, %u (re)scanned\n", index.getNumFiles(), index.getNumIndexed(),
+              index.getNumRescanned());
+    return MLX_FWM_SUCCESS;
+}
+
 
 void display_field_str(string field, int size, string display_if_empty = "")
 {
@@ -1799,8 +2201,21 @@ void TerminationHandler(int signum)
     (void) signum;
     abort_request = 1;
     if (IS_OKAY_To_INTERRUPT) {
+#ifdef __WIN__
+        // the console control handler runs on its own thread, not in signal context
         print_out("\nInterrupted\n");
         exit(0);
+#else
+        // the interrupted code may hold PrintLock or be inside stdio, so only
+        // async-signal-safe calls here. Outside of these blocking sections the
+        // main thread polls abort_request and reports the interruption itself
+        if (!formatted_output) {
+            const char msg[] = "\nInterrupted\n";
+            ssize_t rc = write(InterruptOutFd, msg, sizeof(msg) - 1);
+            (void) rc;
+        }
+        _exit(0);
+#endif
     }
 }
 
@@ -52,18 +52,26 @@
 #include "cmd_line_parser.h"
 #include "cmd_line_params.h"
 #include "image_access.h"
+#include "image_index.h"
 #include "psid_lookup_db.h"
 #include "psid_query_item.h"
 #include "output_fmts.h"
 #include "mlxfwmanager_common.h"
 #include "menu.h"
+#include "mft_thread_pool.h"
 
 FILE *FLog = NULL;
 FILE *FOut = stdout;
 FILE *FErr = stderr;
+// FOut's descriptor, TerminationHandler cannot use stdio
+int InterruptOutFd = 1;
 extern string toolName;
+// serializes the output of devices that are handled in parallel, recursive since
+// the parallel progress printer takes it around print_out
+mft_utils::MftMutex PrintLock(true);
 
 #define print_out(...) do {                                        \
+        mft_utils::MftLockGuard printGuard(PrintLock);            \
         if (!formatted_output) {                              \
             fprintf(FOut, __VA_ARGS__);                        \
             fflush(FOut);                                     \
@@ -72,6 +80,7 @@ extern string toolName;
 } while (0)
 
 #define print_err(...) do {                                        \
+        mft_utils::MftLockGuard printGuard(PrintLock);            \
         if (!formatted_output) {                              \
             fprintf(FErr, __VA_ARGS__);                       \
             fflush(FErr);                                     \
@@ -79,6 +88,7 @@ extern string toolName;
         if (FLog != NULL) { fprintf(FLog, __VA_ARGS__);} \
 } while (0)
 #define print_out_xml(...)do {                                        \
+        mft_utils::MftLockGuard printGuard(PrintLock);            \
         fprintf(FOut, __VA_ARGS__);                        \
         fflush(FOut);                                     \
         if (FLog != NULL) {fprintf(FLog, __VA_ARGS__);}        \
@@ -107,9 +117,17 @@ int    displayReleaseNoteFiles(const filesOPtions& filterOPtions, const CmdLineP
 void   displayReleaseNoteMFAs(map<string, PsidQueryItem> psidUpdateInfo, vector<MlnxDev*> devs, int deviceIndex);
 void   display_file_listing(vector<PsidQueryItem> &items, string psid, bool show_titles);
 int    getLocalDevices(dev_info **devs);
+void   queryDevices(vector<MlnxDev*> *queryDevs, CmdLineParams &cmd_params, vector<bool> &timedOut);
+int    burnDevicesInParallel(vector<MlnxDev*> &devs, vector<int> &burnDevs, CmdLineParams &cmd_params, int &burn_success_cnt);
+string getDevMfaFile(MlnxDev *dev, config_t &config, CmdLineParams &cmd_params, map<string, PsidQueryItem> &psidUpdateInfo);
+void   initParallelProgress(int numOfDevs, bool json);
+void   setParallelProgressDev(int devIdx);
+int    progressCB_parallel(int completion);
+int    advProgressFunc_parallel(int completion, const char *stage, prog_t type, int *unknownProgress);
 void   getUniquePsidList(vector<MlnxDev*> &devs, vector<string> &psid_list, vector<dm_dev_id_t> &dev_types_list, vector<string> &fw_version_list);
 void   getUniqueMFAList(vector<MlnxDev*> &devs, map<string, PsidQueryItem> &psidUpdateInfo, int force_update, vector<string> &mfa_list, vector <string> &mfa_base_name_list);
-int    queryMFAs(ServerRequest *srq, string &mfa_path, vector<string> &psid_list, vector<dm_dev_id_t> &dev_types_list, map<string, PsidQueryItem> &psidUpdateInfo, int online_update, string &errorMsg, vector<string> &fw_version_list);
+int    queryMFAs(ServerRequest *srq, string &mfa_path, vector<string> &psid_list, vector<dm_dev_id_t> &dev_types_list, map<string, PsidQueryItem> &psidUpdateInfo, int online_update, string &errorMsg, vector<string> &fw_version_list,
+                 bool use_index = false, int index_threads = 0);
 int    download(ServerRequest *srq, vector<string> &url, vector <string>&fileNames, vector <string>&os, string path, bool show_location = true);
 int    checkAndDisplayDeviceQuery1D(vector<MlnxDev*> &devs, map<string, PsidQueryItem> &psidUpdateInfo, PsidLookupDB &psidLookupDB,
                                     int update_query_, int img_path_provided, int force_update, bool is_query, bool is_query_xml, string &xml_query, string &errorMsg, CmdLineParams &cmd_params);
@@ -134,6 +152,7 @@ string adjustRelPath(string path, string adjuster);
 int    isDirectory(string path);
 int    isFile(string path);
 int    list_files_content(config_t &config);
+int    build_image_index(CmdLineParams &cmd_params, config_t &config);
 int    extract_all(CmdLineParams &cmd_params, config_t &config, ServerRequest *srq);
 int    extract_image(CmdLineParams &cmd_params, config_t &config, ServerRequest *srq, bool useExtractDir = false);
 int   CalcFileCrc(char *fileName);
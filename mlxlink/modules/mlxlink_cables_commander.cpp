@@ -31,6 +31,9 @@
  */
 
 #include "mlxlink_cables_commander.h"
+#include "mlxlink_reg_layouts.h"
+
+using namespace adb_regs;
 
 MlxlinkCablesCommander::MlxlinkCablesCommander(Json::Value &jsonRoot): _jsonRoot(jsonRoot)
 {
@@ -51,18 +54,16 @@ void MlxlinkCablesCommander::readMCIA(u_int32_t page, u_int32_t size,
 {
     string regName = "MCIA";
     resetParser(regName);
-    updateField("module", _moduleNumber);
-    updateField("size", size);
-    updateField("page_number", page);
-    updateField("device_address", offset);
-    updateField("i2c_device_address", i2cAddress);
-    updateField("l", 0);
+    updateField<MCIA::module>(_moduleNumber);
+    updateField<MCIA::size_>(size);
+    updateField<MCIA::page_number>(page);
+    updateField<MCIA::device_address>(offset);
+    updateField<MCIA::i2c_device_address>(i2cAddress);
+    updateField<MCIA::l>(0);
     genBuffSendRegister(regName, MACCESS_REG_METHOD_GET);
     u_int32_t i = 0;
-    char fieldName[32];
     for ( ; i < size/4 ; i++) {
-        sprintf(fieldName, "dword[%d]", i);
-        u_int32_t s = getFieldValue(std::string(fieldName));
+        u_int32_t s = getFieldValue(getMciaDword(i));
         s = __be32_to_cpu(s);
         memcpy(data + (i*4), &s, sizeof(u_int32_t));
     }
@@ -80,25 +81,34 @@ void MlxlinkCablesCommander::writeMCIA(u_int32_t page, u_int32_t size,
     }
     string regName = "MCIA";
     resetParser(regName);
-    updateField("module", _moduleNumber);
-    updateField("size", dataSize);
-    updateField("page_number", page);
-    updateField("device_address", offset);
-    updateField("i2c_device_address", i2cAddress);
+    updateField<MCIA::module>(_moduleNumber);
+    updateField<MCIA::size_>(dataSize);
+    updateField<MCIA::page_number>(page);
+    updateField<MCIA::device_address>(offset);
+    updateField<MCIA::i2c_device_address>(i2cAddress);
     u_int32_t i = 0;
-    char fieldName[20];
     u_int32_t dwordDataSize = (u_int32_t)ceil((double)size/sizeof(u_int32_t));
     u_int32_t *dwordData = (u_int32_t*)malloc(dwordDataSize);
     memset(dwordData, 0, dwordDataSize);
     memcpy(dwordData, data, size);
     for ( ; i < dwordDataSize ; i++) {
-        sprintf(fieldName, "dword[%d]", i);
-        updateField(fieldName, __cpu_to_be32(dwordData[i]));
+        updateField(getMciaDword(i), __cpu_to_be32(dwordData[i]));
     }
     delete dwordData;
     genBuffSendRegister(regName, MACCESS_REG_METHOD_SET);
 }
 
+// MCIA dword fields are resolved once and reused by every EEPROM access
+AdbInstance* MlxlinkCablesCommander::getMciaDword(u_int32_t index)
+{
+    char fieldName[32];
+    while (_mciaDwords.size() <= index) {
+        sprintf(fieldName, "dword[%u]", (u_int32_t)_mciaDwords.size());
+        _mciaDwords.push_back(getFieldHandle(fieldName));
+    }
+    return _mciaDwords[index];
+}
+
 // Reading EEPROM data from MCIA register and loading it to readable pages
 void MlxlinkCablesCommander::loadEEPRMPage(u_int32_t pageNum, u_int32_t offset,
         u_int8_t* data, u_int32_t i2cAddress)
@@ -419,6 +419,7 @@ public:
     void writeToEEPROM(u_int16_t page , u_int16_t offset, vector<u_int8_t> &bytesToWrite);
     MlxlinkCmdPrint readFromEEPRM(u_int16_t page , u_int16_t offset, u_int16_t length);
     u_int16_t getStatusBit(u_int32_t channel, u_int16_t val, u_int32_t statusMask);
+    AdbInstance* getMciaDword(u_int32_t index);
 
     u_int32_t _moduleNumber;
     u_int32_t _cableIdentifier;
@@ -433,6 +434,7 @@ private:
     vector<MlxlinkCmdPrint> _pagesToDump;
     vector<MlxlinkCmdPrint> _cableDDMOutput;
     cable_ddm_q_t _cableDdm;
+    vector<AdbInstance*> _mciaDwords;
 };
 
 #endif /* MLXLINK_CABLES_COMMANDER_H */
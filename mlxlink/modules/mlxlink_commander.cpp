@@ -33,8 +33,10 @@
  */
 
 #include "mlxlink_commander.h"
+#include "mlxlink_reg_layouts.h"
 
 using namespace mlxreg;
+using namespace adb_regs;
 
 MlxlinkCommander::MlxlinkCommander() : _userInput()
 
@@ -91,6 +93,7 @@ MlxlinkCommander::MlxlinkCommander() : _userInput()
     _errInjector = NULL;
     _portInfo = NULL;
     _uniqueCableCmds = 0;
+    _regCache = new MlxlinkRegCache();
 }
 
 MlxlinkCommander::~MlxlinkCommander()
@@ -119,6 +122,9 @@ MlxlinkCommander::~MlxlinkCommander()
     if (_mlxlinkLogger) {
         delete _mlxlinkLogger;
     }
+    if (_regCache) {
+        delete _regCache;
+    }
     if(_mlxlinkMaps) {
         delete _mlxlinkMaps;
     }
@@ -2203,10 +2209,10 @@ void MlxlinkCommander::showSltp()
         setPrintVal(_sltpInfoCmd, "Serdes TX parameters", _mlxlinkMaps->_sltpHeader, ANSI_COLOR_RESET, true,true, true);
         for (u_int32_t i = 0; i < numOfLanesToUse; i++) {
             updatePortType();
-            updateField("local_port", _localPort);
-            updateField("pnat", (_userInput._pcie) ? PNAT_PCIE : PNAT_LOCAL);
-            updateField("lane", i);
-            updateField("c_db", _userInput._db);
+            updateField<SLTP::local_port>(_localPort);
+            updateField<SLTP::pnat>((_userInput._pcie) ? PNAT_PCIE : PNAT_LOCAL);
+            updateField<SLTP::lane>(i);
+            updateField<SLTP::c_db>(_userInput._db);
             genBuffSendRegister(regName, MACCESS_REG_METHOD_GET);
             if (_productTechnology == PRODUCT_16NM) {
                 prepareSltp16nm(sltpLanes, i);
@@ -2215,7 +2221,7 @@ void MlxlinkCommander::showSltp()
             } else {
                 prepareSltp28_40nm(sltpLanes, i);
             }
-            if (!getFieldValue("status")) {
+            if (!getFieldValue<SLTP::status>()) {
                 valid = false;
             }
             resetParser(regName);
@@ -3903,6 +3909,7 @@ void MlxlinkCommander::initCablesCommander()
         _cablesCommander->_regLib = _regLib;
         _cablesCommander->_gvmiAddress = _gvmiAddress;
         _cablesCommander->_mlxlinkLogger = _mlxlinkLogger;
+        _cablesCommander->_regCache = _regCache;
         _cablesCommander->_moduleNumber = _moduleNumber;
         _cablesCommander->_localPort = _localPort;
         _cablesCommander->_numOfLanes = _numOfLanes;
@@ -4049,6 +4056,7 @@ void MlxlinkCommander::initErrInj()
         _errInjector = new MlxlinkErrInjCommander(_jsonRoot);
         _errInjector->_regLib = _regLib;
         _errInjector->_mlxlinkLogger = _mlxlinkLogger;
+        _errInjector->_regCache = _regCache;
         _errInjector->_localPort = _localPort;
         _errInjector->_force = _userInput.force;
 
@@ -4101,6 +4109,7 @@ void MlxlinkCommander::initPortInfo()
          _portInfo = new MlxlinkPortInfo(_jsonRoot);
          _portInfo->_regLib = _regLib;
          _portInfo->_mlxlinkLogger = _mlxlinkLogger;
+         _portInfo->_regCache = _regCache;
          _portInfo->_localPort = _localPort;
          _portInfo->_portType = _portType;
          _portInfo->_fecActive = _fecActive;
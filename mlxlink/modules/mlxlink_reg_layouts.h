@@ -0,0 +1,7093 @@
+/*
+ * Copyright (c) 2020 Mellanox Technologies Ltd.  All rights reserved.
+ *
+ * This software is available to you under a choice of one of two
+ * licenses.  You may choose to be licensed under the terms of the GNU
+ * General Public License (GPL) Version 2, available from the file
+ * COPYING in the main directory of this source tree, or the
+ * OpenIB.org BSD license below:
+ *
+ *     Redistribution and use in source and binary forms, with or
+ *     without modification, are permitted provided that the following
+ *     conditions are met:
+ *
+ *      - Redistributions of source code must retain the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer.
+ *
+ *      - Redistributions in binary form must reproduce the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer in the documentation and/or other materials
+ *        provided with the distribution.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Generated by adb2cpp from register_access_table.adb, do not edit */
+
+#ifndef MLXLINK_REG_LAYOUTS_H
+#define MLXLINK_REG_LAYOUTS_H
+
+#include <adb_parser/adb_reg_field.h>
+
+namespace adb_regs {
+
+struct PDDR {
+    static const char* name() { return "PDDR"; }
+    static constexpr u_int32_t size = 0x800;
+
+    struct lp_msb : AdbRegField<0xc, 2> {
+        typedef PDDR reg;
+        static const char* name() { return "lp_msb"; }
+    };
+    struct pnat : AdbRegField<0xe, 2> {
+        typedef PDDR reg;
+        static const char* name() { return "pnat"; }
+    };
+    struct local_port : AdbRegField<0x10, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "local_port"; }
+    };
+    struct page_select : AdbRegField<0x20, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "page_select"; }
+    };
+    struct module_info_ext : AdbRegField<0x3d, 2> {
+        typedef PDDR reg;
+        static const char* name() { return "module_info_ext"; }
+    };
+    struct proto_active : AdbRegField<0x54, 4> {
+        typedef PDDR reg;
+        static const char* name() { return "proto_active"; }
+    };
+    struct ib_phy_fsm_state : AdbRegField<0x68, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "ib_phy_fsm_state"; }
+    };
+    struct eth_an_fsm_state : AdbRegField<0x70, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "eth_an_fsm_state"; }
+    };
+    struct phy_mngr_fsm_state : AdbRegField<0x78, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "phy_mngr_fsm_state"; }
+    };
+    struct phy_manager_link_proto_enabled : AdbRegField<0x80, 16> {
+        typedef PDDR reg;
+        static const char* name() { return "phy_manager_link_proto_enabled"; }
+    };
+    struct phy_manager_link_width_enabled : AdbRegField<0x90, 16> {
+        typedef PDDR reg;
+        static const char* name() { return "phy_manager_link_width_enabled"; }
+    };
+    struct phy_manager_link_eth_enabled : AdbRegField<0x80, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "phy_manager_link_eth_enabled"; }
+    };
+    struct core_to_phy_link_proto_enabled : AdbRegField<0xa0, 16> {
+        typedef PDDR reg;
+        static const char* name() { return "core_to_phy_link_proto_enabled"; }
+    };
+    struct core_to_phy_link_width_enabled : AdbRegField<0xb0, 16> {
+        typedef PDDR reg;
+        static const char* name() { return "core_to_phy_link_width_enabled"; }
+    };
+    struct core_to_phy_link_eth_enabled : AdbRegField<0xa0, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "core_to_phy_link_eth_enabled"; }
+    };
+    struct cable_link_speed_cap : AdbRegField<0xc0, 16> {
+        typedef PDDR reg;
+        static const char* name() { return "cable_link_speed_cap"; }
+    };
+    struct cable_link_width_cap : AdbRegField<0xd0, 16> {
+        typedef PDDR reg;
+        static const char* name() { return "cable_link_width_cap"; }
+    };
+    struct cable_ext_eth_proto_cap : AdbRegField<0xc0, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "cable_ext_eth_proto_cap"; }
+    };
+    struct link_speed_active : AdbRegField<0xe0, 16> {
+        typedef PDDR reg;
+        static const char* name() { return "link_speed_active"; }
+    };
+    struct link_width_active : AdbRegField<0xf0, 16> {
+        typedef PDDR reg;
+        static const char* name() { return "link_width_active"; }
+    };
+    struct link_eth_active : AdbRegField<0xe0, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "link_eth_active"; }
+    };
+    struct loopback_mode : AdbRegField<0x100, 4> {
+        typedef PDDR reg;
+        static const char* name() { return "loopback_mode"; }
+    };
+    struct fec_mode_request : AdbRegField<0x120, 16> {
+        typedef PDDR reg;
+        static const char* name() { return "fec_mode_request"; }
+    };
+    struct fec_mode_active : AdbRegField<0x130, 16> {
+        typedef PDDR reg;
+        static const char* name() { return "fec_mode_active"; }
+    };
+    struct eth_100g_fec_support : AdbRegField<0x140, 4> {
+        typedef PDDR reg;
+        static const char* name() { return "eth_100g_fec_support"; }
+    };
+    struct eth_25g_50g_fec_support : AdbRegField<0x144, 4> {
+        typedef PDDR reg;
+        static const char* name() { return "eth_25g_50g_fec_support"; }
+    };
+    struct group_opcode : AdbRegField<0x40, 16> {
+        typedef PDDR reg;
+        static const char* name() { return "group_opcode"; }
+    };
+    struct monitor_opcode : AdbRegField<0x60, 16> {
+        typedef PDDR reg;
+        static const char* name() { return "monitor_opcode"; }
+    };
+    struct advanced_opcode : AdbRegField<0x60, 16> {
+        typedef PDDR reg;
+        static const char* name() { return "advanced_opcode"; }
+    };
+    struct status_message_0 : AdbRegField<0xa0, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "status_message[0]"; }
+    };
+    struct status_message_1 : AdbRegField<0xc0, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "status_message[1]"; }
+    };
+    struct status_message_2 : AdbRegField<0xe0, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "status_message[2]"; }
+    };
+    struct status_message_3 : AdbRegField<0x100, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "status_message[3]"; }
+    };
+    struct status_message_4 : AdbRegField<0x120, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "status_message[4]"; }
+    };
+    struct status_message_5 : AdbRegField<0x140, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "status_message[5]"; }
+    };
+    struct status_message_6 : AdbRegField<0x160, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "status_message[6]"; }
+    };
+    struct status_message_7 : AdbRegField<0x180, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "status_message[7]"; }
+    };
+    struct status_message_8 : AdbRegField<0x1a0, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "status_message[8]"; }
+    };
+    struct status_message_9 : AdbRegField<0x1c0, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "status_message[9]"; }
+    };
+    struct status_message_10 : AdbRegField<0x1e0, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "status_message[10]"; }
+    };
+    struct status_message_11 : AdbRegField<0x200, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "status_message[11]"; }
+    };
+    struct status_message_12 : AdbRegField<0x220, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "status_message[12]"; }
+    };
+    struct status_message_13 : AdbRegField<0x240, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "status_message[13]"; }
+    };
+    struct status_message_14 : AdbRegField<0x260, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "status_message[14]"; }
+    };
+    struct status_message_15 : AdbRegField<0x280, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "status_message[15]"; }
+    };
+    struct status_message_16 : AdbRegField<0x2a0, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "status_message[16]"; }
+    };
+    struct status_message_17 : AdbRegField<0x2c0, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "status_message[17]"; }
+    };
+    struct status_message_18 : AdbRegField<0x2e0, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "status_message[18]"; }
+    };
+    struct status_message_19 : AdbRegField<0x300, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "status_message[19]"; }
+    };
+    struct status_message_20 : AdbRegField<0x320, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "status_message[20]"; }
+    };
+    struct status_message_21 : AdbRegField<0x340, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "status_message[21]"; }
+    };
+    struct status_message_22 : AdbRegField<0x360, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "status_message[22]"; }
+    };
+    struct status_message_23 : AdbRegField<0x380, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "status_message[23]"; }
+    };
+    struct status_message_24 : AdbRegField<0x3a0, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "status_message[24]"; }
+    };
+    struct status_message_25 : AdbRegField<0x3c0, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "status_message[25]"; }
+    };
+    struct status_message_26 : AdbRegField<0x3e0, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "status_message[26]"; }
+    };
+    struct status_message_27 : AdbRegField<0x400, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "status_message[27]"; }
+    };
+    struct status_message_28 : AdbRegField<0x420, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "status_message[28]"; }
+    };
+    struct status_message_29 : AdbRegField<0x440, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "status_message[29]"; }
+    };
+    struct status_message_30 : AdbRegField<0x460, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "status_message[30]"; }
+    };
+    struct status_message_31 : AdbRegField<0x480, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "status_message[31]"; }
+    };
+    struct status_message_32 : AdbRegField<0x4a0, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "status_message[32]"; }
+    };
+    struct status_message_33 : AdbRegField<0x4c0, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "status_message[33]"; }
+    };
+    struct status_message_34 : AdbRegField<0x4e0, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "status_message[34]"; }
+    };
+    struct status_message_35 : AdbRegField<0x500, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "status_message[35]"; }
+    };
+    struct status_message_36 : AdbRegField<0x520, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "status_message[36]"; }
+    };
+    struct status_message_37 : AdbRegField<0x540, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "status_message[37]"; }
+    };
+    struct status_message_38 : AdbRegField<0x560, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "status_message[38]"; }
+    };
+    struct status_message_39 : AdbRegField<0x580, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "status_message[39]"; }
+    };
+    struct status_message_40 : AdbRegField<0x5a0, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "status_message[40]"; }
+    };
+    struct status_message_41 : AdbRegField<0x5c0, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "status_message[41]"; }
+    };
+    struct status_message_42 : AdbRegField<0x5e0, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "status_message[42]"; }
+    };
+    struct status_message_43 : AdbRegField<0x600, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "status_message[43]"; }
+    };
+    struct status_message_44 : AdbRegField<0x620, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "status_message[44]"; }
+    };
+    struct status_message_45 : AdbRegField<0x640, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "status_message[45]"; }
+    };
+    struct status_message_46 : AdbRegField<0x660, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "status_message[46]"; }
+    };
+    struct status_message_47 : AdbRegField<0x680, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "status_message[47]"; }
+    };
+    struct status_message_48 : AdbRegField<0x6a0, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "status_message[48]"; }
+    };
+    struct status_message_49 : AdbRegField<0x6c0, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "status_message[49]"; }
+    };
+    struct status_message_50 : AdbRegField<0x6e0, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "status_message[50]"; }
+    };
+    struct status_message_51 : AdbRegField<0x700, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "status_message[51]"; }
+    };
+    struct status_message_52 : AdbRegField<0x720, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "status_message[52]"; }
+    };
+    struct status_message_53 : AdbRegField<0x740, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "status_message[53]"; }
+    };
+    struct status_message_54 : AdbRegField<0x760, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "status_message[54]"; }
+    };
+    struct status_message_55 : AdbRegField<0x780, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "status_message[55]"; }
+    };
+    struct status_message_56 : AdbRegField<0x7a0, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "status_message[56]"; }
+    };
+    struct status_message_57 : AdbRegField<0x7c0, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "status_message[57]"; }
+    };
+    struct status_message_58 : AdbRegField<0x7e0, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "status_message[58]"; }
+    };
+    struct port_notifications : AdbRegField<0x40, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "port_notifications"; }
+    };
+    struct remote_device_type : AdbRegField<0x58, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "remote_device_type"; }
+    };
+    struct lp_ib_revision : AdbRegField<0x60, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "lp_ib_revision"; }
+    };
+    struct ib_revision : AdbRegField<0x68, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "ib_revision"; }
+    };
+    struct num_of_negotiation_attempts : AdbRegField<0x70, 16> {
+        typedef PDDR reg;
+        static const char* name() { return "num_of_negotiation_attempts"; }
+    };
+    struct phy_manger_disable_mask : AdbRegField<0x80, 16> {
+        typedef PDDR reg;
+        static const char* name() { return "phy_manger_disable_mask"; }
+    };
+    struct hw_link_phy_state : AdbRegField<0x98, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "hw_link_phy_state"; }
+    };
+    struct pcs_phy_state : AdbRegField<0xa0, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "pcs_phy_state"; }
+    };
+    struct lp_proto_enabled : AdbRegField<0xc0, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "lp_proto_enabled"; }
+    };
+    struct lp_fec_mode_request : AdbRegField<0xe0, 16> {
+        typedef PDDR reg;
+        static const char* name() { return "lp_fec_mode_request"; }
+    };
+    struct lp_fec_mode_support : AdbRegField<0xf0, 16> {
+        typedef PDDR reg;
+        static const char* name() { return "lp_fec_mode_support"; }
+    };
+    struct ib_last_link_down_reason : AdbRegField<0x100, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "ib_last_link_down_reason"; }
+    };
+    struct eth_last_link_down_lane_3 : AdbRegField<0x120, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "eth_last_link_down_lane[3]"; }
+    };
+    struct eth_last_link_down_lane_2 : AdbRegField<0x128, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "eth_last_link_down_lane[2]"; }
+    };
+    struct eth_last_link_down_lane_1 : AdbRegField<0x130, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "eth_last_link_down_lane[1]"; }
+    };
+    struct eth_last_link_down_lane_0 : AdbRegField<0x138, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "eth_last_link_down_lane[0]"; }
+    };
+    struct speed_deg_db : AdbRegField<0x160, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "speed_deg_db"; }
+    };
+    struct degrade_grade_lane0 : AdbRegField<0x180, 24> {
+        typedef PDDR reg;
+        static const char* name() { return "degrade_grade_lane0"; }
+    };
+    struct degrade_grade_lane1 : AdbRegField<0x1a0, 24> {
+        typedef PDDR reg;
+        static const char* name() { return "degrade_grade_lane1"; }
+    };
+    struct degrade_grade_lane2 : AdbRegField<0x1c0, 24> {
+        typedef PDDR reg;
+        static const char* name() { return "degrade_grade_lane2"; }
+    };
+    struct degrade_grade_lane3 : AdbRegField<0x1e0, 24> {
+        typedef PDDR reg;
+        static const char* name() { return "degrade_grade_lane3"; }
+    };
+    struct kr_startup_fsm_lane_3 : AdbRegField<0x280, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "kr_startup_fsm_lane[3]"; }
+    };
+    struct kr_startup_fsm_lane_2 : AdbRegField<0x288, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "kr_startup_fsm_lane[2]"; }
+    };
+    struct kr_startup_fsm_lane_1 : AdbRegField<0x290, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "kr_startup_fsm_lane[1]"; }
+    };
+    struct kr_startup_fsm_lane_0 : AdbRegField<0x298, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "kr_startup_fsm_lane[0]"; }
+    };
+    struct eth_an_debug_indication : AdbRegField<0x2c0, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "eth_an_debug_indication"; }
+    };
+    struct ib_phy_fsm_state_trace : AdbRegField<0x2e0, 16> {
+        typedef PDDR reg;
+        static const char* name() { return "ib_phy_fsm_state_trace"; }
+    };
+    struct kr_startup_debug_indications_1 : AdbRegField<0x300, 16> {
+        typedef PDDR reg;
+        static const char* name() { return "kr_startup_debug_indications[1]"; }
+    };
+    struct kr_startup_debug_indications_0 : AdbRegField<0x310, 16> {
+        typedef PDDR reg;
+        static const char* name() { return "kr_startup_debug_indications[0]"; }
+    };
+    struct kr_startup_debug_indications_3 : AdbRegField<0x320, 16> {
+        typedef PDDR reg;
+        static const char* name() { return "kr_startup_debug_indications[3]"; }
+    };
+    struct kr_startup_debug_indications_2 : AdbRegField<0x330, 16> {
+        typedef PDDR reg;
+        static const char* name() { return "kr_startup_debug_indications[2]"; }
+    };
+    struct irisc_status : AdbRegField<0x380, 4> {
+        typedef PDDR reg;
+        static const char* name() { return "irisc_status"; }
+    };
+    struct stamping_reason : AdbRegField<0x3a0, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "stamping_reason"; }
+    };
+    struct kr_frame_lock_tuning_failure_events_count : AdbRegField<0x3c0, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "kr_frame_lock_tuning_failure_events_count"; }
+    };
+    struct kr_full_tuning_failure_count : AdbRegField<0x3e0, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "kr_full_tuning_failure_count"; }
+    };
+    struct pm_debug_indication : AdbRegField<0x400, 16> {
+        typedef PDDR reg;
+        static const char* name() { return "pm_debug_indication"; }
+    };
+    struct pd_debug_indication : AdbRegField<0x440, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "pd_debug_indication"; }
+    };
+    struct pd_count : AdbRegField<0x460, 6> {
+        typedef PDDR reg;
+        static const char* name() { return "pd_count"; }
+    };
+    struct fp_signal_detect_count : AdbRegField<0x468, 6> {
+        typedef PDDR reg;
+        static const char* name() { return "fp_signal_detect_count"; }
+    };
+    struct hst_mismatch_reason : AdbRegField<0x470, 2> {
+        typedef PDDR reg;
+        static const char* name() { return "hst_mismatch_reason"; }
+    };
+    struct psi_collision2 : AdbRegField<0x476, 5> {
+        typedef PDDR reg;
+        static const char* name() { return "psi_collision2"; }
+    };
+    struct psi_collision1 : AdbRegField<0x47b, 5> {
+        typedef PDDR reg;
+        static const char* name() { return "psi_collision1"; }
+    };
+    struct ethernet_compliance_code : AdbRegField<0x40, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "ethernet_compliance_code"; }
+    };
+    struct ext_ethernet_compliance_code : AdbRegField<0x48, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "ext_ethernet_compliance_code"; }
+    };
+    struct cable_breakout : AdbRegField<0x50, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "cable_breakout"; }
+    };
+    struct cable_technology : AdbRegField<0x58, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "cable_technology"; }
+    };
+    struct cable_power_class : AdbRegField<0x60, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "cable_power_class"; }
+    };
+    struct cable_identifier : AdbRegField<0x68, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "cable_identifier"; }
+    };
+    struct cable_length : AdbRegField<0x70, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "cable_length"; }
+    };
+    struct cable_vendor : AdbRegField<0x78, 4> {
+        typedef PDDR reg;
+        static const char* name() { return "cable_vendor"; }
+    };
+    struct cable_type : AdbRegField<0x7c, 4> {
+        typedef PDDR reg;
+        static const char* name() { return "cable_type"; }
+    };
+    struct cable_tx_equalization : AdbRegField<0x80, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "cable_tx_equalization"; }
+    };
+    struct cable_rx_emphasis : AdbRegField<0x88, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "cable_rx_emphasis"; }
+    };
+    struct cable_rx_amp : AdbRegField<0x90, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "cable_rx_amp"; }
+    };
+    struct max_power : AdbRegField<0x98, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "max_power"; }
+    };
+    struct cable_attenuation_5g : AdbRegField<0xa0, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "cable_attenuation_5g"; }
+    };
+    struct cable_attenuation_7g : AdbRegField<0xa8, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "cable_attenuation_7g"; }
+    };
+    struct cable_attenuation_12g : AdbRegField<0xb0, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "cable_attenuation_12g"; }
+    };
+    struct cable_attenuation_25g : AdbRegField<0xb8, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "cable_attenuation_25g"; }
+    };
+    struct tx_cdr_state : AdbRegField<0xc0, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "tx_cdr_state"; }
+    };
+    struct rx_cdr_state : AdbRegField<0xc8, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "rx_cdr_state"; }
+    };
+    struct tx_cdr_cap : AdbRegField<0xd0, 4> {
+        typedef PDDR reg;
+        static const char* name() { return "tx_cdr_cap"; }
+    };
+    struct rx_cdr_cap : AdbRegField<0xd4, 4> {
+        typedef PDDR reg;
+        static const char* name() { return "rx_cdr_cap"; }
+    };
+    struct cable_rx_post_emphasis : AdbRegField<0xd8, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "cable_rx_post_emphasis"; }
+    };
+    struct vendor_name_0 : AdbRegField<0xe0, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "vendor_name[0]"; }
+    };
+    struct vendor_name_1 : AdbRegField<0x100, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "vendor_name[1]"; }
+    };
+    struct vendor_name_2 : AdbRegField<0x120, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "vendor_name[2]"; }
+    };
+    struct vendor_name_3 : AdbRegField<0x140, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "vendor_name[3]"; }
+    };
+    struct vendor_pn_0 : AdbRegField<0x160, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "vendor_pn[0]"; }
+    };
+    struct vendor_pn_1 : AdbRegField<0x180, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "vendor_pn[1]"; }
+    };
+    struct vendor_pn_2 : AdbRegField<0x1a0, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "vendor_pn[2]"; }
+    };
+    struct vendor_pn_3 : AdbRegField<0x1c0, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "vendor_pn[3]"; }
+    };
+    struct vendor_rev : AdbRegField<0x1e0, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "vendor_rev"; }
+    };
+    struct fw_version : AdbRegField<0x200, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "fw_version"; }
+    };
+    struct vendor_sn_0 : AdbRegField<0x220, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "vendor_sn[0]"; }
+    };
+    struct vendor_sn_1 : AdbRegField<0x240, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "vendor_sn[1]"; }
+    };
+    struct vendor_sn_2 : AdbRegField<0x260, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "vendor_sn[2]"; }
+    };
+    struct vendor_sn_3 : AdbRegField<0x280, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "vendor_sn[3]"; }
+    };
+    struct voltage : AdbRegField<0x2a0, 16> {
+        typedef PDDR reg;
+        static const char* name() { return "voltage"; }
+    };
+    struct temperature : AdbRegField<0x2b0, 16> {
+        typedef PDDR reg;
+        static const char* name() { return "temperature"; }
+    };
+    struct rx_power_lane1 : AdbRegField<0x2c0, 16> {
+        typedef PDDR reg;
+        static const char* name() { return "rx_power_lane1"; }
+    };
+    struct rx_power_lane0 : AdbRegField<0x2d0, 16> {
+        typedef PDDR reg;
+        static const char* name() { return "rx_power_lane0"; }
+    };
+    struct rx_power_lane3 : AdbRegField<0x2e0, 16> {
+        typedef PDDR reg;
+        static const char* name() { return "rx_power_lane3"; }
+    };
+    struct rx_power_lane2 : AdbRegField<0x2f0, 16> {
+        typedef PDDR reg;
+        static const char* name() { return "rx_power_lane2"; }
+    };
+    struct rx_power_lane5 : AdbRegField<0x300, 16> {
+        typedef PDDR reg;
+        static const char* name() { return "rx_power_lane5"; }
+    };
+    struct rx_power_lane4 : AdbRegField<0x310, 16> {
+        typedef PDDR reg;
+        static const char* name() { return "rx_power_lane4"; }
+    };
+    struct rx_power_lane7 : AdbRegField<0x320, 16> {
+        typedef PDDR reg;
+        static const char* name() { return "rx_power_lane7"; }
+    };
+    struct rx_power_lane6 : AdbRegField<0x330, 16> {
+        typedef PDDR reg;
+        static const char* name() { return "rx_power_lane6"; }
+    };
+    struct tx_power_lane1 : AdbRegField<0x340, 16> {
+        typedef PDDR reg;
+        static const char* name() { return "tx_power_lane1"; }
+    };
+    struct tx_power_lane0 : AdbRegField<0x350, 16> {
+        typedef PDDR reg;
+        static const char* name() { return "tx_power_lane0"; }
+    };
+    struct tx_power_lane3 : AdbRegField<0x360, 16> {
+        typedef PDDR reg;
+        static const char* name() { return "tx_power_lane3"; }
+    };
+    struct tx_power_lane2 : AdbRegField<0x370, 16> {
+        typedef PDDR reg;
+        static const char* name() { return "tx_power_lane2"; }
+    };
+    struct tx_power_lane5 : AdbRegField<0x380, 16> {
+        typedef PDDR reg;
+        static const char* name() { return "tx_power_lane5"; }
+    };
+    struct tx_power_lane4 : AdbRegField<0x390, 16> {
+        typedef PDDR reg;
+        static const char* name() { return "tx_power_lane4"; }
+    };
+    struct tx_power_lane7 : AdbRegField<0x3a0, 16> {
+        typedef PDDR reg;
+        static const char* name() { return "tx_power_lane7"; }
+    };
+    struct tx_power_lane6 : AdbRegField<0x3b0, 16> {
+        typedef PDDR reg;
+        static const char* name() { return "tx_power_lane6"; }
+    };
+    struct tx_bias_lane1 : AdbRegField<0x3c0, 16> {
+        typedef PDDR reg;
+        static const char* name() { return "tx_bias_lane1"; }
+    };
+    struct tx_bias_lane0 : AdbRegField<0x3d0, 16> {
+        typedef PDDR reg;
+        static const char* name() { return "tx_bias_lane0"; }
+    };
+    struct tx_bias_lane3 : AdbRegField<0x3e0, 16> {
+        typedef PDDR reg;
+        static const char* name() { return "tx_bias_lane3"; }
+    };
+    struct tx_bias_lane2 : AdbRegField<0x3f0, 16> {
+        typedef PDDR reg;
+        static const char* name() { return "tx_bias_lane2"; }
+    };
+    struct tx_bias_lane5 : AdbRegField<0x400, 16> {
+        typedef PDDR reg;
+        static const char* name() { return "tx_bias_lane5"; }
+    };
+    struct tx_bias_lane4 : AdbRegField<0x410, 16> {
+        typedef PDDR reg;
+        static const char* name() { return "tx_bias_lane4"; }
+    };
+    struct tx_bias_lane7 : AdbRegField<0x420, 16> {
+        typedef PDDR reg;
+        static const char* name() { return "tx_bias_lane7"; }
+    };
+    struct tx_bias_lane6 : AdbRegField<0x430, 16> {
+        typedef PDDR reg;
+        static const char* name() { return "tx_bias_lane6"; }
+    };
+    struct temperature_low_th : AdbRegField<0x440, 16> {
+        typedef PDDR reg;
+        static const char* name() { return "temperature_low_th"; }
+    };
+    struct temperature_high_th : AdbRegField<0x450, 16> {
+        typedef PDDR reg;
+        static const char* name() { return "temperature_high_th"; }
+    };
+    struct voltage_low_th : AdbRegField<0x460, 16> {
+        typedef PDDR reg;
+        static const char* name() { return "voltage_low_th"; }
+    };
+    struct voltage_high_th : AdbRegField<0x470, 16> {
+        typedef PDDR reg;
+        static const char* name() { return "voltage_high_th"; }
+    };
+    struct rx_power_low_th : AdbRegField<0x480, 16> {
+        typedef PDDR reg;
+        static const char* name() { return "rx_power_low_th"; }
+    };
+    struct rx_power_high_th : AdbRegField<0x490, 16> {
+        typedef PDDR reg;
+        static const char* name() { return "rx_power_high_th"; }
+    };
+    struct tx_power_low_th : AdbRegField<0x4a0, 16> {
+        typedef PDDR reg;
+        static const char* name() { return "tx_power_low_th"; }
+    };
+    struct tx_power_high_th : AdbRegField<0x4b0, 16> {
+        typedef PDDR reg;
+        static const char* name() { return "tx_power_high_th"; }
+    };
+    struct tx_bias_low_th : AdbRegField<0x4c0, 16> {
+        typedef PDDR reg;
+        static const char* name() { return "tx_bias_low_th"; }
+    };
+    struct tx_bias_high_th : AdbRegField<0x4d0, 16> {
+        typedef PDDR reg;
+        static const char* name() { return "tx_bias_high_th"; }
+    };
+    struct wavelength : AdbRegField<0x4e0, 16> {
+        typedef PDDR reg;
+        static const char* name() { return "wavelength"; }
+    };
+    struct smf_length : AdbRegField<0x4f0, 10> {
+        typedef PDDR reg;
+        static const char* name() { return "smf_length"; }
+    };
+    struct did_cap : AdbRegField<0x4fb, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "did_cap"; }
+    };
+    struct rx_power_type : AdbRegField<0x4fc, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "rx_power_type"; }
+    };
+    struct module_st : AdbRegField<0x4fd, 3> {
+        typedef PDDR reg;
+        static const char* name() { return "module_st"; }
+    };
+    struct ib_compliance_code : AdbRegField<0x500, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "ib_compliance_code"; }
+    };
+    struct active_set_media_compliance_code : AdbRegField<0x510, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "active_set_media_compliance_code"; }
+    };
+    struct active_set_host_compliance_code : AdbRegField<0x518, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "active_set_host_compliance_code"; }
+    };
+    struct ib_width : AdbRegField<0x520, 6> {
+        typedef PDDR reg;
+        static const char* name() { return "ib_width"; }
+    };
+    struct monitor_cap_mask : AdbRegField<0x528, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "monitor_cap_mask"; }
+    };
+    struct nbr_100 : AdbRegField<0x530, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "nbr_100"; }
+    };
+    struct nbr_250 : AdbRegField<0x538, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "nbr_250"; }
+    };
+    struct dp_st_lane7 : AdbRegField<0x540, 4> {
+        typedef PDDR reg;
+        static const char* name() { return "dp_st_lane7"; }
+    };
+    struct dp_st_lane6 : AdbRegField<0x544, 4> {
+        typedef PDDR reg;
+        static const char* name() { return "dp_st_lane6"; }
+    };
+    struct dp_st_lane5 : AdbRegField<0x548, 4> {
+        typedef PDDR reg;
+        static const char* name() { return "dp_st_lane5"; }
+    };
+    struct dp_st_lane4 : AdbRegField<0x54c, 4> {
+        typedef PDDR reg;
+        static const char* name() { return "dp_st_lane4"; }
+    };
+    struct dp_st_lane3 : AdbRegField<0x550, 4> {
+        typedef PDDR reg;
+        static const char* name() { return "dp_st_lane3"; }
+    };
+    struct dp_st_lane2 : AdbRegField<0x554, 4> {
+        typedef PDDR reg;
+        static const char* name() { return "dp_st_lane2"; }
+    };
+    struct dp_st_lane1 : AdbRegField<0x558, 4> {
+        typedef PDDR reg;
+        static const char* name() { return "dp_st_lane1"; }
+    };
+    struct dp_st_lane0 : AdbRegField<0x55c, 4> {
+        typedef PDDR reg;
+        static const char* name() { return "dp_st_lane0"; }
+    };
+    struct length_om5 : AdbRegField<0x560, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "length_om5"; }
+    };
+    struct length_om4 : AdbRegField<0x568, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "length_om4"; }
+    };
+    struct length_om3 : AdbRegField<0x570, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "length_om3"; }
+    };
+    struct length_om2 : AdbRegField<0x578, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "length_om2"; }
+    };
+    struct memory_map_rev : AdbRegField<0x580, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "memory_map_rev"; }
+    };
+    struct wavelength_tolerance : AdbRegField<0x588, 16> {
+        typedef PDDR reg;
+        static const char* name() { return "wavelength_tolerance"; }
+    };
+    struct length_om1 : AdbRegField<0x598, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "length_om1"; }
+    };
+    struct memory_map_compliance : AdbRegField<0x5a0, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "memory_map_compliance"; }
+    };
+    struct hi : AdbRegField<0x5c0, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "hi"; }
+    };
+    struct lo : AdbRegField<0x5e0, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "lo"; }
+    };
+    struct vendor_oui : AdbRegField<0x600, 24> {
+        typedef PDDR reg;
+        static const char* name() { return "vendor_oui"; }
+    };
+    struct connector_type : AdbRegField<0x618, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "connector_type"; }
+    };
+    struct rx_output_valid : AdbRegField<0x620, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "rx_output_valid"; }
+    };
+    struct rx_input_valid : AdbRegField<0x628, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "rx_input_valid"; }
+    };
+    struct invalid_fsm_sv : AdbRegField<0x5f, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "invalid_fsm_sv"; }
+    };
+    struct protocol_check : AdbRegField<0x60, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "protocol_check"; }
+    };
+    struct protocol_check_sv : AdbRegField<0x61, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "protocol_check_sv"; }
+    };
+    struct pm_fifo_full : AdbRegField<0x62, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "pm_fifo_full"; }
+    };
+    struct pm_fifo_full_sv : AdbRegField<0x63, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "pm_fifo_full_sv"; }
+    };
+    struct mod_adapt_faild : AdbRegField<0x64, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "mod_adapt_faild"; }
+    };
+    struct mod_adapt_faild_sv : AdbRegField<0x65, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "mod_adapt_faild_sv"; }
+    };
+    struct mod_config_to : AdbRegField<0x66, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "mod_config_to"; }
+    };
+    struct mod_config_to_sv : AdbRegField<0x67, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "mod_config_to_sv"; }
+    };
+    struct mod_req_busy : AdbRegField<0x68, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "mod_req_busy"; }
+    };
+    struct mod_req_busy_sv : AdbRegField<0x69, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "mod_req_busy_sv"; }
+    };
+    struct mod_req_nack : AdbRegField<0x6a, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "mod_req_nack"; }
+    };
+    struct mod_req_nack_sv : AdbRegField<0x6b, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "mod_req_nack_sv"; }
+    };
+    struct kr_false_ready : AdbRegField<0x70, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "kr_false_ready"; }
+    };
+    struct kr_false_ready_sv : AdbRegField<0x71, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "kr_false_ready_sv"; }
+    };
+    struct input_event_sv : AdbRegField<0x9f, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "input_event_sv"; }
+    };
+    struct qsfp_zero_atten_sv : AdbRegField<0xa1, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "qsfp_zero_atten_sv"; }
+    };
+    struct lane_mapping : AdbRegField<0xa2, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "lane_mapping"; }
+    };
+    struct lane_mapping_sv : AdbRegField<0xa3, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "lane_mapping_sv"; }
+    };
+    struct init_all_gains_bad_val_sv : AdbRegField<0xc1, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "init_all_gains_bad_val_sv"; }
+    };
+    struct single_gains_bad_val : AdbRegField<0xc2, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "single_gains_bad_val"; }
+    };
+    struct single_gains_bad_val_sv : AdbRegField<0xc3, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "single_gains_bad_val_sv"; }
+    };
+    struct mono_flow_height_sv : AdbRegField<0xc5, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "mono_flow_height_sv"; }
+    };
+    struct mono_reach_high_limit : AdbRegField<0xc6, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "mono_reach_high_limit"; }
+    };
+    struct mono_reach_high_limit_sv : AdbRegField<0xc7, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "mono_reach_high_limit_sv"; }
+    };
+    struct mono_reach_low_limit : AdbRegField<0xc8, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "mono_reach_low_limit"; }
+    };
+    struct mono_reach_low_limit_sv : AdbRegField<0xc9, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "mono_reach_low_limit_sv"; }
+    };
+    struct clr_mask_0 : AdbRegField<0x140, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "clr_mask[0]"; }
+    };
+    struct clr_mask_1 : AdbRegField<0x160, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "clr_mask[1]"; }
+    };
+    struct clr_mask_2 : AdbRegField<0x180, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "clr_mask[2]"; }
+    };
+    struct clr_mask_3 : AdbRegField<0x1a0, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "clr_mask[3]"; }
+    };
+    struct clr_mask_4 : AdbRegField<0x1c0, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "clr_mask[4]"; }
+    };
+    struct clr_mask_5 : AdbRegField<0x1e0, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "clr_mask[5]"; }
+    };
+    struct clr_mask_6 : AdbRegField<0x200, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "clr_mask[6]"; }
+    };
+    struct clr_mask_7 : AdbRegField<0x220, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "clr_mask[7]"; }
+    };
+    struct invalid_port_access_sv : AdbRegField<0x5f, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "invalid_port_access_sv"; }
+    };
+    struct pll_state_mask_center0 : AdbRegField<0x60, 4> {
+        typedef PDDR reg;
+        static const char* name() { return "pll_state_mask_center0"; }
+    };
+    struct pll_state_sv_0 : AdbRegField<0x68, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "pll_state_sv_0"; }
+    };
+    struct pll_state_mask_center1 : AdbRegField<0x70, 4> {
+        typedef PDDR reg;
+        static const char* name() { return "pll_state_mask_center1"; }
+    };
+    struct pll_state_sv_1 : AdbRegField<0x78, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "pll_state_sv_1"; }
+    };
+    struct varactors_calib_fail_center0 : AdbRegField<0x80, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "varactors_calib_fail_center0"; }
+    };
+    struct varactors_calib_fail_center0_sv : AdbRegField<0x81, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "varactors_calib_fail_center0_sv"; }
+    };
+    struct varactors_calib_fail_center1 : AdbRegField<0x82, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "varactors_calib_fail_center1"; }
+    };
+    struct varactors_calib_fail_center1_sv : AdbRegField<0x83, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "varactors_calib_fail_center1_sv"; }
+    };
+    struct logical_phy_to : AdbRegField<0x84, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "logical_phy_to"; }
+    };
+    struct logical_phy_to_sv : AdbRegField<0x85, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "logical_phy_to_sv"; }
+    };
+    struct analog_phy_to : AdbRegField<0x86, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "analog_phy_to"; }
+    };
+    struct analog_phy_to_sv : AdbRegField<0x87, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "analog_phy_to_sv"; }
+    };
+    struct cr_space_timeout : AdbRegField<0x90, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "cr_space_timeout"; }
+    };
+    struct cr_space_timeout_sv : AdbRegField<0x91, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "cr_space_timeout_sv"; }
+    };
+    struct cr_space_timeout_mcm_main : AdbRegField<0x92, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "cr_space_timeout_mcm_main"; }
+    };
+    struct irisc_stuck_mask_sv : AdbRegField<0xbf, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "irisc_stuck_mask_sv"; }
+    };
+    struct pll_unlocl_mask_center0 : AdbRegField<0xe0, 4> {
+        typedef PDDR reg;
+        static const char* name() { return "pll_unlocl_mask_center0"; }
+    };
+    struct pll_lock_sv_0 : AdbRegField<0xe8, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "pll_lock_sv_0"; }
+    };
+    struct pll_unlocl_mask_center1 : AdbRegField<0xf0, 4> {
+        typedef PDDR reg;
+        static const char* name() { return "pll_unlocl_mask_center1"; }
+    };
+    struct pll_lock_sv_1 : AdbRegField<0xf8, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "pll_lock_sv_1"; }
+    };
+    struct iopl_err_center0 : AdbRegField<0x100, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "iopl_err_center0"; }
+    };
+    struct iopl_err_center0_sv : AdbRegField<0x101, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "iopl_err_center0_sv"; }
+    };
+    struct iopl_err_center1 : AdbRegField<0x102, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "iopl_err_center1"; }
+    };
+    struct iopl_err_center1_sv : AdbRegField<0x103, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "iopl_err_center1_sv"; }
+    };
+    struct pwr_governor_err : AdbRegField<0x110, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "pwr_governor_err"; }
+    };
+    struct pwr_governor_err_sv : AdbRegField<0x111, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "pwr_governor_err_sv"; }
+    };
+    struct down_blame : AdbRegField<0x40, 4> {
+        typedef PDDR reg;
+        static const char* name() { return "down_blame"; }
+    };
+    struct local_reason_opcode : AdbRegField<0x60, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "local_reason_opcode"; }
+    };
+    struct remote_reason_opcode : AdbRegField<0x80, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "remote_reason_opcode"; }
+    };
+    struct e2e_reason_opcode : AdbRegField<0xa0, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "e2e_reason_opcode"; }
+    };
+    struct ber_exp : AdbRegField<0xc0, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "ber_exp"; }
+    };
+    struct ber_mantissa : AdbRegField<0xc8, 4> {
+        typedef PDDR reg;
+        static const char* name() { return "ber_mantissa"; }
+    };
+    struct last_ber_exp : AdbRegField<0xd0, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "last_ber_exp"; }
+    };
+    struct last_ber_mantissa : AdbRegField<0xd8, 4> {
+        typedef PDDR reg;
+        static const char* name() { return "last_ber_mantissa"; }
+    };
+    struct max_ber_exp : AdbRegField<0xe0, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "max_ber_exp"; }
+    };
+    struct max_ber_mantissa : AdbRegField<0xe8, 4> {
+        typedef PDDR reg;
+        static const char* name() { return "max_ber_mantissa"; }
+    };
+    struct min_ber_exp : AdbRegField<0xf0, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "min_ber_exp"; }
+    };
+    struct min_ber_mantissa : AdbRegField<0xf8, 4> {
+        typedef PDDR reg;
+        static const char* name() { return "min_ber_mantissa"; }
+    };
+    struct num_of_ber_alarams : AdbRegField<0x100, 16> {
+        typedef PDDR reg;
+        static const char* name() { return "num_of_ber_alarams"; }
+    };
+    struct ib_port_events : AdbRegField<0x40, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "ib_port_events"; }
+    };
+    struct etherent_port_events : AdbRegField<0x80, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "etherent_port_events"; }
+    };
+    struct general_port_events : AdbRegField<0xc0, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "general_port_events"; }
+    };
+    struct up_reason_mng : AdbRegField<0x40, 4> {
+        typedef PDDR reg;
+        static const char* name() { return "up_reason_mng"; }
+    };
+    struct up_reason_drv : AdbRegField<0x48, 4> {
+        typedef PDDR reg;
+        static const char* name() { return "up_reason_drv"; }
+    };
+    struct up_reason_pwr : AdbRegField<0x50, 4> {
+        typedef PDDR reg;
+        static const char* name() { return "up_reason_pwr"; }
+    };
+    struct time_to_link_up : AdbRegField<0x60, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "time_to_link_up"; }
+    };
+    struct fast_link_up_status : AdbRegField<0x80, 4> {
+        typedef PDDR reg;
+        static const char* name() { return "fast_link_up_status"; }
+    };
+    struct time_to_link_up_ext : AdbRegField<0xa0, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "time_to_link_up_ext"; }
+    };
+    struct dp_fw_fault : AdbRegField<0x56, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "dp_fw_fault"; }
+    };
+    struct mod_fw_fault : AdbRegField<0x57, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "mod_fw_fault"; }
+    };
+    struct vcc_flags : AdbRegField<0x58, 4> {
+        typedef PDDR reg;
+        static const char* name() { return "vcc_flags"; }
+    };
+    struct temp_flags : AdbRegField<0x5c, 4> {
+        typedef PDDR reg;
+        static const char* name() { return "temp_flags"; }
+    };
+    struct tx_ad_eq_fault : AdbRegField<0x60, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "tx_ad_eq_fault"; }
+    };
+    struct tx_cdr_lol : AdbRegField<0x68, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "tx_cdr_lol"; }
+    };
+    struct tx_los : AdbRegField<0x70, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "tx_los"; }
+    };
+    struct tx_fault : AdbRegField<0x78, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "tx_fault"; }
+    };
+    struct tx_power_lo_war : AdbRegField<0x80, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "tx_power_lo_war"; }
+    };
+    struct tx_power_hi_war : AdbRegField<0x88, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "tx_power_hi_war"; }
+    };
+    struct tx_power_lo_al : AdbRegField<0x90, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "tx_power_lo_al"; }
+    };
+    struct tx_power_hi_al : AdbRegField<0x98, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "tx_power_hi_al"; }
+    };
+    struct tx_bias_lo_war : AdbRegField<0xa0, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "tx_bias_lo_war"; }
+    };
+    struct tx_bias_hi_war : AdbRegField<0xa8, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "tx_bias_hi_war"; }
+    };
+    struct tx_bias_lo_al : AdbRegField<0xb0, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "tx_bias_lo_al"; }
+    };
+    struct tx_bias_hi_al : AdbRegField<0xb8, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "tx_bias_hi_al"; }
+    };
+    struct rx_cdr_lol : AdbRegField<0xd0, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "rx_cdr_lol"; }
+    };
+    struct rx_los : AdbRegField<0xd8, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "rx_los"; }
+    };
+    struct rx_power_lo_war : AdbRegField<0xe0, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "rx_power_lo_war"; }
+    };
+    struct rx_power_hi_war : AdbRegField<0xe8, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "rx_power_hi_war"; }
+    };
+    struct rx_power_lo_al : AdbRegField<0xf0, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "rx_power_lo_al"; }
+    };
+    struct rx_power_hi_al : AdbRegField<0xf8, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "rx_power_hi_al"; }
+    };
+    struct rx_output_valid_change : AdbRegField<0x100, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "rx_output_valid_change"; }
+    };
+    struct rx_input_valid_change : AdbRegField<0x108, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "rx_input_valid_change"; }
+    };
+    struct tracer_enable : AdbRegField<0x40, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "tracer_enable"; }
+    };
+    struct reset_tracer : AdbRegField<0x41, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "reset_tracer"; }
+    };
+    struct tracer_mode : AdbRegField<0x42, 3> {
+        typedef PDDR reg;
+        static const char* name() { return "tracer_mode"; }
+    };
+    struct pre_trigger_buff_mode : AdbRegField<0x45, 3> {
+        typedef PDDR reg;
+        static const char* name() { return "pre_trigger_buff_mode"; }
+    };
+    struct trigger_cond_fsm : AdbRegField<0x48, 5> {
+        typedef PDDR reg;
+        static const char* name() { return "trigger_cond_fsm"; }
+    };
+    struct trigger_cond_state_or_event : AdbRegField<0x4d, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "trigger_cond_state_or_event"; }
+    };
+    struct trigger_cond_state_event_val : AdbRegField<0x4e, 7> {
+        typedef PDDR reg;
+        static const char* name() { return "trigger_cond_state_event_val"; }
+    };
+    struct trigger_active : AdbRegField<0x55, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "trigger_active"; }
+    };
+    struct pport : AdbRegField<0x56, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "pport"; }
+    };
+    struct fsm_mask : AdbRegField<0x60, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "fsm_mask"; }
+    };
+    struct buffer_size : AdbRegField<0x80, 12> {
+        typedef PDDR reg;
+        static const char* name() { return "buffer_size"; }
+    };
+    struct trigger_ptr : AdbRegField<0x8c, 12> {
+        typedef PDDR reg;
+        static const char* name() { return "trigger_ptr"; }
+    };
+    struct ptr_next_write : AdbRegField<0xa0, 12> {
+        typedef PDDR reg;
+        static const char* name() { return "ptr_next_write"; }
+    };
+    struct ptr_log_data : AdbRegField<0xac, 12> {
+        typedef PDDR reg;
+        static const char* name() { return "ptr_log_data"; }
+    };
+    struct buffer_base_address : AdbRegField<0xc0, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "buffer_base_address"; }
+    };
+    struct fw_module_state : AdbRegField<0x40, 4> {
+        typedef PDDR reg;
+        static const char* name() { return "fw_module_state"; }
+    };
+    struct fw_dp_state_lane0 : AdbRegField<0x60, 4> {
+        typedef PDDR reg;
+        static const char* name() { return "fw_dp_state_lane0"; }
+    };
+    struct fw_dp_state_lane1 : AdbRegField<0x64, 4> {
+        typedef PDDR reg;
+        static const char* name() { return "fw_dp_state_lane1"; }
+    };
+    struct fw_dp_state_lane2 : AdbRegField<0x68, 4> {
+        typedef PDDR reg;
+        static const char* name() { return "fw_dp_state_lane2"; }
+    };
+    struct fw_dp_state_lane3 : AdbRegField<0x6c, 4> {
+        typedef PDDR reg;
+        static const char* name() { return "fw_dp_state_lane3"; }
+    };
+    struct fw_dp_state_lane4 : AdbRegField<0x70, 4> {
+        typedef PDDR reg;
+        static const char* name() { return "fw_dp_state_lane4"; }
+    };
+    struct fw_dp_state_lane5 : AdbRegField<0x74, 4> {
+        typedef PDDR reg;
+        static const char* name() { return "fw_dp_state_lane5"; }
+    };
+    struct fw_dp_state_lane6 : AdbRegField<0x78, 4> {
+        typedef PDDR reg;
+        static const char* name() { return "fw_dp_state_lane6"; }
+    };
+    struct fw_dp_state_lane7 : AdbRegField<0x7c, 4> {
+        typedef PDDR reg;
+        static const char* name() { return "fw_dp_state_lane7"; }
+    };
+    struct dp_req_status_lane0 : AdbRegField<0x80, 4> {
+        typedef PDDR reg;
+        static const char* name() { return "dp_req_status_lane0"; }
+    };
+    struct dp_req_status_lane1 : AdbRegField<0x84, 4> {
+        typedef PDDR reg;
+        static const char* name() { return "dp_req_status_lane1"; }
+    };
+    struct dp_req_status_lane2 : AdbRegField<0x88, 4> {
+        typedef PDDR reg;
+        static const char* name() { return "dp_req_status_lane2"; }
+    };
+    struct dp_req_status_lane3 : AdbRegField<0x8c, 4> {
+        typedef PDDR reg;
+        static const char* name() { return "dp_req_status_lane3"; }
+    };
+    struct dp_req_status_lane4 : AdbRegField<0x90, 4> {
+        typedef PDDR reg;
+        static const char* name() { return "dp_req_status_lane4"; }
+    };
+    struct dp_req_status_lane5 : AdbRegField<0x94, 4> {
+        typedef PDDR reg;
+        static const char* name() { return "dp_req_status_lane5"; }
+    };
+    struct dp_req_status_lane6 : AdbRegField<0x98, 4> {
+        typedef PDDR reg;
+        static const char* name() { return "dp_req_status_lane6"; }
+    };
+    struct dp_req_status_lane7 : AdbRegField<0x9c, 4> {
+        typedef PDDR reg;
+        static const char* name() { return "dp_req_status_lane7"; }
+    };
+    struct dpsm_apply_state_lane0 : AdbRegField<0xa0, 4> {
+        typedef PDDR reg;
+        static const char* name() { return "dpsm_apply_state_lane0"; }
+    };
+    struct dpsm_apply_state_lane1 : AdbRegField<0xa4, 4> {
+        typedef PDDR reg;
+        static const char* name() { return "dpsm_apply_state_lane1"; }
+    };
+    struct dpsm_apply_state_lane2 : AdbRegField<0xa8, 4> {
+        typedef PDDR reg;
+        static const char* name() { return "dpsm_apply_state_lane2"; }
+    };
+    struct dpsm_apply_state_lane3 : AdbRegField<0xac, 4> {
+        typedef PDDR reg;
+        static const char* name() { return "dpsm_apply_state_lane3"; }
+    };
+    struct dpsm_apply_state_lane4 : AdbRegField<0xb0, 4> {
+        typedef PDDR reg;
+        static const char* name() { return "dpsm_apply_state_lane4"; }
+    };
+    struct dpsm_apply_state_lane5 : AdbRegField<0xb4, 4> {
+        typedef PDDR reg;
+        static const char* name() { return "dpsm_apply_state_lane5"; }
+    };
+    struct dpsm_apply_state_lane6 : AdbRegField<0xb8, 4> {
+        typedef PDDR reg;
+        static const char* name() { return "dpsm_apply_state_lane6"; }
+    };
+    struct dpsm_apply_state_lane7 : AdbRegField<0xbc, 4> {
+        typedef PDDR reg;
+        static const char* name() { return "dpsm_apply_state_lane7"; }
+    };
+    struct cause_fec_rx_sync_m_reached_max0 : AdbRegField<0x40, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "cause_fec_rx_sync_m_reached_max0"; }
+    };
+    struct cause_deskew_fifo_overrun : AdbRegField<0x48, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "cause_deskew_fifo_overrun"; }
+    };
+    struct cause_tx_lane_fifo_underrun_l0 : AdbRegField<0x50, 2> {
+        typedef PDDR reg;
+        static const char* name() { return "cause_tx_lane_fifo_underrun_l0"; }
+    };
+    struct cause_rs_rx_lane0_symbol_error : AdbRegField<0x52, 2> {
+        typedef PDDR reg;
+        static const char* name() { return "cause_rs_rx_lane0_symbol_error"; }
+    };
+    struct cause_high_ser : AdbRegField<0x54, 2> {
+        typedef PDDR reg;
+        static const char* name() { return "cause_high_ser"; }
+    };
+    struct cause_as_detected_not_on_slot : AdbRegField<0x56, 2> {
+        typedef PDDR reg;
+        static const char* name() { return "cause_as_detected_not_on_slot"; }
+    };
+    struct symbol_error_counter_lo : AdbRegField<0x60, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "symbol_error_counter_lo"; }
+    };
+    struct symbol_error_counter_hi : AdbRegField<0x80, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "symbol_error_counter_hi"; }
+    };
+    struct uncorrectable_block_counter_lo : AdbRegField<0xa0, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "uncorrectable_block_counter_lo"; }
+    };
+    struct uncorrectable_block_counter_hi : AdbRegField<0xc0, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "uncorrectable_block_counter_hi"; }
+    };
+    struct block_lock_mask_at_fail_port0 : AdbRegField<0xe0, 4> {
+        typedef PDDR reg;
+        static const char* name() { return "block_lock_mask_at_fail_port0"; }
+    };
+    struct block_lock_mask_at_fail_port1 : AdbRegField<0xe4, 4> {
+        typedef PDDR reg;
+        static const char* name() { return "block_lock_mask_at_fail_port1"; }
+    };
+    struct link_fail_due_align_loss : AdbRegField<0xe8, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "link_fail_due_align_loss"; }
+    };
+    struct link_down_counter : AdbRegField<0x100, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "link_down_counter"; }
+    };
+    struct raw_ber_magnitude : AdbRegField<0x120, 4> {
+        typedef PDDR reg;
+        static const char* name() { return "raw_ber_magnitude"; }
+    };
+    struct raw_ber_coef : AdbRegField<0x124, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "raw_ber_coef"; }
+    };
+    struct effective_ber_magnitude : AdbRegField<0x12c, 4> {
+        typedef PDDR reg;
+        static const char* name() { return "effective_ber_magnitude"; }
+    };
+    struct effective_ber_coef : AdbRegField<0x130, 8> {
+        typedef PDDR reg;
+        static const char* name() { return "effective_ber_coef"; }
+    };
+    struct cause_lane_underrun_l0 : AdbRegField<0x50, 2> {
+        typedef PDDR reg;
+        static const char* name() { return "cause_lane_underrun_l0"; }
+    };
+    struct cause_push_overrun_s0 : AdbRegField<0x52, 2> {
+        typedef PDDR reg;
+        static const char* name() { return "cause_push_overrun_s0"; }
+    };
+    struct cause_usr_align_lost : AdbRegField<0x54, 2> {
+        typedef PDDR reg;
+        static const char* name() { return "cause_usr_align_lost"; }
+    };
+    struct fec_uncorrectable_block_lane0_counter_lo : AdbRegField<0x60, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "fec_uncorrectable_block_lane0_counter_lo"; }
+    };
+    struct fec_uncorrectable_block_lane1_counter_lo : AdbRegField<0x80, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "fec_uncorrectable_block_lane1_counter_lo"; }
+    };
+    struct fec_uncorrectable_block_lane2_counter_lo : AdbRegField<0xa0, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "fec_uncorrectable_block_lane2_counter_lo"; }
+    };
+    struct fec_uncorrectable_block_lane3_counter_lo : AdbRegField<0xc0, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "fec_uncorrectable_block_lane3_counter_lo"; }
+    };
+    struct fec_uncorrectable_block_lane4_counter_lo : AdbRegField<0xe0, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "fec_uncorrectable_block_lane4_counter_lo"; }
+    };
+    struct fec_uncorrectable_block_lane5_counter_lo : AdbRegField<0x100, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "fec_uncorrectable_block_lane5_counter_lo"; }
+    };
+    struct fec_uncorrectable_block_lane6_counter_lo : AdbRegField<0x120, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "fec_uncorrectable_block_lane6_counter_lo"; }
+    };
+    struct fec_uncorrectable_block_lane7_counter_lo : AdbRegField<0x140, 32> {
+        typedef PDDR reg;
+        static const char* name() { return "fec_uncorrectable_block_lane7_counter_lo"; }
+    };
+    struct usr_get_logic_reset_toggled : AdbRegField<0x198, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "usr_get_logic_reset_toggled"; }
+    };
+    struct cause_credit_preemption_fifo_overrun : AdbRegField<0x50, 2> {
+        typedef PDDR reg;
+        static const char* name() { return "cause_credit_preemption_fifo_overrun"; }
+    };
+    struct cause_plu_tx_ports_buffer_overrun : AdbRegField<0x54, 2> {
+        typedef PDDR reg;
+        static const char* name() { return "cause_plu_tx_ports_buffer_overrun"; }
+    };
+    struct cause_port0_framer_rx_fifo_overrun0 : AdbRegField<0x56, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "cause_port0_framer_rx_fifo_overrun0"; }
+    };
+    struct cause_port1_framer_rx_fifo_overrun0 : AdbRegField<0x57, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "cause_port1_framer_rx_fifo_overrun0"; }
+    };
+    struct cause_framer_pad_dw_2_ddw_remainder_overrun_p0s0 : AdbRegField<0x58, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "cause_framer_pad_dw_2_ddw_remainder_overrun_p0s0"; }
+    };
+    struct cause_framer_pad_dw_2_ddw_remainder_overrun_p1s0 : AdbRegField<0x59, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "cause_framer_pad_dw_2_ddw_remainder_overrun_p1s0"; }
+    };
+    struct cause_ptp_fifo_overrun_p0s0 : AdbRegField<0x5a, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "cause_ptp_fifo_overrun_p0s0"; }
+    };
+    struct cause_ptp_fifo_overrun_p1s0 : AdbRegField<0x5b, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "cause_ptp_fifo_overrun_p1s0"; }
+    };
+    struct cause_mode8x_mtu_violation : AdbRegField<0x5c, 1> {
+        typedef PDDR reg;
+        static const char* name() { return "cause_mode8x_mtu_violation"; }
+    };
+    struct cause_rx_local_fault : AdbRegField<0x62, 2> {
+        typedef PDDR reg;
+        static const char* name() { return "cause_rx_local_fault"; }
+    };
+    struct cause_rx_remote_fault : AdbRegField<0x64, 2> {
+        typedef PDDR reg;
+        static const char* name() { return "cause_rx_remote_fault"; }
+    };
+    struct cause_rx_remote_fault_on_linkup : AdbRegField<0x66, 2> {
+        typedef PDDR reg;
+        static const char* name() { return "cause_rx_remote_fault_on_linkup"; }
+    };
+    struct link_goes_down_xaui_xfi : AdbRegField<0x68, 2> {
+        typedef PDDR reg;
+        static const char* name() { return "link_goes_down_xaui_xfi"; }
+    };
+    struct cause_preamble8_fail : AdbRegField<0x6a, 2> {
+        typedef PDDR reg;
+        static const char* name() { return "cause_preamble8_fail"; }
+    };
+
+    static const AdbRegFieldDesc* fields(size_t &count)
+    {
+        static const AdbRegFieldDesc table[] = {
+            { "lp_msb", 0xc, 2 },
+            { "pnat", 0xe, 2 },
+            { "local_port", 0x10, 8 },
+            { "page_select", 0x20, 8 },
+            { "module_info_ext", 0x3d, 2 },
+            { "proto_active", 0x54, 4 },
+            { "ib_phy_fsm_state", 0x68, 8 },
+            { "eth_an_fsm_state", 0x70, 8 },
+            { "phy_mngr_fsm_state", 0x78, 8 },
+            { "phy_manager_link_proto_enabled", 0x80, 16 },
+            { "phy_manager_link_width_enabled", 0x90, 16 },
+            { "phy_manager_link_eth_enabled", 0x80, 32 },
+            { "core_to_phy_link_proto_enabled", 0xa0, 16 },
+            { "core_to_phy_link_width_enabled", 0xb0, 16 },
+            { "core_to_phy_link_eth_enabled", 0xa0, 32 },
+            { "cable_link_speed_cap", 0xc0, 16 },
+            { "cable_link_width_cap", 0xd0, 16 },
+            { "cable_ext_eth_proto_cap", 0xc0, 32 },
+            { "link_speed_active", 0xe0, 16 },
+            { "link_width_active", 0xf0, 16 },
+            { "link_eth_active", 0xe0, 32 },
+            { "loopback_mode", 0x100, 4 },
+            { "fec_mode_request", 0x120, 16 },
+            { "fec_mode_active", 0x130, 16 },
+            { "eth_100g_fec_support", 0x140, 4 },
+            { "eth_25g_50g_fec_support", 0x144, 4 },
+            { "group_opcode", 0x40, 16 },
+            { "monitor_opcode", 0x60, 16 },
+            { "advanced_opcode", 0x60, 16 },
+            { "status_message[0]", 0xa0, 32 },
+            { "status_message[1]", 0xc0, 32 },
+            { "status_message[2]", 0xe0, 32 },
+            { "status_message[3]", 0x100, 32 },
+            { "status_message[4]", 0x120, 32 },
+            { "status_message[5]", 0x140, 32 },
+            { "status_message[6]", 0x160, 32 },
+            { "status_message[7]", 0x180, 32 },
+            { "status_message[8]", 0x1a0, 32 },
+            { "status_message[9]", 0x1c0, 32 },
+            { "status_message[10]", 0x1e0, 32 },
+            { "status_message[11]", 0x200, 32 },
+            { "status_message[12]", 0x220, 32 },
+            { "status_message[13]", 0x240, 32 },
+            { "status_message[14]", 0x260, 32 },
+            { "status_message[15]", 0x280, 32 },
+            { "status_message[16]", 0x2a0, 32 },
+            { "status_message[17]", 0x2c0, 32 },
+            { "status_message[18]", 0x2e0, 32 },
+            { "status_message[19]", 0x300, 32 },
+            { "status_message[20]", 0x320, 32 },
+            { "status_message[21]", 0x340, 32 },
+            { "status_message[22]", 0x360, 32 },
+            { "status_message[23]", 0x380, 32 },
+            { "status_message[24]", 0x3a0, 32 },
+            { "status_message[25]", 0x3c0, 32 },
+            { "status_message[26]", 0x3e0, 32 },
+            { "status_message[27]", 0x400, 32 },
+            { "status_message[28]", 0x420, 32 },
+            { "status_message[29]", 0x440, 32 },
+            { "status_message[30]", 0x460, 32 },
+            { "status_message[31]", 0x480, 32 },
+            { "status_message[32]", 0x4a0, 32 },
+            { "status_message[33]", 0x4c0, 32 },
+            { "status_message[34]", 0x4e0, 32 },
+            { "status_message[35]", 0x500, 32 },
+            { "status_message[36]", 0x520, 32 },
+            { "status_message[37]", 0x540, 32 },
+            { "status_message[38]", 0x560, 32 },
+            { "status_message[39]", 0x580, 32 },
+            { "status_message[40]", 0x5a0, 32 },
+            { "status_message[41]", 0x5c0, 32 },
+            { "status_message[42]", 0x5e0, 32 },
+            { "status_message[43]", 0x600, 32 },
+            { "status_message[44]", 0x620, 32 },
+            { "status_message[45]", 0x640, 32 },
+            { "status_message[46]", 0x660, 32 },
+            { "status_message[47]", 0x680, 32 },
+            { "status_message[48]", 0x6a0, 32 },
+            { "status_message[49]", 0x6c0, 32 },
+            { "status_message[50]", 0x6e0, 32 },
+            { "status_message[51]", 0x700, 32 },
+            { "status_message[52]", 0x720, 32 },
+            { "status_message[53]", 0x740, 32 },
+            { "status_message[54]", 0x760, 32 },
+            { "status_message[55]", 0x780, 32 },
+            { "status_message[56]", 0x7a0, 32 },
+            { "status_message[57]", 0x7c0, 32 },
+            { "status_message[58]", 0x7e0, 32 },
+            { "port_notifications", 0x40, 8 },
+            { "remote_device_type", 0x58, 8 },
+            { "lp_ib_revision", 0x60, 8 },
+            { "ib_revision", 0x68, 8 },
+            { "num_of_negotiation_attempts", 0x70, 16 },
+            { "phy_manger_disable_mask", 0x80, 16 },
+            { "hw_link_phy_state", 0x98, 8 },
+            { "pcs_phy_state", 0xa0, 32 },
+            { "lp_proto_enabled", 0xc0, 32 },
+            { "lp_fec_mode_request", 0xe0, 16 },
+            { "lp_fec_mode_support", 0xf0, 16 },
+            { "ib_last_link_down_reason", 0x100, 32 },
+            { "eth_last_link_down_lane[3]", 0x120, 8 },
+            { "eth_last_link_down_lane[2]", 0x128, 8 },
+            { "eth_last_link_down_lane[1]", 0x130, 8 },
+            { "eth_last_link_down_lane[0]", 0x138, 8 },
+            { "speed_deg_db", 0x160, 32 },
+            { "degrade_grade_lane0", 0x180, 24 },
+            { "degrade_grade_lane1", 0x1a0, 24 },
+            { "degrade_grade_lane2", 0x1c0, 24 },
+            { "degrade_grade_lane3", 0x1e0, 24 },
+            { "kr_startup_fsm_lane[3]", 0x280, 8 },
+            { "kr_startup_fsm_lane[2]", 0x288, 8 },
+            { "kr_startup_fsm_lane[1]", 0x290, 8 },
+            { "kr_startup_fsm_lane[0]", 0x298, 8 },
+            { "eth_an_debug_indication", 0x2c0, 32 },
+            { "ib_phy_fsm_state_trace", 0x2e0, 16 },
+            { "kr_startup_debug_indications[1]", 0x300, 16 },
+            { "kr_startup_debug_indications[0]", 0x310, 16 },
+            { "kr_startup_debug_indications[3]", 0x320, 16 },
+            { "kr_startup_debug_indications[2]", 0x330, 16 },
+            { "irisc_status", 0x380, 4 },
+            { "stamping_reason", 0x3a0, 32 },
+            { "kr_frame_lock_tuning_failure_events_count", 0x3c0, 32 },
+            { "kr_full_tuning_failure_count", 0x3e0, 32 },
+            { "pm_debug_indication", 0x400, 16 },
+            { "pd_debug_indication", 0x440, 32 },
+            { "pd_count", 0x460, 6 },
+            { "fp_signal_detect_count", 0x468, 6 },
+            { "hst_mismatch_reason", 0x470, 2 },
+            { "psi_collision2", 0x476, 5 },
+            { "psi_collision1", 0x47b, 5 },
+            { "ethernet_compliance_code", 0x40, 8 },
+            { "ext_ethernet_compliance_code", 0x48, 8 },
+            { "cable_breakout", 0x50, 8 },
+            { "cable_technology", 0x58, 8 },
+            { "cable_power_class", 0x60, 8 },
+            { "cable_identifier", 0x68, 8 },
+            { "cable_length", 0x70, 8 },
+            { "cable_vendor", 0x78, 4 },
+            { "cable_type", 0x7c, 4 },
+            { "cable_tx_equalization", 0x80, 8 },
+            { "cable_rx_emphasis", 0x88, 8 },
+            { "cable_rx_amp", 0x90, 8 },
+            { "max_power", 0x98, 8 },
+            { "cable_attenuation_5g", 0xa0, 8 },
+            { "cable_attenuation_7g", 0xa8, 8 },
+            { "cable_attenuation_12g", 0xb0, 8 },
+            { "cable_attenuation_25g", 0xb8, 8 },
+            { "tx_cdr_state", 0xc0, 8 },
+            { "rx_cdr_state", 0xc8, 8 },
+            { "tx_cdr_cap", 0xd0, 4 },
+            { "rx_cdr_cap", 0xd4, 4 },
+            { "cable_rx_post_emphasis", 0xd8, 8 },
+            { "vendor_name[0]", 0xe0, 32 },
+            { "vendor_name[1]", 0x100, 32 },
+            { "vendor_name[2]", 0x120, 32 },
+            { "vendor_name[3]", 0x140, 32 },
+            { "vendor_pn[0]", 0x160, 32 },
+            { "vendor_pn[1]", 0x180, 32 },
+            { "vendor_pn[2]", 0x1a0, 32 },
+            { "vendor_pn[3]", 0x1c0, 32 },
+            { "vendor_rev", 0x1e0, 32 },
+            { "fw_version", 0x200, 32 },
+            { "vendor_sn[0]", 0x220, 32 },
+            { "vendor_sn[1]", 0x240, 32 },
+            { "vendor_sn[2]", 0x260, 32 },
+            { "vendor_sn[3]", 0x280, 32 },
+            { "voltage", 0x2a0, 16 },
+            { "temperature", 0x2b0, 16 },
+            { "rx_power_lane1", 0x2c0, 16 },
+            { "rx_power_lane0", 0x2d0, 16 },
+            { "rx_power_lane3", 0x2e0, 16 },
+            { "rx_power_lane2", 0x2f0, 16 },
+            { "rx_power_lane5", 0x300, 16 },
+            { "rx_power_lane4", 0x310, 16 },
+            { "rx_power_lane7", 0x320, 16 },
+            { "rx_power_lane6", 0x330, 16 },
+            { "tx_power_lane1", 0x340, 16 },
+            { "tx_power_lane0", 0x350, 16 },
+            { "tx_power_lane3", 0x360, 16 },
+            { "tx_power_lane2", 0x370, 16 },
+            { "tx_power_lane5", 0x380, 16 },
+            { "tx_power_lane4", 0x390, 16 },
+            { "tx_power_lane7", 0x3a0, 16 },
+            { "tx_power_lane6", 0x3b0, 16 },
+            { "tx_bias_lane1", 0x3c0, 16 },
+            { "tx_bias_lane0", 0x3d0, 16 },
+            { "tx_bias_lane3", 0x3e0, 16 },
+            { "tx_bias_lane2", 0x3f0, 16 },
+            { "tx_bias_lane5", 0x400, 16 },
+            { "tx_bias_lane4", 0x410, 16 },
+            { "tx_bias_lane7", 0x420, 16 },
+            { "tx_bias_lane6", 0x430, 16 },
+            { "temperature_low_th", 0x440, 16 },
+            { "temperature_high_th", 0x450, 16 },
+            { "voltage_low_th", 0x460, 16 },
+            { "voltage_high_th", 0x470, 16 },
+            { "rx_power_low_th", 0x480, 16 },
+            { "rx_power_high_th", 0x490, 16 },
+            { "tx_power_low_th", 0x4a0, 16 },
+            { "tx_power_high_th", 0x4b0, 16 },
+            { "tx_bias_low_th", 0x4c0, 16 },
+            { "tx_bias_high_th", 0x4d0, 16 },
+            { "wavelength", 0x4e0, 16 },
+            { "smf_length", 0x4f0, 10 },
+            { "did_cap", 0x4fb, 1 },
+            { "rx_power_type", 0x4fc, 1 },
+            { "module_st", 0x4fd, 3 },
+            { "ib_compliance_code", 0x500, 8 },
+            { "active_set_media_compliance_code", 0x510, 8 },
+            { "active_set_host_compliance_code", 0x518, 8 },
+            { "ib_width", 0x520, 6 },
+            { "monitor_cap_mask", 0x528, 8 },
+            { "nbr_100", 0x530, 8 },
+            { "nbr_250", 0x538, 8 },
+            { "dp_st_lane7", 0x540, 4 },
+            { "dp_st_lane6", 0x544, 4 },
+            { "dp_st_lane5", 0x548, 4 },
+            { "dp_st_lane4", 0x54c, 4 },
+            { "dp_st_lane3", 0x550, 4 },
+            { "dp_st_lane2", 0x554, 4 },
+            { "dp_st_lane1", 0x558, 4 },
+            { "dp_st_lane0", 0x55c, 4 },
+            { "length_om5", 0x560, 8 },
+            { "length_om4", 0x568, 8 },
+            { "length_om3", 0x570, 8 },
+            { "length_om2", 0x578, 8 },
+            { "memory_map_rev", 0x580, 8 },
+            { "wavelength_tolerance", 0x588, 16 },
+            { "length_om1", 0x598, 8 },
+            { "memory_map_compliance", 0x5a0, 32 },
+            { "hi", 0x5c0, 32 },
+            { "lo", 0x5e0, 32 },
+            { "vendor_oui", 0x600, 24 },
+            { "connector_type", 0x618, 8 },
+            { "rx_output_valid", 0x620, 8 },
+            { "rx_input_valid", 0x628, 8 },
+            { "invalid_fsm_sv", 0x5f, 1 },
+            { "protocol_check", 0x60, 1 },
+            { "protocol_check_sv", 0x61, 1 },
+            { "pm_fifo_full", 0x62, 1 },
+            { "pm_fifo_full_sv", 0x63, 1 },
+            { "mod_adapt_faild", 0x64, 1 },
+            { "mod_adapt_faild_sv", 0x65, 1 },
+            { "mod_config_to", 0x66, 1 },
+            { "mod_config_to_sv", 0x67, 1 },
+            { "mod_req_busy", 0x68, 1 },
+            { "mod_req_busy_sv", 0x69, 1 },
+            { "mod_req_nack", 0x6a, 1 },
+            { "mod_req_nack_sv", 0x6b, 1 },
+            { "kr_false_ready", 0x70, 1 },
+            { "kr_false_ready_sv", 0x71, 1 },
+            { "input_event_sv", 0x9f, 1 },
+            { "qsfp_zero_atten_sv", 0xa1, 1 },
+            { "lane_mapping", 0xa2, 1 },
+            { "lane_mapping_sv", 0xa3, 1 },
+            { "init_all_gains_bad_val_sv", 0xc1, 1 },
+            { "single_gains_bad_val", 0xc2, 1 },
+            { "single_gains_bad_val_sv", 0xc3, 1 },
+            { "mono_flow_height_sv", 0xc5, 1 },
+            { "mono_reach_high_limit", 0xc6, 1 },
+            { "mono_reach_high_limit_sv", 0xc7, 1 },
+            { "mono_reach_low_limit", 0xc8, 1 },
+            { "mono_reach_low_limit_sv", 0xc9, 1 },
+            { "clr_mask[0]", 0x140, 32 },
+            { "clr_mask[1]", 0x160, 32 },
+            { "clr_mask[2]", 0x180, 32 },
+            { "clr_mask[3]", 0x1a0, 32 },
+            { "clr_mask[4]", 0x1c0, 32 },
+            { "clr_mask[5]", 0x1e0, 32 },
+            { "clr_mask[6]", 0x200, 32 },
+            { "clr_mask[7]", 0x220, 32 },
+            { "invalid_port_access_sv", 0x5f, 1 },
+            { "pll_state_mask_center0", 0x60, 4 },
+            { "pll_state_sv_0", 0x68, 1 },
+            { "pll_state_mask_center1", 0x70, 4 },
+            { "pll_state_sv_1", 0x78, 1 },
+            { "varactors_calib_fail_center0", 0x80, 1 },
+            { "varactors_calib_fail_center0_sv", 0x81, 1 },
+            { "varactors_calib_fail_center1", 0x82, 1 },
+            { "varactors_calib_fail_center1_sv", 0x83, 1 },
+            { "logical_phy_to", 0x84, 1 },
+            { "logical_phy_to_sv", 0x85, 1 },
+            { "analog_phy_to", 0x86, 1 },
+            { "analog_phy_to_sv", 0x87, 1 },
+            { "cr_space_timeout", 0x90, 1 },
+            { "cr_space_timeout_sv", 0x91, 1 },
+            { "cr_space_timeout_mcm_main", 0x92, 1 },
+            { "irisc_stuck_mask_sv", 0xbf, 1 },
+            { "pll_unlocl_mask_center0", 0xe0, 4 },
+            { "pll_lock_sv_0", 0xe8, 1 },
+            { "pll_unlocl_mask_center1", 0xf0, 4 },
+            { "pll_lock_sv_1", 0xf8, 1 },
+            { "iopl_err_center0", 0x100, 1 },
+            { "iopl_err_center0_sv", 0x101, 1 },
+            { "iopl_err_center1", 0x102, 1 },
+            { "iopl_err_center1_sv", 0x103, 1 },
+            { "pwr_governor_err", 0x110, 1 },
+            { "pwr_governor_err_sv", 0x111, 1 },
+            { "down_blame", 0x40, 4 },
+            { "local_reason_opcode", 0x60, 8 },
+            { "remote_reason_opcode", 0x80, 8 },
+            { "e2e_reason_opcode", 0xa0, 8 },
+            { "ber_exp", 0xc0, 8 },
+            { "ber_mantissa", 0xc8, 4 },
+            { "last_ber_exp", 0xd0, 8 },
+            { "last_ber_mantissa", 0xd8, 4 },
+            { "max_ber_exp", 0xe0, 8 },
+            { "max_ber_mantissa", 0xe8, 4 },
+            { "min_ber_exp", 0xf0, 8 },
+            { "min_ber_mantissa", 0xf8, 4 },
+            { "num_of_ber_alarams", 0x100, 16 },
+            { "ib_port_events", 0x40, 32 },
+            { "etherent_port_events", 0x80, 32 },
+            { "general_port_events", 0xc0, 32 },
+            { "up_reason_mng", 0x40, 4 },
+            { "up_reason_drv", 0x48, 4 },
+            { "up_reason_pwr", 0x50, 4 },
+            { "time_to_link_up", 0x60, 32 },
+            { "fast_link_up_status", 0x80, 4 },
+            { "time_to_link_up_ext", 0xa0, 32 },
+            { "dp_fw_fault", 0x56, 1 },
+            { "mod_fw_fault", 0x57, 1 },
+            { "vcc_flags", 0x58, 4 },
+            { "temp_flags", 0x5c, 4 },
+            { "tx_ad_eq_fault", 0x60, 8 },
+            { "tx_cdr_lol", 0x68, 8 },
+            { "tx_los", 0x70, 8 },
+            { "tx_fault", 0x78, 8 },
+            { "tx_power_lo_war", 0x80, 8 },
+            { "tx_power_hi_war", 0x88, 8 },
+            { "tx_power_lo_al", 0x90, 8 },
+            { "tx_power_hi_al", 0x98, 8 },
+            { "tx_bias_lo_war", 0xa0, 8 },
+            { "tx_bias_hi_war", 0xa8, 8 },
+            { "tx_bias_lo_al", 0xb0, 8 },
+            { "tx_bias_hi_al", 0xb8, 8 },
+            { "rx_cdr_lol", 0xd0, 8 },
+            { "rx_los", 0xd8, 8 },
+            { "rx_power_lo_war", 0xe0, 8 },
+            { "rx_power_hi_war", 0xe8, 8 },
+            { "rx_power_lo_al", 0xf0, 8 },
+            { "rx_power_hi_al", 0xf8, 8 },
+            { "rx_output_valid_change", 0x100, 8 },
+            { "rx_input_valid_change", 0x108, 8 },
+            { "tracer_enable", 0x40, 1 },
+            { "reset_tracer", 0x41, 1 },
+            { "tracer_mode", 0x42, 3 },
+            { "pre_trigger_buff_mode", 0x45, 3 },
+            { "trigger_cond_fsm", 0x48, 5 },
+            { "trigger_cond_state_or_event", 0x4d, 1 },
+            { "trigger_cond_state_event_val", 0x4e, 7 },
+            { "trigger_active", 0x55, 1 },
+            { "pport", 0x56, 8 },
+            { "fsm_mask", 0x60, 32 },
+            { "buffer_size", 0x80, 12 },
+            { "trigger_ptr", 0x8c, 12 },
+            { "ptr_next_write", 0xa0, 12 },
+            { "ptr_log_data", 0xac, 12 },
+            { "buffer_base_address", 0xc0, 32 },
+            { "fw_module_state", 0x40, 4 },
+            { "fw_dp_state_lane0", 0x60, 4 },
+            { "fw_dp_state_lane1", 0x64, 4 },
+            { "fw_dp_state_lane2", 0x68, 4 },
+            { "fw_dp_state_lane3", 0x6c, 4 },
+            { "fw_dp_state_lane4", 0x70, 4 },
+            { "fw_dp_state_lane5", 0x74, 4 },
+            { "fw_dp_state_lane6", 0x78, 4 },
+            { "fw_dp_state_lane7", 0x7c, 4 },
+            { "dp_req_status_lane0", 0x80, 4 },
+            { "dp_req_status_lane1", 0x84, 4 },
+            { "dp_req_status_lane2", 0x88, 4 },
+            { "dp_req_status_lane3", 0x8c, 4 },
+            { "dp_req_status_lane4", 0x90, 4 },
+            { "dp_req_status_lane5", 0x94, 4 },
+            { "dp_req_status_lane6", 0x98, 4 },
+            { "dp_req_status_lane7", 0x9c, 4 },
+            { "dpsm_apply_state_lane0", 0xa0, 4 },
+            { "dpsm_apply_state_lane1", 0xa4, 4 },
+            { "dpsm_apply_state_lane2", 0xa8, 4 },
+            { "dpsm_apply_state_lane3", 0xac, 4 },
+            { "dpsm_apply_state_lane4", 0xb0, 4 },
+            { "dpsm_apply_state_lane5", 0xb4, 4 },
+            { "dpsm_apply_state_lane6", 0xb8, 4 },
+            { "dpsm_apply_state_lane7", 0xbc, 4 },
+            { "cause_fec_rx_sync_m_reached_max0", 0x40, 8 },
+            { "cause_deskew_fifo_overrun", 0x48, 8 },
+            { "cause_tx_lane_fifo_underrun_l0", 0x50, 2 },
+            { "cause_rs_rx_lane0_symbol_error", 0x52, 2 },
+            { "cause_high_ser", 0x54, 2 },
+            { "cause_as_detected_not_on_slot", 0x56, 2 },
+            { "symbol_error_counter_lo", 0x60, 32 },
+            { "symbol_error_counter_hi", 0x80, 32 },
+            { "uncorrectable_block_counter_lo", 0xa0, 32 },
+            { "uncorrectable_block_counter_hi", 0xc0, 32 },
+            { "block_lock_mask_at_fail_port0", 0xe0, 4 },
+            { "block_lock_mask_at_fail_port1", 0xe4, 4 },
+            { "link_fail_due_align_loss", 0xe8, 1 },
+            { "link_down_counter", 0x100, 32 },
+            { "raw_ber_magnitude", 0x120, 4 },
+            { "raw_ber_coef", 0x124, 8 },
+            { "effective_ber_magnitude", 0x12c, 4 },
+            { "effective_ber_coef", 0x130, 8 },
+            { "cause_lane_underrun_l0", 0x50, 2 },
+            { "cause_push_overrun_s0", 0x52, 2 },
+            { "cause_usr_align_lost", 0x54, 2 },
+            { "fec_uncorrectable_block_lane0_counter_lo", 0x60, 32 },
+            { "fec_uncorrectable_block_lane1_counter_lo", 0x80, 32 },
+            { "fec_uncorrectable_block_lane2_counter_lo", 0xa0, 32 },
+            { "fec_uncorrectable_block_lane3_counter_lo", 0xc0, 32 },
+            { "fec_uncorrectable_block_lane4_counter_lo", 0xe0, 32 },
+            { "fec_uncorrectable_block_lane5_counter_lo", 0x100, 32 },
+            { "fec_uncorrectable_block_lane6_counter_lo", 0x120, 32 },
+            { "fec_uncorrectable_block_lane7_counter_lo", 0x140, 32 },
+            { "usr_get_logic_reset_toggled", 0x198, 1 },
+            { "cause_credit_preemption_fifo_overrun", 0x50, 2 },
+            { "cause_plu_tx_ports_buffer_overrun", 0x54, 2 },
+            { "cause_port0_framer_rx_fifo_overrun0", 0x56, 1 },
+            { "cause_port1_framer_rx_fifo_overrun0", 0x57, 1 },
+            { "cause_framer_pad_dw_2_ddw_remainder_overrun_p0s0", 0x58, 1 },
+            { "cause_framer_pad_dw_2_ddw_remainder_overrun_p1s0", 0x59, 1 },
+            { "cause_ptp_fifo_overrun_p0s0", 0x5a, 1 },
+            { "cause_ptp_fifo_overrun_p1s0", 0x5b, 1 },
+            { "cause_mode8x_mtu_violation", 0x5c, 1 },
+            { "cause_rx_local_fault", 0x62, 2 },
+            { "cause_rx_remote_fault", 0x64, 2 },
+            { "cause_rx_remote_fault_on_linkup", 0x66, 2 },
+            { "link_goes_down_xaui_xfi", 0x68, 2 },
+            { "cause_preamble8_fail", 0x6a, 2 },
+        };
+        count = sizeof(table) / sizeof(table[0]);
+        return table;
+    }
+};
+
+struct PPCNT {
+    static const char* name() { return "PPCNT"; }
+    static constexpr u_int32_t size = 0x800;
+
+    struct grp : AdbRegField<0x0, 6> {
+        typedef PPCNT reg;
+        static const char* name() { return "grp"; }
+    };
+    struct lp_msb : AdbRegField<0xc, 2> {
+        typedef PPCNT reg;
+        static const char* name() { return "lp_msb"; }
+    };
+    struct pnat : AdbRegField<0xe, 2> {
+        typedef PPCNT reg;
+        static const char* name() { return "pnat"; }
+    };
+    struct local_port : AdbRegField<0x10, 8> {
+        typedef PPCNT reg;
+        static const char* name() { return "local_port"; }
+    };
+    struct swid : AdbRegField<0x18, 8> {
+        typedef PPCNT reg;
+        static const char* name() { return "swid"; }
+    };
+    struct prio_tc : AdbRegField<0x20, 5> {
+        typedef PPCNT reg;
+        static const char* name() { return "prio_tc"; }
+    };
+    struct clr : AdbRegField<0x3f, 1> {
+        typedef PPCNT reg;
+        static const char* name() { return "clr"; }
+    };
+    struct a_frames_transmitted_ok_high : AdbRegField<0x40, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "a_frames_transmitted_ok_high"; }
+    };
+    struct a_frames_transmitted_ok_low : AdbRegField<0x60, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "a_frames_transmitted_ok_low"; }
+    };
+    struct a_frames_received_ok_high : AdbRegField<0x80, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "a_frames_received_ok_high"; }
+    };
+    struct a_frames_received_ok_low : AdbRegField<0xa0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "a_frames_received_ok_low"; }
+    };
+    struct a_frame_check_sequence_errors_high : AdbRegField<0xc0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "a_frame_check_sequence_errors_high"; }
+    };
+    struct a_frame_check_sequence_errors_low : AdbRegField<0xe0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "a_frame_check_sequence_errors_low"; }
+    };
+    struct a_alignment_errors_high : AdbRegField<0x100, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "a_alignment_errors_high"; }
+    };
+    struct a_alignment_errors_low : AdbRegField<0x120, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "a_alignment_errors_low"; }
+    };
+    struct a_octets_transmitted_ok_high : AdbRegField<0x140, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "a_octets_transmitted_ok_high"; }
+    };
+    struct a_octets_transmitted_ok_low : AdbRegField<0x160, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "a_octets_transmitted_ok_low"; }
+    };
+    struct a_octets_received_ok_high : AdbRegField<0x180, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "a_octets_received_ok_high"; }
+    };
+    struct a_octets_received_ok_low : AdbRegField<0x1a0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "a_octets_received_ok_low"; }
+    };
+    struct a_multicast_frames_xmitted_ok_high : AdbRegField<0x1c0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "a_multicast_frames_xmitted_ok_high"; }
+    };
+    struct a_multicast_frames_xmitted_ok_low : AdbRegField<0x1e0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "a_multicast_frames_xmitted_ok_low"; }
+    };
+    struct a_broadcast_frames_xmitted_ok_high : AdbRegField<0x200, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "a_broadcast_frames_xmitted_ok_high"; }
+    };
+    struct a_broadcast_frames_xmitted_ok_low : AdbRegField<0x220, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "a_broadcast_frames_xmitted_ok_low"; }
+    };
+    struct a_multicast_frames_received_ok_high : AdbRegField<0x240, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "a_multicast_frames_received_ok_high"; }
+    };
+    struct a_multicast_frames_received_ok_low : AdbRegField<0x260, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "a_multicast_frames_received_ok_low"; }
+    };
+    struct a_broadcast_frames_received_ok_high : AdbRegField<0x280, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "a_broadcast_frames_received_ok_high"; }
+    };
+    struct a_broadcast_frames_received_ok_low : AdbRegField<0x2a0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "a_broadcast_frames_received_ok_low"; }
+    };
+    struct a_in_range_length_errors_high : AdbRegField<0x2c0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "a_in_range_length_errors_high"; }
+    };
+    struct a_in_range_length_errors_low : AdbRegField<0x2e0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "a_in_range_length_errors_low"; }
+    };
+    struct a_out_of_range_length_field_high : AdbRegField<0x300, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "a_out_of_range_length_field_high"; }
+    };
+    struct a_out_of_range_length_field_low : AdbRegField<0x320, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "a_out_of_range_length_field_low"; }
+    };
+    struct a_frame_too_long_errors_high : AdbRegField<0x340, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "a_frame_too_long_errors_high"; }
+    };
+    struct a_frame_too_long_errors_low : AdbRegField<0x360, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "a_frame_too_long_errors_low"; }
+    };
+    struct a_symbol_error_during_carrier_high : AdbRegField<0x380, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "a_symbol_error_during_carrier_high"; }
+    };
+    struct a_symbol_error_during_carrier_low : AdbRegField<0x3a0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "a_symbol_error_during_carrier_low"; }
+    };
+    struct a_mac_control_frames_transmitted_high : AdbRegField<0x3c0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "a_mac_control_frames_transmitted_high"; }
+    };
+    struct a_mac_control_frames_transmitted_low : AdbRegField<0x3e0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "a_mac_control_frames_transmitted_low"; }
+    };
+    struct a_mac_control_frames_received_high : AdbRegField<0x400, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "a_mac_control_frames_received_high"; }
+    };
+    struct a_mac_control_frames_received_low : AdbRegField<0x420, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "a_mac_control_frames_received_low"; }
+    };
+    struct a_unsupported_opcodes_received_high : AdbRegField<0x440, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "a_unsupported_opcodes_received_high"; }
+    };
+    struct a_unsupported_opcodes_received_low : AdbRegField<0x460, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "a_unsupported_opcodes_received_low"; }
+    };
+    struct a_pause_mac_ctrl_frames_received_high : AdbRegField<0x480, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "a_pause_mac_ctrl_frames_received_high"; }
+    };
+    struct a_pause_mac_ctrl_frames_received_low : AdbRegField<0x4a0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "a_pause_mac_ctrl_frames_received_low"; }
+    };
+    struct a_pause_mac_ctrl_frames_transmitted_high : AdbRegField<0x4c0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "a_pause_mac_ctrl_frames_transmitted_high"; }
+    };
+    struct a_pause_mac_ctrl_frames_transmitted_low : AdbRegField<0x4e0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "a_pause_mac_ctrl_frames_transmitted_low"; }
+    };
+    struct if_in_octets_high : AdbRegField<0x40, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "if_in_octets_high"; }
+    };
+    struct if_in_octets_low : AdbRegField<0x60, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "if_in_octets_low"; }
+    };
+    struct if_in_ucast_pkts_high : AdbRegField<0x80, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "if_in_ucast_pkts_high"; }
+    };
+    struct if_in_ucast_pkts_low : AdbRegField<0xa0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "if_in_ucast_pkts_low"; }
+    };
+    struct if_in_discards_high : AdbRegField<0xc0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "if_in_discards_high"; }
+    };
+    struct if_in_discards_low : AdbRegField<0xe0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "if_in_discards_low"; }
+    };
+    struct if_in_errors_high : AdbRegField<0x100, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "if_in_errors_high"; }
+    };
+    struct if_in_errors_low : AdbRegField<0x120, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "if_in_errors_low"; }
+    };
+    struct if_in_unknown_protos_high : AdbRegField<0x140, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "if_in_unknown_protos_high"; }
+    };
+    struct if_in_unknown_protos_low : AdbRegField<0x160, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "if_in_unknown_protos_low"; }
+    };
+    struct if_out_octets_high : AdbRegField<0x180, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "if_out_octets_high"; }
+    };
+    struct if_out_octets_low : AdbRegField<0x1a0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "if_out_octets_low"; }
+    };
+    struct if_out_ucast_pkts_high : AdbRegField<0x1c0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "if_out_ucast_pkts_high"; }
+    };
+    struct if_out_ucast_pkts_low : AdbRegField<0x1e0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "if_out_ucast_pkts_low"; }
+    };
+    struct if_out_discards_high : AdbRegField<0x200, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "if_out_discards_high"; }
+    };
+    struct if_out_discards_low : AdbRegField<0x220, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "if_out_discards_low"; }
+    };
+    struct if_out_errors_high : AdbRegField<0x240, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "if_out_errors_high"; }
+    };
+    struct if_out_errors_low : AdbRegField<0x260, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "if_out_errors_low"; }
+    };
+    struct if_in_multicast_pkts_high : AdbRegField<0x280, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "if_in_multicast_pkts_high"; }
+    };
+    struct if_in_multicast_pkts_low : AdbRegField<0x2a0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "if_in_multicast_pkts_low"; }
+    };
+    struct if_in_broadcast_pkts_high : AdbRegField<0x2c0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "if_in_broadcast_pkts_high"; }
+    };
+    struct if_in_broadcast_pkts_low : AdbRegField<0x2e0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "if_in_broadcast_pkts_low"; }
+    };
+    struct if_out_multicast_pkts_high : AdbRegField<0x300, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "if_out_multicast_pkts_high"; }
+    };
+    struct if_out_multicast_pkts_low : AdbRegField<0x320, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "if_out_multicast_pkts_low"; }
+    };
+    struct if_out_broadcast_pkts_high : AdbRegField<0x340, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "if_out_broadcast_pkts_high"; }
+    };
+    struct if_out_broadcast_pkts_low : AdbRegField<0x360, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "if_out_broadcast_pkts_low"; }
+    };
+    struct ether_stats_drop_events_high : AdbRegField<0x40, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "ether_stats_drop_events_high"; }
+    };
+    struct ether_stats_drop_events_low : AdbRegField<0x60, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "ether_stats_drop_events_low"; }
+    };
+    struct ether_stats_octets_high : AdbRegField<0x80, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "ether_stats_octets_high"; }
+    };
+    struct ether_stats_octets_low : AdbRegField<0xa0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "ether_stats_octets_low"; }
+    };
+    struct ether_stats_pkts_high : AdbRegField<0xc0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "ether_stats_pkts_high"; }
+    };
+    struct ether_stats_pkts_low : AdbRegField<0xe0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "ether_stats_pkts_low"; }
+    };
+    struct ether_stats_broadcast_pkts_high : AdbRegField<0x100, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "ether_stats_broadcast_pkts_high"; }
+    };
+    struct ether_stats_broadcast_pkts_low : AdbRegField<0x120, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "ether_stats_broadcast_pkts_low"; }
+    };
+    struct ether_stats_multicast_pkts_high : AdbRegField<0x140, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "ether_stats_multicast_pkts_high"; }
+    };
+    struct ether_stats_multicast_pkts_low : AdbRegField<0x160, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "ether_stats_multicast_pkts_low"; }
+    };
+    struct ether_stats_crc_align_errors_high : AdbRegField<0x180, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "ether_stats_crc_align_errors_high"; }
+    };
+    struct ether_stats_crc_align_errors_low : AdbRegField<0x1a0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "ether_stats_crc_align_errors_low"; }
+    };
+    struct ether_stats_undersize_pkts_high : AdbRegField<0x1c0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "ether_stats_undersize_pkts_high"; }
+    };
+    struct ether_stats_undersize_pkts_low : AdbRegField<0x1e0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "ether_stats_undersize_pkts_low"; }
+    };
+    struct ether_stats_oversize_pkts_high : AdbRegField<0x200, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "ether_stats_oversize_pkts_high"; }
+    };
+    struct ether_stats_oversize_pkts_low : AdbRegField<0x220, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "ether_stats_oversize_pkts_low"; }
+    };
+    struct ether_stats_fragments_high : AdbRegField<0x240, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "ether_stats_fragments_high"; }
+    };
+    struct ether_stats_fragments_low : AdbRegField<0x260, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "ether_stats_fragments_low"; }
+    };
+    struct ether_stats_jabbers_high : AdbRegField<0x280, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "ether_stats_jabbers_high"; }
+    };
+    struct ether_stats_jabbers_low : AdbRegField<0x2a0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "ether_stats_jabbers_low"; }
+    };
+    struct ether_stats_collisions_high : AdbRegField<0x2c0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "ether_stats_collisions_high"; }
+    };
+    struct ether_stats_collisions_low : AdbRegField<0x2e0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "ether_stats_collisions_low"; }
+    };
+    struct ether_stats_pkts64octets_high : AdbRegField<0x300, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "ether_stats_pkts64octets_high"; }
+    };
+    struct ether_stats_pkts64octets_low : AdbRegField<0x320, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "ether_stats_pkts64octets_low"; }
+    };
+    struct ether_stats_pkts65to127octets_high : AdbRegField<0x340, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "ether_stats_pkts65to127octets_high"; }
+    };
+    struct ether_stats_pkts65to127octets_low : AdbRegField<0x360, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "ether_stats_pkts65to127octets_low"; }
+    };
+    struct ether_stats_pkts128to255octets_high : AdbRegField<0x380, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "ether_stats_pkts128to255octets_high"; }
+    };
+    struct ether_stats_pkts128to255octets_low : AdbRegField<0x3a0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "ether_stats_pkts128to255octets_low"; }
+    };
+    struct ether_stats_pkts256to511octets_high : AdbRegField<0x3c0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "ether_stats_pkts256to511octets_high"; }
+    };
+    struct ether_stats_pkts256to511octets_low : AdbRegField<0x3e0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "ether_stats_pkts256to511octets_low"; }
+    };
+    struct ether_stats_pkts512to1023octets_high : AdbRegField<0x400, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "ether_stats_pkts512to1023octets_high"; }
+    };
+    struct ether_stats_pkts512to1023octets_low : AdbRegField<0x420, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "ether_stats_pkts512to1023octets_low"; }
+    };
+    struct ether_stats_pkts1024to1518octets_high : AdbRegField<0x440, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "ether_stats_pkts1024to1518octets_high"; }
+    };
+    struct ether_stats_pkts1024to1518octets_low : AdbRegField<0x460, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "ether_stats_pkts1024to1518octets_low"; }
+    };
+    struct ether_stats_pkts1519to2047octets_high : AdbRegField<0x480, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "ether_stats_pkts1519to2047octets_high"; }
+    };
+    struct ether_stats_pkts1519to2047octets_low : AdbRegField<0x4a0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "ether_stats_pkts1519to2047octets_low"; }
+    };
+    struct ether_stats_pkts2048to4095octets_high : AdbRegField<0x4c0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "ether_stats_pkts2048to4095octets_high"; }
+    };
+    struct ether_stats_pkts2048to4095octets_low : AdbRegField<0x4e0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "ether_stats_pkts2048to4095octets_low"; }
+    };
+    struct ether_stats_pkts4096to8191octets_high : AdbRegField<0x500, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "ether_stats_pkts4096to8191octets_high"; }
+    };
+    struct ether_stats_pkts4096to8191octets_low : AdbRegField<0x520, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "ether_stats_pkts4096to8191octets_low"; }
+    };
+    struct ether_stats_pkts8192to10239octets_high : AdbRegField<0x540, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "ether_stats_pkts8192to10239octets_high"; }
+    };
+    struct ether_stats_pkts8192to10239octets_low : AdbRegField<0x560, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "ether_stats_pkts8192to10239octets_low"; }
+    };
+    struct dot3stats_alignment_errors_high : AdbRegField<0x40, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "dot3stats_alignment_errors_high"; }
+    };
+    struct dot3stats_alignment_errors_low : AdbRegField<0x60, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "dot3stats_alignment_errors_low"; }
+    };
+    struct dot3stats_fcs_errors_high : AdbRegField<0x80, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "dot3stats_fcs_errors_high"; }
+    };
+    struct dot3stats_fcs_errors_low : AdbRegField<0xa0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "dot3stats_fcs_errors_low"; }
+    };
+    struct dot3stats_single_collision_frames_high : AdbRegField<0xc0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "dot3stats_single_collision_frames_high"; }
+    };
+    struct dot3stats_single_collision_frames_low : AdbRegField<0xe0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "dot3stats_single_collision_frames_low"; }
+    };
+    struct dot3stats_multiple_collision_frames_high : AdbRegField<0x100, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "dot3stats_multiple_collision_frames_high"; }
+    };
+    struct dot3stats_multiple_collision_frames_low : AdbRegField<0x120, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "dot3stats_multiple_collision_frames_low"; }
+    };
+    struct dot3stats_sqe_test_errors_high : AdbRegField<0x140, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "dot3stats_sqe_test_errors_high"; }
+    };
+    struct dot3stats_sqe_test_errors_low : AdbRegField<0x160, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "dot3stats_sqe_test_errors_low"; }
+    };
+    struct dot3stats_deferred_transmissions_high : AdbRegField<0x180, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "dot3stats_deferred_transmissions_high"; }
+    };
+    struct dot3stats_deferred_transmissions_low : AdbRegField<0x1a0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "dot3stats_deferred_transmissions_low"; }
+    };
+    struct dot3stats_late_collisions_high : AdbRegField<0x1c0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "dot3stats_late_collisions_high"; }
+    };
+    struct dot3stats_late_collisions_low : AdbRegField<0x1e0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "dot3stats_late_collisions_low"; }
+    };
+    struct dot3stats_excessive_collisions_high : AdbRegField<0x200, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "dot3stats_excessive_collisions_high"; }
+    };
+    struct dot3stats_excessive_collisions_low : AdbRegField<0x220, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "dot3stats_excessive_collisions_low"; }
+    };
+    struct dot3stats_internal_mac_transmit_errors_high : AdbRegField<0x240, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "dot3stats_internal_mac_transmit_errors_high"; }
+    };
+    struct dot3stats_internal_mac_transmit_errors_low : AdbRegField<0x260, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "dot3stats_internal_mac_transmit_errors_low"; }
+    };
+    struct dot3stats_carrier_sense_errors_high : AdbRegField<0x280, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "dot3stats_carrier_sense_errors_high"; }
+    };
+    struct dot3stats_carrier_sense_errors_low : AdbRegField<0x2a0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "dot3stats_carrier_sense_errors_low"; }
+    };
+    struct dot3stats_frame_too_longs_high : AdbRegField<0x2c0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "dot3stats_frame_too_longs_high"; }
+    };
+    struct dot3stats_frame_too_longs_low : AdbRegField<0x2e0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "dot3stats_frame_too_longs_low"; }
+    };
+    struct dot3stats_internal_mac_receive_errors_high : AdbRegField<0x300, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "dot3stats_internal_mac_receive_errors_high"; }
+    };
+    struct dot3stats_internal_mac_receive_errors_low : AdbRegField<0x320, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "dot3stats_internal_mac_receive_errors_low"; }
+    };
+    struct dot3stats_symbol_errors_high : AdbRegField<0x340, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "dot3stats_symbol_errors_high"; }
+    };
+    struct dot3stats_symbol_errors_low : AdbRegField<0x360, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "dot3stats_symbol_errors_low"; }
+    };
+    struct dot3control_in_unknown_opcodes_high : AdbRegField<0x380, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "dot3control_in_unknown_opcodes_high"; }
+    };
+    struct dot3control_in_unknown_opcodes_low : AdbRegField<0x3a0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "dot3control_in_unknown_opcodes_low"; }
+    };
+    struct dot3in_pause_frames_high : AdbRegField<0x3c0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "dot3in_pause_frames_high"; }
+    };
+    struct dot3in_pause_frames_low : AdbRegField<0x3e0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "dot3in_pause_frames_low"; }
+    };
+    struct dot3out_pause_frames_high : AdbRegField<0x400, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "dot3out_pause_frames_high"; }
+    };
+    struct dot3out_pause_frames_low : AdbRegField<0x420, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "dot3out_pause_frames_low"; }
+    };
+    struct port_transmit_wait_high : AdbRegField<0x40, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "port_transmit_wait_high"; }
+    };
+    struct port_transmit_wait_low : AdbRegField<0x60, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "port_transmit_wait_low"; }
+    };
+    struct ecn_marked_high : AdbRegField<0x80, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "ecn_marked_high"; }
+    };
+    struct ecn_marked_low : AdbRegField<0xa0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "ecn_marked_low"; }
+    };
+    struct no_buffer_discard_mc_high : AdbRegField<0xc0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "no_buffer_discard_mc_high"; }
+    };
+    struct no_buffer_discard_mc_low : AdbRegField<0xe0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "no_buffer_discard_mc_low"; }
+    };
+    struct rx_ebp_high : AdbRegField<0x100, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "rx_ebp_high"; }
+    };
+    struct rx_ebp_low : AdbRegField<0x120, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "rx_ebp_low"; }
+    };
+    struct tx_ebp_high : AdbRegField<0x140, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "tx_ebp_high"; }
+    };
+    struct tx_ebp_low : AdbRegField<0x160, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "tx_ebp_low"; }
+    };
+    struct rx_buffer_almost_full_high : AdbRegField<0x180, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "rx_buffer_almost_full_high"; }
+    };
+    struct rx_buffer_almost_full_low : AdbRegField<0x1a0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "rx_buffer_almost_full_low"; }
+    };
+    struct rx_buffer_full_high : AdbRegField<0x1c0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "rx_buffer_full_high"; }
+    };
+    struct rx_buffer_full_low : AdbRegField<0x1e0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "rx_buffer_full_low"; }
+    };
+    struct rx_icrc_encapsulated_high : AdbRegField<0x200, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "rx_icrc_encapsulated_high"; }
+    };
+    struct rx_icrc_encapsulated_low : AdbRegField<0x220, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "rx_icrc_encapsulated_low"; }
+    };
+    struct tx_stats_pkts64octets_high : AdbRegField<0x2c0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "tx_stats_pkts64octets_high"; }
+    };
+    struct tx_stats_pkts64octets_low : AdbRegField<0x2e0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "tx_stats_pkts64octets_low"; }
+    };
+    struct tx_stats_pkts65to127octets_high : AdbRegField<0x300, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "tx_stats_pkts65to127octets_high"; }
+    };
+    struct tx_stats_pkts65to127octets_low : AdbRegField<0x320, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "tx_stats_pkts65to127octets_low"; }
+    };
+    struct tx_stats_pkts128to255octets_high : AdbRegField<0x340, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "tx_stats_pkts128to255octets_high"; }
+    };
+    struct tx_stats_pkts128to255octets_low : AdbRegField<0x360, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "tx_stats_pkts128to255octets_low"; }
+    };
+    struct tx_stats_pkts256to511octets_high : AdbRegField<0x380, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "tx_stats_pkts256to511octets_high"; }
+    };
+    struct tx_stats_pkts256to511octets_low : AdbRegField<0x3a0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "tx_stats_pkts256to511octets_low"; }
+    };
+    struct tx_stats_pkts512to1023octets_high : AdbRegField<0x3c0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "tx_stats_pkts512to1023octets_high"; }
+    };
+    struct tx_stats_pkts512to1023octets_low : AdbRegField<0x3e0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "tx_stats_pkts512to1023octets_low"; }
+    };
+    struct tx_stats_pkts1024to1518octets_high : AdbRegField<0x400, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "tx_stats_pkts1024to1518octets_high"; }
+    };
+    struct tx_stats_pkts1024to1518octets_low : AdbRegField<0x420, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "tx_stats_pkts1024to1518octets_low"; }
+    };
+    struct tx_stats_pkts1519to2047octets_high : AdbRegField<0x440, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "tx_stats_pkts1519to2047octets_high"; }
+    };
+    struct tx_stats_pkts1519to2047octets_low : AdbRegField<0x460, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "tx_stats_pkts1519to2047octets_low"; }
+    };
+    struct tx_stats_pkts2048to4095octets_high : AdbRegField<0x480, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "tx_stats_pkts2048to4095octets_high"; }
+    };
+    struct tx_stats_pkts2048to4095octets_low : AdbRegField<0x4a0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "tx_stats_pkts2048to4095octets_low"; }
+    };
+    struct tx_stats_pkts4096to8191octets_high : AdbRegField<0x4c0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "tx_stats_pkts4096to8191octets_high"; }
+    };
+    struct tx_stats_pkts4096to8191octets_low : AdbRegField<0x4e0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "tx_stats_pkts4096to8191octets_low"; }
+    };
+    struct tx_stats_pkts8192to10239octets_high : AdbRegField<0x500, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "tx_stats_pkts8192to10239octets_high"; }
+    };
+    struct tx_stats_pkts8192to10239octets_low : AdbRegField<0x520, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "tx_stats_pkts8192to10239octets_low"; }
+    };
+    struct ingress_general_high : AdbRegField<0x40, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "ingress_general_high"; }
+    };
+    struct ingress_general_low : AdbRegField<0x60, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "ingress_general_low"; }
+    };
+    struct ingress_policy_engine_high : AdbRegField<0x80, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "ingress_policy_engine_high"; }
+    };
+    struct ingress_policy_engine_low : AdbRegField<0xa0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "ingress_policy_engine_low"; }
+    };
+    struct ingress_vlan_membership_high : AdbRegField<0xc0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "ingress_vlan_membership_high"; }
+    };
+    struct ingress_vlan_membership_low : AdbRegField<0xe0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "ingress_vlan_membership_low"; }
+    };
+    struct ingress_tag_frame_type_high : AdbRegField<0x100, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "ingress_tag_frame_type_high"; }
+    };
+    struct ingress_tag_frame_type_low : AdbRegField<0x120, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "ingress_tag_frame_type_low"; }
+    };
+    struct egress_vlan_membership_high : AdbRegField<0x140, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "egress_vlan_membership_high"; }
+    };
+    struct egress_vlan_membership_low : AdbRegField<0x160, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "egress_vlan_membership_low"; }
+    };
+    struct loopback_filter_high : AdbRegField<0x180, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "loopback_filter_high"; }
+    };
+    struct loopback_filter_low : AdbRegField<0x1a0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "loopback_filter_low"; }
+    };
+    struct egress_general_high : AdbRegField<0x1c0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "egress_general_high"; }
+    };
+    struct egress_general_low : AdbRegField<0x1e0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "egress_general_low"; }
+    };
+    struct egress_hoq_high : AdbRegField<0x240, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "egress_hoq_high"; }
+    };
+    struct egress_hoq_low : AdbRegField<0x260, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "egress_hoq_low"; }
+    };
+    struct port_isolation_high : AdbRegField<0x280, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "port_isolation_high"; }
+    };
+    struct port_isolation_low : AdbRegField<0x2a0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "port_isolation_low"; }
+    };
+    struct egress_policy_engine_high : AdbRegField<0x2c0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "egress_policy_engine_high"; }
+    };
+    struct egress_policy_engine_low : AdbRegField<0x2e0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "egress_policy_engine_low"; }
+    };
+    struct ingress_tx_link_down_high : AdbRegField<0x300, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "ingress_tx_link_down_high"; }
+    };
+    struct ingress_tx_link_down_low : AdbRegField<0x320, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "ingress_tx_link_down_low"; }
+    };
+    struct egress_stp_filter_high : AdbRegField<0x340, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "egress_stp_filter_high"; }
+    };
+    struct egress_stp_filter_low : AdbRegField<0x360, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "egress_stp_filter_low"; }
+    };
+    struct egress_hoq_stall_high : AdbRegField<0x380, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "egress_hoq_stall_high"; }
+    };
+    struct egress_hoq_stall_low : AdbRegField<0x3a0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "egress_hoq_stall_low"; }
+    };
+    struct egress_sll_high : AdbRegField<0x3c0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "egress_sll_high"; }
+    };
+    struct egress_sll_low : AdbRegField<0x3e0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "egress_sll_low"; }
+    };
+    struct ingress_discard_all_high : AdbRegField<0x400, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "ingress_discard_all_high"; }
+    };
+    struct ingress_discard_all_low : AdbRegField<0x420, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "ingress_discard_all_low"; }
+    };
+    struct llr_rx_cells_high : AdbRegField<0x40, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "llr_rx_cells_high"; }
+    };
+    struct llr_rx_cells_low : AdbRegField<0x60, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "llr_rx_cells_low"; }
+    };
+    struct llr_rx_error_high : AdbRegField<0x80, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "llr_rx_error_high"; }
+    };
+    struct llr_rx_error_low : AdbRegField<0xa0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "llr_rx_error_low"; }
+    };
+    struct llr_rx_crc_error_high : AdbRegField<0xc0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "llr_rx_crc_error_high"; }
+    };
+    struct llr_rx_crc_error_low : AdbRegField<0xe0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "llr_rx_crc_error_low"; }
+    };
+    struct llr_tx_cells_high : AdbRegField<0x100, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "llr_tx_cells_high"; }
+    };
+    struct llr_tx_cells_low : AdbRegField<0x120, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "llr_tx_cells_low"; }
+    };
+    struct llr_tx_ret_cells_high : AdbRegField<0x140, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "llr_tx_ret_cells_high"; }
+    };
+    struct llr_tx_ret_cells_low : AdbRegField<0x160, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "llr_tx_ret_cells_low"; }
+    };
+    struct llr_tx_ret_events_high : AdbRegField<0x180, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "llr_tx_ret_events_high"; }
+    };
+    struct llr_tx_ret_events_low : AdbRegField<0x1a0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "llr_tx_ret_events_low"; }
+    };
+    struct rx_octets_high : AdbRegField<0x40, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "rx_octets_high"; }
+    };
+    struct rx_octets_low : AdbRegField<0x60, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "rx_octets_low"; }
+    };
+    struct rx_frames_high : AdbRegField<0x140, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "rx_frames_high"; }
+    };
+    struct rx_frames_low : AdbRegField<0x160, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "rx_frames_low"; }
+    };
+    struct tx_octets_high : AdbRegField<0x180, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "tx_octets_high"; }
+    };
+    struct tx_octets_low : AdbRegField<0x1a0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "tx_octets_low"; }
+    };
+    struct tx_frames_high : AdbRegField<0x280, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "tx_frames_high"; }
+    };
+    struct tx_frames_low : AdbRegField<0x2a0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "tx_frames_low"; }
+    };
+    struct rx_pause_high : AdbRegField<0x2c0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "rx_pause_high"; }
+    };
+    struct rx_pause_low : AdbRegField<0x2e0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "rx_pause_low"; }
+    };
+    struct rx_pause_duration_high : AdbRegField<0x300, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "rx_pause_duration_high"; }
+    };
+    struct rx_pause_duration_low : AdbRegField<0x320, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "rx_pause_duration_low"; }
+    };
+    struct tx_pause_high : AdbRegField<0x340, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "tx_pause_high"; }
+    };
+    struct tx_pause_low : AdbRegField<0x360, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "tx_pause_low"; }
+    };
+    struct tx_pause_duration_high : AdbRegField<0x380, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "tx_pause_duration_high"; }
+    };
+    struct tx_pause_duration_low : AdbRegField<0x3a0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "tx_pause_duration_low"; }
+    };
+    struct rx_pause_transition_high : AdbRegField<0x3c0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "rx_pause_transition_high"; }
+    };
+    struct rx_pause_transition_low : AdbRegField<0x3e0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "rx_pause_transition_low"; }
+    };
+    struct rx_discards_high : AdbRegField<0x400, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "rx_discards_high"; }
+    };
+    struct rx_discards_low : AdbRegField<0x420, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "rx_discards_low"; }
+    };
+    struct device_stall_minor_watermark_cnt_high : AdbRegField<0x440, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "device_stall_minor_watermark_cnt_high"; }
+    };
+    struct device_stall_minor_watermark_cnt_low : AdbRegField<0x460, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "device_stall_minor_watermark_cnt_low"; }
+    };
+    struct device_stall_critical_watermark_cnt_high : AdbRegField<0x480, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "device_stall_critical_watermark_cnt_high"; }
+    };
+    struct device_stall_critical_watermark_cnt_low : AdbRegField<0x4a0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "device_stall_critical_watermark_cnt_low"; }
+    };
+    struct transmit_queue_high : AdbRegField<0x40, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "transmit_queue_high"; }
+    };
+    struct transmit_queue_low : AdbRegField<0x60, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "transmit_queue_low"; }
+    };
+    struct no_buffer_discard_uc_high : AdbRegField<0x80, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "no_buffer_discard_uc_high"; }
+    };
+    struct no_buffer_discard_uc_low : AdbRegField<0xa0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "no_buffer_discard_uc_low"; }
+    };
+    struct time_since_last_clear_high : AdbRegField<0x40, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "time_since_last_clear_high"; }
+    };
+    struct time_since_last_clear_low : AdbRegField<0x60, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "time_since_last_clear_low"; }
+    };
+    struct symbol_errors_high : AdbRegField<0x80, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "symbol_errors_high"; }
+    };
+    struct symbol_errors_low : AdbRegField<0xa0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "symbol_errors_low"; }
+    };
+    struct sync_headers_errors_high : AdbRegField<0xc0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "sync_headers_errors_high"; }
+    };
+    struct sync_headers_errors_low : AdbRegField<0xe0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "sync_headers_errors_low"; }
+    };
+    struct edpl_bip_errors_lane0_high : AdbRegField<0x100, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "edpl_bip_errors_lane0_high"; }
+    };
+    struct edpl_bip_errors_lane0_low : AdbRegField<0x120, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "edpl_bip_errors_lane0_low"; }
+    };
+    struct edpl_bip_errors_lane1_high : AdbRegField<0x140, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "edpl_bip_errors_lane1_high"; }
+    };
+    struct edpl_bip_errors_lane1_low : AdbRegField<0x160, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "edpl_bip_errors_lane1_low"; }
+    };
+    struct edpl_bip_errors_lane2_high : AdbRegField<0x180, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "edpl_bip_errors_lane2_high"; }
+    };
+    struct edpl_bip_errors_lane2_low : AdbRegField<0x1a0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "edpl_bip_errors_lane2_low"; }
+    };
+    struct edpl_bip_errors_lane3_high : AdbRegField<0x1c0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "edpl_bip_errors_lane3_high"; }
+    };
+    struct edpl_bip_errors_lane3_low : AdbRegField<0x1e0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "edpl_bip_errors_lane3_low"; }
+    };
+    struct fc_fec_corrected_blocks_lane0_high : AdbRegField<0x200, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "fc_fec_corrected_blocks_lane0_high"; }
+    };
+    struct fc_fec_corrected_blocks_lane0_low : AdbRegField<0x220, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "fc_fec_corrected_blocks_lane0_low"; }
+    };
+    struct fc_fec_corrected_blocks_lane1_high : AdbRegField<0x240, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "fc_fec_corrected_blocks_lane1_high"; }
+    };
+    struct fc_fec_corrected_blocks_lane1_low : AdbRegField<0x260, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "fc_fec_corrected_blocks_lane1_low"; }
+    };
+    struct fc_fec_corrected_blocks_lane2_high : AdbRegField<0x280, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "fc_fec_corrected_blocks_lane2_high"; }
+    };
+    struct fc_fec_corrected_blocks_lane2_low : AdbRegField<0x2a0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "fc_fec_corrected_blocks_lane2_low"; }
+    };
+    struct fc_fec_corrected_blocks_lane3_high : AdbRegField<0x2c0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "fc_fec_corrected_blocks_lane3_high"; }
+    };
+    struct fc_fec_corrected_blocks_lane3_low : AdbRegField<0x2e0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "fc_fec_corrected_blocks_lane3_low"; }
+    };
+    struct fc_fec_uncorrectable_blocks_lane0_high : AdbRegField<0x300, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "fc_fec_uncorrectable_blocks_lane0_high"; }
+    };
+    struct fc_fec_uncorrectable_blocks_lane0_low : AdbRegField<0x320, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "fc_fec_uncorrectable_blocks_lane0_low"; }
+    };
+    struct fc_fec_uncorrectable_blocks_lane1_high : AdbRegField<0x340, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "fc_fec_uncorrectable_blocks_lane1_high"; }
+    };
+    struct fc_fec_uncorrectable_blocks_lane1_low : AdbRegField<0x360, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "fc_fec_uncorrectable_blocks_lane1_low"; }
+    };
+    struct fc_fec_uncorrectable_blocks_lane2_high : AdbRegField<0x380, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "fc_fec_uncorrectable_blocks_lane2_high"; }
+    };
+    struct fc_fec_uncorrectable_blocks_lane2_low : AdbRegField<0x3a0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "fc_fec_uncorrectable_blocks_lane2_low"; }
+    };
+    struct fc_fec_uncorrectable_blocks_lane3_high : AdbRegField<0x3c0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "fc_fec_uncorrectable_blocks_lane3_high"; }
+    };
+    struct fc_fec_uncorrectable_blocks_lane3_low : AdbRegField<0x3e0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "fc_fec_uncorrectable_blocks_lane3_low"; }
+    };
+    struct rs_fec_corrected_blocks_high : AdbRegField<0x400, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "rs_fec_corrected_blocks_high"; }
+    };
+    struct rs_fec_corrected_blocks_low : AdbRegField<0x420, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "rs_fec_corrected_blocks_low"; }
+    };
+    struct rs_fec_uncorrectable_blocks_high : AdbRegField<0x440, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "rs_fec_uncorrectable_blocks_high"; }
+    };
+    struct rs_fec_uncorrectable_blocks_low : AdbRegField<0x460, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "rs_fec_uncorrectable_blocks_low"; }
+    };
+    struct rs_fec_no_errors_blocks_high : AdbRegField<0x480, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "rs_fec_no_errors_blocks_high"; }
+    };
+    struct rs_fec_no_errors_blocks_low : AdbRegField<0x4a0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "rs_fec_no_errors_blocks_low"; }
+    };
+    struct rs_fec_corrected_symbols_total_high : AdbRegField<0x500, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "rs_fec_corrected_symbols_total_high"; }
+    };
+    struct rs_fec_corrected_symbols_total_low : AdbRegField<0x520, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "rs_fec_corrected_symbols_total_low"; }
+    };
+    struct rs_fec_corrected_symbols_lane0_high : AdbRegField<0x540, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "rs_fec_corrected_symbols_lane0_high"; }
+    };
+    struct rs_fec_corrected_symbols_lane0_low : AdbRegField<0x560, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "rs_fec_corrected_symbols_lane0_low"; }
+    };
+    struct rs_fec_corrected_symbols_lane1_high : AdbRegField<0x580, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "rs_fec_corrected_symbols_lane1_high"; }
+    };
+    struct rs_fec_corrected_symbols_lane1_low : AdbRegField<0x5a0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "rs_fec_corrected_symbols_lane1_low"; }
+    };
+    struct rs_fec_corrected_symbols_lane2_high : AdbRegField<0x5c0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "rs_fec_corrected_symbols_lane2_high"; }
+    };
+    struct rs_fec_corrected_symbols_lane2_low : AdbRegField<0x5e0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "rs_fec_corrected_symbols_lane2_low"; }
+    };
+    struct rs_fec_corrected_symbols_lane3_high : AdbRegField<0x600, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "rs_fec_corrected_symbols_lane3_high"; }
+    };
+    struct rs_fec_corrected_symbols_lane3_low : AdbRegField<0x620, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "rs_fec_corrected_symbols_lane3_low"; }
+    };
+    struct link_down_events : AdbRegField<0x640, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "link_down_events"; }
+    };
+    struct successful_recovery_events : AdbRegField<0x660, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "successful_recovery_events"; }
+    };
+    struct wred_discard_high : AdbRegField<0x40, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "wred_discard_high"; }
+    };
+    struct wred_discard_low : AdbRegField<0x60, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "wred_discard_low"; }
+    };
+    struct ecn_marked_tc_high : AdbRegField<0x80, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "ecn_marked_tc_high"; }
+    };
+    struct ecn_marked_tc_low : AdbRegField<0xa0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "ecn_marked_tc_low"; }
+    };
+    struct rx_no_buffer_discard_uc_high : AdbRegField<0x40, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "rx_no_buffer_discard_uc_high"; }
+    };
+    struct rx_no_buffer_discard_uc_low : AdbRegField<0x60, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "rx_no_buffer_discard_uc_low"; }
+    };
+    struct phy_received_bits_high : AdbRegField<0x80, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "phy_received_bits_high"; }
+    };
+    struct phy_received_bits_low : AdbRegField<0xa0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "phy_received_bits_low"; }
+    };
+    struct phy_symbol_errors_high : AdbRegField<0xc0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "phy_symbol_errors_high"; }
+    };
+    struct phy_symbol_errors_low : AdbRegField<0xe0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "phy_symbol_errors_low"; }
+    };
+    struct phy_corrected_bits_high : AdbRegField<0x100, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "phy_corrected_bits_high"; }
+    };
+    struct phy_corrected_bits_low : AdbRegField<0x120, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "phy_corrected_bits_low"; }
+    };
+    struct phy_raw_errors_lane0_high : AdbRegField<0x140, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "phy_raw_errors_lane0_high"; }
+    };
+    struct phy_raw_errors_lane0_low : AdbRegField<0x160, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "phy_raw_errors_lane0_low"; }
+    };
+    struct phy_raw_errors_lane1_high : AdbRegField<0x180, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "phy_raw_errors_lane1_high"; }
+    };
+    struct phy_raw_errors_lane1_low : AdbRegField<0x1a0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "phy_raw_errors_lane1_low"; }
+    };
+    struct phy_raw_errors_lane2_high : AdbRegField<0x1c0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "phy_raw_errors_lane2_high"; }
+    };
+    struct phy_raw_errors_lane2_low : AdbRegField<0x1e0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "phy_raw_errors_lane2_low"; }
+    };
+    struct phy_raw_errors_lane3_high : AdbRegField<0x200, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "phy_raw_errors_lane3_high"; }
+    };
+    struct phy_raw_errors_lane3_low : AdbRegField<0x220, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "phy_raw_errors_lane3_low"; }
+    };
+    struct phy_raw_errors_lane4_high : AdbRegField<0x240, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "phy_raw_errors_lane4_high"; }
+    };
+    struct phy_raw_errors_lane4_low : AdbRegField<0x260, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "phy_raw_errors_lane4_low"; }
+    };
+    struct phy_raw_errors_lane5_high : AdbRegField<0x280, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "phy_raw_errors_lane5_high"; }
+    };
+    struct phy_raw_errors_lane5_low : AdbRegField<0x2a0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "phy_raw_errors_lane5_low"; }
+    };
+    struct phy_raw_errors_lane6_high : AdbRegField<0x2c0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "phy_raw_errors_lane6_high"; }
+    };
+    struct phy_raw_errors_lane6_low : AdbRegField<0x2e0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "phy_raw_errors_lane6_low"; }
+    };
+    struct phy_raw_errors_lane7_high : AdbRegField<0x300, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "phy_raw_errors_lane7_high"; }
+    };
+    struct phy_raw_errors_lane7_low : AdbRegField<0x320, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "phy_raw_errors_lane7_low"; }
+    };
+    struct raw_ber_coef : AdbRegField<0x340, 4> {
+        typedef PPCNT reg;
+        static const char* name() { return "raw_ber_coef"; }
+    };
+    struct raw_ber_magnitude : AdbRegField<0x348, 8> {
+        typedef PPCNT reg;
+        static const char* name() { return "raw_ber_magnitude"; }
+    };
+    struct effective_ber_coef : AdbRegField<0x360, 4> {
+        typedef PPCNT reg;
+        static const char* name() { return "effective_ber_coef"; }
+    };
+    struct effective_ber_magnitude : AdbRegField<0x368, 8> {
+        typedef PPCNT reg;
+        static const char* name() { return "effective_ber_magnitude"; }
+    };
+    struct symbol_fec_ber_coef : AdbRegField<0x380, 4> {
+        typedef PPCNT reg;
+        static const char* name() { return "symbol_fec_ber_coef"; }
+    };
+    struct symbol_ber_magnitude : AdbRegField<0x388, 8> {
+        typedef PPCNT reg;
+        static const char* name() { return "symbol_ber_magnitude"; }
+    };
+    struct phy_effective_errors_high : AdbRegField<0x420, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "phy_effective_errors_high"; }
+    };
+    struct phy_effective_errors_low : AdbRegField<0x440, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "phy_effective_errors_low"; }
+    };
+    struct phy_time_since_last_clear_high : AdbRegField<0x3c0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "phy_time_since_last_clear_high"; }
+    };
+    struct phy_time_since_last_clear_low : AdbRegField<0x3e0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "phy_time_since_last_clear_low"; }
+    };
+    struct link_downed_counter : AdbRegField<0x40, 8> {
+        typedef PPCNT reg;
+        static const char* name() { return "link_downed_counter"; }
+    };
+    struct link_error_recovery_counter : AdbRegField<0x48, 8> {
+        typedef PPCNT reg;
+        static const char* name() { return "link_error_recovery_counter"; }
+    };
+    struct symbol_error_counter : AdbRegField<0x50, 16> {
+        typedef PPCNT reg;
+        static const char* name() { return "symbol_error_counter"; }
+    };
+    struct port_rcv_remote_physical_errors : AdbRegField<0x60, 16> {
+        typedef PPCNT reg;
+        static const char* name() { return "port_rcv_remote_physical_errors"; }
+    };
+    struct port_rcv_errors : AdbRegField<0x70, 16> {
+        typedef PPCNT reg;
+        static const char* name() { return "port_rcv_errors"; }
+    };
+    struct port_xmit_discards : AdbRegField<0x80, 16> {
+        typedef PPCNT reg;
+        static const char* name() { return "port_xmit_discards"; }
+    };
+    struct port_rcv_switch_relay_errors : AdbRegField<0x90, 16> {
+        typedef PPCNT reg;
+        static const char* name() { return "port_rcv_switch_relay_errors"; }
+    };
+    struct excessive_buffer_overrun_errors : AdbRegField<0xa0, 4> {
+        typedef PPCNT reg;
+        static const char* name() { return "excessive_buffer_overrun_errors"; }
+    };
+    struct local_link_integrity_errors : AdbRegField<0xa4, 4> {
+        typedef PPCNT reg;
+        static const char* name() { return "local_link_integrity_errors"; }
+    };
+    struct port_rcv_constraint_errors : AdbRegField<0xb0, 8> {
+        typedef PPCNT reg;
+        static const char* name() { return "port_rcv_constraint_errors"; }
+    };
+    struct port_xmit_constraint_errors : AdbRegField<0xb8, 8> {
+        typedef PPCNT reg;
+        static const char* name() { return "port_xmit_constraint_errors"; }
+    };
+    struct vl_15_dropped : AdbRegField<0xc0, 16> {
+        typedef PPCNT reg;
+        static const char* name() { return "vl_15_dropped"; }
+    };
+    struct port_xmit_data : AdbRegField<0xe0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "port_xmit_data"; }
+    };
+    struct port_rcv_data : AdbRegField<0x100, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "port_rcv_data"; }
+    };
+    struct port_xmit_pkts : AdbRegField<0x120, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "port_xmit_pkts"; }
+    };
+    struct port_rcv_pkts : AdbRegField<0x140, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "port_rcv_pkts"; }
+    };
+    struct port_xmit_wait : AdbRegField<0x160, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "port_xmit_wait"; }
+    };
+    struct symbol_error_counter_high : AdbRegField<0x40, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "symbol_error_counter_high"; }
+    };
+    struct symbol_error_counter_low : AdbRegField<0x60, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "symbol_error_counter_low"; }
+    };
+    struct link_error_recovery_counter_high : AdbRegField<0x80, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "link_error_recovery_counter_high"; }
+    };
+    struct link_error_recovery_counter_low : AdbRegField<0xa0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "link_error_recovery_counter_low"; }
+    };
+    struct link_downed_counter_high : AdbRegField<0xc0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "link_downed_counter_high"; }
+    };
+    struct link_downed_counter_low : AdbRegField<0xe0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "link_downed_counter_low"; }
+    };
+    struct port_rcv_errors_high : AdbRegField<0x100, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "port_rcv_errors_high"; }
+    };
+    struct port_rcv_errors_low : AdbRegField<0x120, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "port_rcv_errors_low"; }
+    };
+    struct port_rcv_remote_physical_errors_high : AdbRegField<0x140, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "port_rcv_remote_physical_errors_high"; }
+    };
+    struct port_rcv_remote_physical_errors_low : AdbRegField<0x160, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "port_rcv_remote_physical_errors_low"; }
+    };
+    struct port_rcv_switch_relay_errors_high : AdbRegField<0x180, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "port_rcv_switch_relay_errors_high"; }
+    };
+    struct port_rcv_switch_relay_errors_low : AdbRegField<0x1a0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "port_rcv_switch_relay_errors_low"; }
+    };
+    struct port_xmit_discards_high : AdbRegField<0x1c0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "port_xmit_discards_high"; }
+    };
+    struct port_xmit_discards_low : AdbRegField<0x1e0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "port_xmit_discards_low"; }
+    };
+    struct port_xmit_constraint_errors_high : AdbRegField<0x200, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "port_xmit_constraint_errors_high"; }
+    };
+    struct port_xmit_constraint_errors_low : AdbRegField<0x220, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "port_xmit_constraint_errors_low"; }
+    };
+    struct port_rcv_constraint_errors_high : AdbRegField<0x240, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "port_rcv_constraint_errors_high"; }
+    };
+    struct port_rcv_constraint_errors_low : AdbRegField<0x260, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "port_rcv_constraint_errors_low"; }
+    };
+    struct local_link_integrity_errors_high : AdbRegField<0x280, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "local_link_integrity_errors_high"; }
+    };
+    struct local_link_integrity_errors_low : AdbRegField<0x2a0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "local_link_integrity_errors_low"; }
+    };
+    struct excessive_buffer_overrun_errors_high : AdbRegField<0x2c0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "excessive_buffer_overrun_errors_high"; }
+    };
+    struct excessive_buffer_overrun_errors_low : AdbRegField<0x2e0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "excessive_buffer_overrun_errors_low"; }
+    };
+    struct vl_15_dropped_high : AdbRegField<0x300, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "vl_15_dropped_high"; }
+    };
+    struct vl_15_dropped_low : AdbRegField<0x320, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "vl_15_dropped_low"; }
+    };
+    struct port_xmit_data_high : AdbRegField<0x340, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "port_xmit_data_high"; }
+    };
+    struct port_xmit_data_low : AdbRegField<0x360, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "port_xmit_data_low"; }
+    };
+    struct port_rcv_data_high : AdbRegField<0x380, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "port_rcv_data_high"; }
+    };
+    struct port_rcv_data_low : AdbRegField<0x3a0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "port_rcv_data_low"; }
+    };
+    struct port_xmit_pkts_high : AdbRegField<0x3c0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "port_xmit_pkts_high"; }
+    };
+    struct port_xmit_pkts_low : AdbRegField<0x3e0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "port_xmit_pkts_low"; }
+    };
+    struct port_rcv_pkts_high : AdbRegField<0x400, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "port_rcv_pkts_high"; }
+    };
+    struct port_rcv_pkts_low : AdbRegField<0x420, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "port_rcv_pkts_low"; }
+    };
+    struct port_xmit_wait_high : AdbRegField<0x440, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "port_xmit_wait_high"; }
+    };
+    struct port_xmit_wait_low : AdbRegField<0x460, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "port_xmit_wait_low"; }
+    };
+    struct plr_rcv_codes_high : AdbRegField<0x40, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "plr_rcv_codes_high"; }
+    };
+    struct plr_rcv_codes_low : AdbRegField<0x60, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "plr_rcv_codes_low"; }
+    };
+    struct plr_rcv_code_err_high : AdbRegField<0x80, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "plr_rcv_code_err_high"; }
+    };
+    struct plr_rcv_code_err_low : AdbRegField<0xa0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "plr_rcv_code_err_low"; }
+    };
+    struct plr_rcv_uncorrectable_code_high : AdbRegField<0xc0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "plr_rcv_uncorrectable_code_high"; }
+    };
+    struct plr_rcv_uncorrectable_code_low : AdbRegField<0xe0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "plr_rcv_uncorrectable_code_low"; }
+    };
+    struct plr_xmit_codes_high : AdbRegField<0x100, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "plr_xmit_codes_high"; }
+    };
+    struct plr_xmit_codes_low : AdbRegField<0x120, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "plr_xmit_codes_low"; }
+    };
+    struct plr_xmit_retry_codes_high : AdbRegField<0x140, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "plr_xmit_retry_codes_high"; }
+    };
+    struct plr_xmit_retry_codes_low : AdbRegField<0x160, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "plr_xmit_retry_codes_low"; }
+    };
+    struct plr_xmit_retry_events_high : AdbRegField<0x180, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "plr_xmit_retry_events_high"; }
+    };
+    struct plr_xmit_retry_events_low : AdbRegField<0x1a0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "plr_xmit_retry_events_low"; }
+    };
+    struct plr_sync_events_high : AdbRegField<0x1c0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "plr_sync_events_high"; }
+    };
+    struct plr_sync_events_low : AdbRegField<0x1e0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "plr_sync_events_low"; }
+    };
+    struct hi_retransmission_rate_high : AdbRegField<0x200, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "hi_retransmission_rate_high"; }
+    };
+    struct hi_retransmission_rate_low : AdbRegField<0x220, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "hi_retransmission_rate_low"; }
+    };
+    struct plr_xmit_retry_codes_within_t_sec_max_high : AdbRegField<0x240, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "plr_xmit_retry_codes_within_t_sec_max_high"; }
+    };
+    struct plr_xmit_retry_codes_within_t_sec_max_low : AdbRegField<0x260, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "plr_xmit_retry_codes_within_t_sec_max_low"; }
+    };
+    struct hi_0 : AdbRegField<0x40, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "hi_0"; }
+    };
+    struct lo_0 : AdbRegField<0x60, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "lo_0"; }
+    };
+    struct hi_1 : AdbRegField<0x80, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "hi_1"; }
+    };
+    struct lo_1 : AdbRegField<0xa0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "lo_1"; }
+    };
+    struct hi_2 : AdbRegField<0xc0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "hi_2"; }
+    };
+    struct lo_2 : AdbRegField<0xe0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "lo_2"; }
+    };
+    struct hi_3 : AdbRegField<0x100, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "hi_3"; }
+    };
+    struct lo_3 : AdbRegField<0x120, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "lo_3"; }
+    };
+    struct hi_4 : AdbRegField<0x140, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "hi_4"; }
+    };
+    struct lo_4 : AdbRegField<0x160, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "lo_4"; }
+    };
+    struct hi_5 : AdbRegField<0x180, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "hi_5"; }
+    };
+    struct lo_5 : AdbRegField<0x1a0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "lo_5"; }
+    };
+    struct hi_6 : AdbRegField<0x1c0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "hi_6"; }
+    };
+    struct lo_6 : AdbRegField<0x1e0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "lo_6"; }
+    };
+    struct hi_7 : AdbRegField<0x200, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "hi_7"; }
+    };
+    struct lo_7 : AdbRegField<0x220, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "lo_7"; }
+    };
+    struct hi_8 : AdbRegField<0x240, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "hi_8"; }
+    };
+    struct lo_8 : AdbRegField<0x260, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "lo_8"; }
+    };
+    struct hi_9 : AdbRegField<0x280, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "hi_9"; }
+    };
+    struct lo_9 : AdbRegField<0x2a0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "lo_9"; }
+    };
+    struct hi_10 : AdbRegField<0x2c0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "hi_10"; }
+    };
+    struct lo_10 : AdbRegField<0x2e0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "lo_10"; }
+    };
+    struct hi_11 : AdbRegField<0x300, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "hi_11"; }
+    };
+    struct lo_11 : AdbRegField<0x320, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "lo_11"; }
+    };
+    struct hi_12 : AdbRegField<0x340, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "hi_12"; }
+    };
+    struct lo_12 : AdbRegField<0x360, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "lo_12"; }
+    };
+    struct hi_13 : AdbRegField<0x380, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "hi_13"; }
+    };
+    struct lo_13 : AdbRegField<0x3a0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "lo_13"; }
+    };
+    struct hi_14 : AdbRegField<0x3c0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "hi_14"; }
+    };
+    struct lo_14 : AdbRegField<0x3e0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "lo_14"; }
+    };
+    struct hi_15 : AdbRegField<0x400, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "hi_15"; }
+    };
+    struct lo_15 : AdbRegField<0x420, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "lo_15"; }
+    };
+    struct fc_fec_corrected_blocks_lane4_high : AdbRegField<0x180, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "fc_fec_corrected_blocks_lane4_high"; }
+    };
+    struct fc_fec_corrected_blocks_lane4_low : AdbRegField<0x1a0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "fc_fec_corrected_blocks_lane4_low"; }
+    };
+    struct fc_fec_corrected_blocks_lane5_high : AdbRegField<0x1c0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "fc_fec_corrected_blocks_lane5_high"; }
+    };
+    struct fc_fec_corrected_blocks_lane5_low : AdbRegField<0x1e0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "fc_fec_corrected_blocks_lane5_low"; }
+    };
+    struct fc_fec_corrected_blocks_lane6_high : AdbRegField<0x200, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "fc_fec_corrected_blocks_lane6_high"; }
+    };
+    struct fc_fec_corrected_blocks_lane6_low : AdbRegField<0x220, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "fc_fec_corrected_blocks_lane6_low"; }
+    };
+    struct fc_fec_corrected_blocks_lane7_high : AdbRegField<0x240, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "fc_fec_corrected_blocks_lane7_high"; }
+    };
+    struct fc_fec_corrected_blocks_lane7_low : AdbRegField<0x260, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "fc_fec_corrected_blocks_lane7_low"; }
+    };
+    struct fc_fec_uncorrectable_blocks_lane4_high : AdbRegField<0x380, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "fc_fec_uncorrectable_blocks_lane4_high"; }
+    };
+    struct fc_fec_uncorrectable_blocks_lane4_low : AdbRegField<0x3a0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "fc_fec_uncorrectable_blocks_lane4_low"; }
+    };
+    struct fc_fec_uncorrectable_blocks_lane5_high : AdbRegField<0x3c0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "fc_fec_uncorrectable_blocks_lane5_high"; }
+    };
+    struct fc_fec_uncorrectable_blocks_lane5_low : AdbRegField<0x3e0, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "fc_fec_uncorrectable_blocks_lane5_low"; }
+    };
+    struct fc_fec_uncorrectable_blocks_lane6_high : AdbRegField<0x400, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "fc_fec_uncorrectable_blocks_lane6_high"; }
+    };
+    struct fc_fec_uncorrectable_blocks_lane6_low : AdbRegField<0x420, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "fc_fec_uncorrectable_blocks_lane6_low"; }
+    };
+    struct fc_fec_uncorrectable_blocks_lane7_high : AdbRegField<0x440, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "fc_fec_uncorrectable_blocks_lane7_high"; }
+    };
+    struct fc_fec_uncorrectable_blocks_lane7_low : AdbRegField<0x460, 32> {
+        typedef PPCNT reg;
+        static const char* name() { return "fc_fec_uncorrectable_blocks_lane7_low"; }
+    };
+
+    static const AdbRegFieldDesc* fields(size_t &count)
+    {
+        static const AdbRegFieldDesc table[] = {
+            { "grp", 0x0, 6 },
+            { "lp_msb", 0xc, 2 },
+            { "pnat", 0xe, 2 },
+            { "local_port", 0x10, 8 },
+            { "swid", 0x18, 8 },
+            { "prio_tc", 0x20, 5 },
+            { "clr", 0x3f, 1 },
+            { "a_frames_transmitted_ok_high", 0x40, 32 },
+            { "a_frames_transmitted_ok_low", 0x60, 32 },
+            { "a_frames_received_ok_high", 0x80, 32 },
+            { "a_frames_received_ok_low", 0xa0, 32 },
+            { "a_frame_check_sequence_errors_high", 0xc0, 32 },
+            { "a_frame_check_sequence_errors_low", 0xe0, 32 },
+            { "a_alignment_errors_high", 0x100, 32 },
+            { "a_alignment_errors_low", 0x120, 32 },
+            { "a_octets_transmitted_ok_high", 0x140, 32 },
+            { "a_octets_transmitted_ok_low", 0x160, 32 },
+            { "a_octets_received_ok_high", 0x180, 32 },
+            { "a_octets_received_ok_low", 0x1a0, 32 },
+            { "a_multicast_frames_xmitted_ok_high", 0x1c0, 32 },
+            { "a_multicast_frames_xmitted_ok_low", 0x1e0, 32 },
+            { "a_broadcast_frames_xmitted_ok_high", 0x200, 32 },
+            { "a_broadcast_frames_xmitted_ok_low", 0x220, 32 },
+            { "a_multicast_frames_received_ok_high", 0x240, 32 },
+            { "a_multicast_frames_received_ok_low", 0x260, 32 },
+            { "a_broadcast_frames_received_ok_high", 0x280, 32 },
+            { "a_broadcast_frames_received_ok_low", 0x2a0, 32 },
+            { "a_in_range_length_errors_high", 0x2c0, 32 },
+            { "a_in_range_length_errors_low", 0x2e0, 32 },
+            { "a_out_of_range_length_field_high", 0x300, 32 },
+            { "a_out_of_range_length_field_low", 0x320, 32 },
+            { "a_frame_too_long_errors_high", 0x340, 32 },
+            { "a_frame_too_long_errors_low", 0x360, 32 },
+            { "a_symbol_error_during_carrier_high", 0x380, 32 },
+            { "a_symbol_error_during_carrier_low", 0x3a0, 32 },
+            { "a_mac_control_frames_transmitted_high", 0x3c0, 32 },
+            { "a_mac_control_frames_transmitted_low", 0x3e0, 32 },
+            { "a_mac_control_frames_received_high", 0x400, 32 },
+            { "a_mac_control_frames_received_low", 0x420, 32 },
+            { "a_unsupported_opcodes_received_high", 0x440, 32 },
+            { "a_unsupported_opcodes_received_low", 0x460, 32 },
+            { "a_pause_mac_ctrl_frames_received_high", 0x480, 32 },
+            { "a_pause_mac_ctrl_frames_received_low", 0x4a0, 32 },
+            { "a_pause_mac_ctrl_frames_transmitted_high", 0x4c0, 32 },
+            { "a_pause_mac_ctrl_frames_transmitted_low", 0x4e0, 32 },
+            { "if_in_octets_high", 0x40, 32 },
+            { "if_in_octets_low", 0x60, 32 },
+            { "if_in_ucast_pkts_high", 0x80, 32 },
+            { "if_in_ucast_pkts_low", 0xa0, 32 },
+            { "if_in_discards_high", 0xc0, 32 },
+            { "if_in_discards_low", 0xe0, 32 },
+            { "if_in_errors_high", 0x100, 32 },
+            { "if_in_errors_low", 0x120, 32 },
+            { "if_in_unknown_protos_high", 0x140, 32 },
+            { "if_in_unknown_protos_low", 0x160, 32 },
+            { "if_out_octets_high", 0x180, 32 },
+            { "if_out_octets_low", 0x1a0, 32 },
+            { "if_out_ucast_pkts_high", 0x1c0, 32 },
+            { "if_out_ucast_pkts_low", 0x1e0, 32 },
+            { "if_out_discards_high", 0x200, 32 },
+            { "if_out_discards_low", 0x220, 32 },
+            { "if_out_errors_high", 0x240, 32 },
+            { "if_out_errors_low", 0x260, 32 },
+            { "if_in_multicast_pkts_high", 0x280, 32 },
+            { "if_in_multicast_pkts_low", 0x2a0, 32 },
+            { "if_in_broadcast_pkts_high", 0x2c0, 32 },
+            { "if_in_broadcast_pkts_low", 0x2e0, 32 },
+            { "if_out_multicast_pkts_high", 0x300, 32 },
+            { "if_out_multicast_pkts_low", 0x320, 32 },
+            { "if_out_broadcast_pkts_high", 0x340, 32 },
+            { "if_out_broadcast_pkts_low", 0x360, 32 },
+            { "ether_stats_drop_events_high", 0x40, 32 },
+            { "ether_stats_drop_events_low", 0x60, 32 },
+            { "ether_stats_octets_high", 0x80, 32 },
+            { "ether_stats_octets_low", 0xa0, 32 },
+            { "ether_stats_pkts_high", 0xc0, 32 },
+            { "ether_stats_pkts_low", 0xe0, 32 },
+            { "ether_stats_broadcast_pkts_high", 0x100, 32 },
+            { "ether_stats_broadcast_pkts_low", 0x120, 32 },
+            { "ether_stats_multicast_pkts_high", 0x140, 32 },
+            { "ether_stats_multicast_pkts_low", 0x160, 32 },
+            { "ether_stats_crc_align_errors_high", 0x180, 32 },
+            { "ether_stats_crc_align_errors_low", 0x1a0, 32 },
+            { "ether_stats_undersize_pkts_high", 0x1c0, 32 },
+            { "ether_stats_undersize_pkts_low", 0x1e0, 32 },
+            { "ether_stats_oversize_pkts_high", 0x200, 32 },
+            { "ether_stats_oversize_pkts_low", 0x220, 32 },
+            { "ether_stats_fragments_high", 0x240, 32 },
+            { "ether_stats_fragments_low", 0x260, 32 },
+            { "ether_stats_jabbers_high", 0x280, 32 },
+            { "ether_stats_jabbers_low", 0x2a0, 32 },
+            { "ether_stats_collisions_high", 0x2c0, 32 },
+            { "ether_stats_collisions_low", 0x2e0, 32 },
+            { "ether_stats_pkts64octets_high", 0x300, 32 },
+            { "ether_stats_pkts64octets_low", 0x320, 32 },
+            { "ether_stats_pkts65to127octets_high", 0x340, 32 },
+            { "ether_stats_pkts65to127octets_low", 0x360, 32 },
+            { "ether_stats_pkts128to255octets_high", 0x380, 32 },
+            { "ether_stats_pkts128to255octets_low", 0x3a0, 32 },
+            { "ether_stats_pkts256to511octets_high", 0x3c0, 32 },
+            { "ether_stats_pkts256to511octets_low", 0x3e0, 32 },
+            { "ether_stats_pkts512to1023octets_high", 0x400, 32 },
+            { "ether_stats_pkts512to1023octets_low", 0x420, 32 },
+            { "ether_stats_pkts1024to1518octets_high", 0x440, 32 },
+            { "ether_stats_pkts1024to1518octets_low", 0x460, 32 },
+            { "ether_stats_pkts1519to2047octets_high", 0x480, 32 },
+            { "ether_stats_pkts1519to2047octets_low", 0x4a0, 32 },
+            { "ether_stats_pkts2048to4095octets_high", 0x4c0, 32 },
+            { "ether_stats_pkts2048to4095octets_low", 0x4e0, 32 },
+            { "ether_stats_pkts4096to8191octets_high", 0x500, 32 },
+            { "ether_stats_pkts4096to8191octets_low", 0x520, 32 },
+            { "ether_stats_pkts8192to10239octets_high", 0x540, 32 },
+            { "ether_stats_pkts8192to10239octets_low", 0x560, 32 },
+            { "dot3stats_alignment_errors_high", 0x40, 32 },
+            { "dot3stats_alignment_errors_low", 0x60, 32 },
+            { "dot3stats_fcs_errors_high", 0x80, 32 },
+            { "dot3stats_fcs_errors_low", 0xa0, 32 },
+            { "dot3stats_single_collision_frames_high", 0xc0, 32 },
+            { "dot3stats_single_collision_frames_low", 0xe0, 32 },
+            { "dot3stats_multiple_collision_frames_high", 0x100, 32 },
+            { "dot3stats_multiple_collision_frames_low", 0x120, 32 },
+            { "dot3stats_sqe_test_errors_high", 0x140, 32 },
+            { "dot3stats_sqe_test_errors_low", 0x160, 32 },
+            { "dot3stats_deferred_transmissions_high", 0x180, 32 },
+            { "dot3stats_deferred_transmissions_low", 0x1a0, 32 },
+            { "dot3stats_late_collisions_high", 0x1c0, 32 },
+            { "dot3stats_late_collisions_low", 0x1e0, 32 },
+            { "dot3stats_excessive_collisions_high", 0x200, 32 },
+            { "dot3stats_excessive_collisions_low", 0x220, 32 },
+            { "dot3stats_internal_mac_transmit_errors_high", 0x240, 32 },
+            { "dot3stats_internal_mac_transmit_errors_low", 0x260, 32 },
+            { "dot3stats_carrier_sense_errors_high", 0x280, 32 },
+            { "dot3stats_carrier_sense_errors_low", 0x2a0, 32 },
+            { "dot3stats_frame_too_longs_high", 0x2c0, 32 },
+            { "dot3stats_frame_too_longs_low", 0x2e0, 32 },
+            { "dot3stats_internal_mac_receive_errors_high", 0x300, 32 },
+            { "dot3stats_internal_mac_receive_errors_low", 0x320, 32 },
+            { "dot3stats_symbol_errors_high", 0x340, 32 },
+            { "dot3stats_symbol_errors_low", 0x360, 32 },
+            { "dot3control_in_unknown_opcodes_high", 0x380, 32 },
+            { "dot3control_in_unknown_opcodes_low", 0x3a0, 32 },
+            { "dot3in_pause_frames_high", 0x3c0, 32 },
+            { "dot3in_pause_frames_low", 0x3e0, 32 },
+            { "dot3out_pause_frames_high", 0x400, 32 },
+            { "dot3out_pause_frames_low", 0x420, 32 },
+            { "port_transmit_wait_high", 0x40, 32 },
+            { "port_transmit_wait_low", 0x60, 32 },
+            { "ecn_marked_high", 0x80, 32 },
+            { "ecn_marked_low", 0xa0, 32 },
+            { "no_buffer_discard_mc_high", 0xc0, 32 },
+            { "no_buffer_discard_mc_low", 0xe0, 32 },
+            { "rx_ebp_high", 0x100, 32 },
+            { "rx_ebp_low", 0x120, 32 },
+            { "tx_ebp_high", 0x140, 32 },
+            { "tx_ebp_low", 0x160, 32 },
+            { "rx_buffer_almost_full_high", 0x180, 32 },
+            { "rx_buffer_almost_full_low", 0x1a0, 32 },
+            { "rx_buffer_full_high", 0x1c0, 32 },
+            { "rx_buffer_full_low", 0x1e0, 32 },
+            { "rx_icrc_encapsulated_high", 0x200, 32 },
+            { "rx_icrc_encapsulated_low", 0x220, 32 },
+            { "tx_stats_pkts64octets_high", 0x2c0, 32 },
+            { "tx_stats_pkts64octets_low", 0x2e0, 32 },
+            { "tx_stats_pkts65to127octets_high", 0x300, 32 },
+            { "tx_stats_pkts65to127octets_low", 0x320, 32 },
+            { "tx_stats_pkts128to255octets_high", 0x340, 32 },
+            { "tx_stats_pkts128to255octets_low", 0x360, 32 },
+            { "tx_stats_pkts256to511octets_high", 0x380, 32 },
+            { "tx_stats_pkts256to511octets_low", 0x3a0, 32 },
+            { "tx_stats_pkts512to1023octets_high", 0x3c0, 32 },
+            { "tx_stats_pkts512to1023octets_low", 0x3e0, 32 },
+            { "tx_stats_pkts1024to1518octets_high", 0x400, 32 },
+            { "tx_stats_pkts1024to1518octets_low", 0x420, 32 },
+            { "tx_stats_pkts1519to2047octets_high", 0x440, 32 },
+            { "tx_stats_pkts1519to2047octets_low", 0x460, 32 },
+            { "tx_stats_pkts2048to4095octets_high", 0x480, 32 },
+            { "tx_stats_pkts2048to4095octets_low", 0x4a0, 32 },
+            { "tx_stats_pkts4096to8191octets_high", 0x4c0, 32 },
+            { "tx_stats_pkts4096to8191octets_low", 0x4e0, 32 },
+            { "tx_stats_pkts8192to10239octets_high", 0x500, 32 },
+            { "tx_stats_pkts8192to10239octets_low", 0x520, 32 },
+            { "ingress_general_high", 0x40, 32 },
+            { "ingress_general_low", 0x60, 32 },
+            { "ingress_policy_engine_high", 0x80, 32 },
+            { "ingress_policy_engine_low", 0xa0, 32 },
+            { "ingress_vlan_membership_high", 0xc0, 32 },
+            { "ingress_vlan_membership_low", 0xe0, 32 },
+            { "ingress_tag_frame_type_high", 0x100, 32 },
+            { "ingress_tag_frame_type_low", 0x120, 32 },
+            { "egress_vlan_membership_high", 0x140, 32 },
+            { "egress_vlan_membership_low", 0x160, 32 },
+            { "loopback_filter_high", 0x180, 32 },
+            { "loopback_filter_low", 0x1a0, 32 },
+            { "egress_general_high", 0x1c0, 32 },
+            { "egress_general_low", 0x1e0, 32 },
+            { "egress_hoq_high", 0x240, 32 },
+            { "egress_hoq_low", 0x260, 32 },
+            { "port_isolation_high", 0x280, 32 },
+            { "port_isolation_low", 0x2a0, 32 },
+            { "egress_policy_engine_high", 0x2c0, 32 },
+            { "egress_policy_engine_low", 0x2e0, 32 },
+            { "ingress_tx_link_down_high", 0x300, 32 },
+            { "ingress_tx_link_down_low", 0x320, 32 },
+            { "egress_stp_filter_high", 0x340, 32 },
+            { "egress_stp_filter_low", 0x360, 32 },
+            { "egress_hoq_stall_high", 0x380, 32 },
+            { "egress_hoq_stall_low", 0x3a0, 32 },
+            { "egress_sll_high", 0x3c0, 32 },
+            { "egress_sll_low", 0x3e0, 32 },
+            { "ingress_discard_all_high", 0x400, 32 },
+            { "ingress_discard_all_low", 0x420, 32 },
+            { "llr_rx_cells_high", 0x40, 32 },
+            { "llr_rx_cells_low", 0x60, 32 },
+            { "llr_rx_error_high", 0x80, 32 },
+            { "llr_rx_error_low", 0xa0, 32 },
+            { "llr_rx_crc_error_high", 0xc0, 32 },
+            { "llr_rx_crc_error_low", 0xe0, 32 },
+            { "llr_tx_cells_high", 0x100, 32 },
+            { "llr_tx_cells_low", 0x120, 32 },
+            { "llr_tx_ret_cells_high", 0x140, 32 },
+            { "llr_tx_ret_cells_low", 0x160, 32 },
+            { "llr_tx_ret_events_high", 0x180, 32 },
+            { "llr_tx_ret_events_low", 0x1a0, 32 },
+            { "rx_octets_high", 0x40, 32 },
+            { "rx_octets_low", 0x60, 32 },
+            { "rx_frames_high", 0x140, 32 },
+            { "rx_frames_low", 0x160, 32 },
+            { "tx_octets_high", 0x180, 32 },
+            { "tx_octets_low", 0x1a0, 32 },
+            { "tx_frames_high", 0x280, 32 },
+            { "tx_frames_low", 0x2a0, 32 },
+            { "rx_pause_high", 0x2c0, 32 },
+            { "rx_pause_low", 0x2e0, 32 },
+            { "rx_pause_duration_high", 0x300, 32 },
+            { "rx_pause_duration_low", 0x320, 32 },
+            { "tx_pause_high", 0x340, 32 },
+            { "tx_pause_low", 0x360, 32 },
+            { "tx_pause_duration_high", 0x380, 32 },
+            { "tx_pause_duration_low", 0x3a0, 32 },
+            { "rx_pause_transition_high", 0x3c0, 32 },
+            { "rx_pause_transition_low", 0x3e0, 32 },
+            { "rx_discards_high", 0x400, 32 },
+            { "rx_discards_low", 0x420, 32 },
+            { "device_stall_minor_watermark_cnt_high", 0x440, 32 },
+            { "device_stall_minor_watermark_cnt_low", 0x460, 32 },
+            { "device_stall_critical_watermark_cnt_high", 0x480, 32 },
+            { "device_stall_critical_watermark_cnt_low", 0x4a0, 32 },
+            { "transmit_queue_high", 0x40, 32 },
+            { "transmit_queue_low", 0x60, 32 },
+            { "no_buffer_discard_uc_high", 0x80, 32 },
+            { "no_buffer_discard_uc_low", 0xa0, 32 },
+            { "time_since_last_clear_high", 0x40, 32 },
+            { "time_since_last_clear_low", 0x60, 32 },
+            { "symbol_errors_high", 0x80, 32 },
+            { "symbol_errors_low", 0xa0, 32 },
+            { "sync_headers_errors_high", 0xc0, 32 },
+            { "sync_headers_errors_low", 0xe0, 32 },
+            { "edpl_bip_errors_lane0_high", 0x100, 32 },
+            { "edpl_bip_errors_lane0_low", 0x120, 32 },
+            { "edpl_bip_errors_lane1_high", 0x140, 32 },
+            { "edpl_bip_errors_lane1_low", 0x160, 32 },
+            { "edpl_bip_errors_lane2_high", 0x180, 32 },
+            { "edpl_bip_errors_lane2_low", 0x1a0, 32 },
+            { "edpl_bip_errors_lane3_high", 0x1c0, 32 },
+            { "edpl_bip_errors_lane3_low", 0x1e0, 32 },
+            { "fc_fec_corrected_blocks_lane0_high", 0x200, 32 },
+            { "fc_fec_corrected_blocks_lane0_low", 0x220, 32 },
+            { "fc_fec_corrected_blocks_lane1_high", 0x240, 32 },
+            { "fc_fec_corrected_blocks_lane1_low", 0x260, 32 },
+            { "fc_fec_corrected_blocks_lane2_high", 0x280, 32 },
+            { "fc_fec_corrected_blocks_lane2_low", 0x2a0, 32 },
+            { "fc_fec_corrected_blocks_lane3_high", 0x2c0, 32 },
+            { "fc_fec_corrected_blocks_lane3_low", 0x2e0, 32 },
+            { "fc_fec_uncorrectable_blocks_lane0_high", 0x300, 32 },
+            { "fc_fec_uncorrectable_blocks_lane0_low", 0x320, 32 },
+            { "fc_fec_uncorrectable_blocks_lane1_high", 0x340, 32 },
+            { "fc_fec_uncorrectable_blocks_lane1_low", 0x360, 32 },
+            { "fc_fec_uncorrectable_blocks_lane2_high", 0x380, 32 },
+            { "fc_fec_uncorrectable_blocks_lane2_low", 0x3a0, 32 },
+            { "fc_fec_uncorrectable_blocks_lane3_high", 0x3c0, 32 },
+            { "fc_fec_uncorrectable_blocks_lane3_low", 0x3e0, 32 },
+            { "rs_fec_corrected_blocks_high", 0x400, 32 },
+            { "rs_fec_corrected_blocks_low", 0x420, 32 },
+            { "rs_fec_uncorrectable_blocks_high", 0x440, 32 },
+            { "rs_fec_uncorrectable_blocks_low", 0x460, 32 },
+            { "rs_fec_no_errors_blocks_high", 0x480, 32 },
+            { "rs_fec_no_errors_blocks_low", 0x4a0, 32 },
+            { "rs_fec_corrected_symbols_total_high", 0x500, 32 },
+            { "rs_fec_corrected_symbols_total_low", 0x520, 32 },
+            { "rs_fec_corrected_symbols_lane0_high", 0x540, 32 },
+            { "rs_fec_corrected_symbols_lane0_low", 0x560, 32 },
+            { "rs_fec_corrected_symbols_lane1_high", 0x580, 32 },
+            { "rs_fec_corrected_symbols_lane1_low", 0x5a0, 32 },
+            { "rs_fec_corrected_symbols_lane2_high", 0x5c0, 32 },
+            { "rs_fec_corrected_symbols_lane2_low", 0x5e0, 32 },
+            { "rs_fec_corrected_symbols_lane3_high", 0x600, 32 },
+            { "rs_fec_corrected_symbols_lane3_low", 0x620, 32 },
+            { "link_down_events", 0x640, 32 },
+            { "successful_recovery_events", 0x660, 32 },
+            { "wred_discard_high", 0x40, 32 },
+            { "wred_discard_low", 0x60, 32 },
+            { "ecn_marked_tc_high", 0x80, 32 },
+            { "ecn_marked_tc_low", 0xa0, 32 },
+            { "rx_no_buffer_discard_uc_high", 0x40, 32 },
+            { "rx_no_buffer_discard_uc_low", 0x60, 32 },
+            { "phy_received_bits_high", 0x80, 32 },
+            { "phy_received_bits_low", 0xa0, 32 },
+            { "phy_symbol_errors_high", 0xc0, 32 },
+            { "phy_symbol_errors_low", 0xe0, 32 },
+            { "phy_corrected_bits_high", 0x100, 32 },
+            { "phy_corrected_bits_low", 0x120, 32 },
+            { "phy_raw_errors_lane0_high", 0x140, 32 },
+            { "phy_raw_errors_lane0_low", 0x160, 32 },
+            { "phy_raw_errors_lane1_high", 0x180, 32 },
+            { "phy_raw_errors_lane1_low", 0x1a0, 32 },
+            { "phy_raw_errors_lane2_high", 0x1c0, 32 },
+            { "phy_raw_errors_lane2_low", 0x1e0, 32 },
+            { "phy_raw_errors_lane3_high", 0x200, 32 },
+            { "phy_raw_errors_lane3_low", 0x220, 32 },
+            { "phy_raw_errors_lane4_high", 0x240, 32 },
+            { "phy_raw_errors_lane4_low", 0x260, 32 },
+            { "phy_raw_errors_lane5_high", 0x280, 32 },
+            { "phy_raw_errors_lane5_low", 0x2a0, 32 },
+            { "phy_raw_errors_lane6_high", 0x2c0, 32 },
+            { "phy_raw_errors_lane6_low", 0x2e0, 32 },
+            { "phy_raw_errors_lane7_high", 0x300, 32 },
+            { "phy_raw_errors_lane7_low", 0x320, 32 },
+            { "raw_ber_coef", 0x340, 4 },
+            { "raw_ber_magnitude", 0x348, 8 },
+            { "effective_ber_coef", 0x360, 4 },
+            { "effective_ber_magnitude", 0x368, 8 },
+            { "symbol_fec_ber_coef", 0x380, 4 },
+            { "symbol_ber_magnitude", 0x388, 8 },
+            { "phy_effective_errors_high", 0x420, 32 },
+            { "phy_effective_errors_low", 0x440, 32 },
+            { "phy_time_since_last_clear_high", 0x3c0, 32 },
+            { "phy_time_since_last_clear_low", 0x3e0, 32 },
+            { "link_downed_counter", 0x40, 8 },
+            { "link_error_recovery_counter", 0x48, 8 },
+            { "symbol_error_counter", 0x50, 16 },
+            { "port_rcv_remote_physical_errors", 0x60, 16 },
+            { "port_rcv_errors", 0x70, 16 },
+            { "port_xmit_discards", 0x80, 16 },
+            { "port_rcv_switch_relay_errors", 0x90, 16 },
+            { "excessive_buffer_overrun_errors", 0xa0, 4 },
+            { "local_link_integrity_errors", 0xa4, 4 },
+            { "port_rcv_constraint_errors", 0xb0, 8 },
+            { "port_xmit_constraint_errors", 0xb8, 8 },
+            { "vl_15_dropped", 0xc0, 16 },
+            { "port_xmit_data", 0xe0, 32 },
+            { "port_rcv_data", 0x100, 32 },
+            { "port_xmit_pkts", 0x120, 32 },
+            { "port_rcv_pkts", 0x140, 32 },
+            { "port_xmit_wait", 0x160, 32 },
+            { "symbol_error_counter_high", 0x40, 32 },
+            { "symbol_error_counter_low", 0x60, 32 },
+            { "link_error_recovery_counter_high", 0x80, 32 },
+            { "link_error_recovery_counter_low", 0xa0, 32 },
+            { "link_downed_counter_high", 0xc0, 32 },
+            { "link_downed_counter_low", 0xe0, 32 },
+            { "port_rcv_errors_high", 0x100, 32 },
+            { "port_rcv_errors_low", 0x120, 32 },
+            { "port_rcv_remote_physical_errors_high", 0x140, 32 },
+            { "port_rcv_remote_physical_errors_low", 0x160, 32 },
+            { "port_rcv_switch_relay_errors_high", 0x180, 32 },
+            { "port_rcv_switch_relay_errors_low", 0x1a0, 32 },
+            { "port_xmit_discards_high", 0x1c0, 32 },
+            { "port_xmit_discards_low", 0x1e0, 32 },
+            { "port_xmit_constraint_errors_high", 0x200, 32 },
+            { "port_xmit_constraint_errors_low", 0x220, 32 },
+            { "port_rcv_constraint_errors_high", 0x240, 32 },
+            { "port_rcv_constraint_errors_low", 0x260, 32 },
+            { "local_link_integrity_errors_high", 0x280, 32 },
+            { "local_link_integrity_errors_low", 0x2a0, 32 },
+            { "excessive_buffer_overrun_errors_high", 0x2c0, 32 },
+            { "excessive_buffer_overrun_errors_low", 0x2e0, 32 },
+            { "vl_15_dropped_high", 0x300, 32 },
+            { "vl_15_dropped_low", 0x320, 32 },
+            { "port_xmit_data_high", 0x340, 32 },
+            { "port_xmit_data_low", 0x360, 32 },
+            { "port_rcv_data_high", 0x380, 32 },
+            { "port_rcv_data_low", 0x3a0, 32 },
+            { "port_xmit_pkts_high", 0x3c0, 32 },
+            { "port_xmit_pkts_low", 0x3e0, 32 },
+            { "port_rcv_pkts_high", 0x400, 32 },
+            { "port_rcv_pkts_low", 0x420, 32 },
+            { "port_xmit_wait_high", 0x440, 32 },
+            { "port_xmit_wait_low", 0x460, 32 },
+            { "plr_rcv_codes_high", 0x40, 32 },
+            { "plr_rcv_codes_low", 0x60, 32 },
+            { "plr_rcv_code_err_high", 0x80, 32 },
+            { "plr_rcv_code_err_low", 0xa0, 32 },
+            { "plr_rcv_uncorrectable_code_high", 0xc0, 32 },
+            { "plr_rcv_uncorrectable_code_low", 0xe0, 32 },
+            { "plr_xmit_codes_high", 0x100, 32 },
+            { "plr_xmit_codes_low", 0x120, 32 },
+            { "plr_xmit_retry_codes_high", 0x140, 32 },
+            { "plr_xmit_retry_codes_low", 0x160, 32 },
+            { "plr_xmit_retry_events_high", 0x180, 32 },
+            { "plr_xmit_retry_events_low", 0x1a0, 32 },
+            { "plr_sync_events_high", 0x1c0, 32 },
+            { "plr_sync_events_low", 0x1e0, 32 },
+            { "hi_retransmission_rate_high", 0x200, 32 },
+            { "hi_retransmission_rate_low", 0x220, 32 },
+            { "plr_xmit_retry_codes_within_t_sec_max_high", 0x240, 32 },
+            { "plr_xmit_retry_codes_within_t_sec_max_low", 0x260, 32 },
+            { "hi_0", 0x40, 32 },
+            { "lo_0", 0x60, 32 },
+            { "hi_1", 0x80, 32 },
+            { "lo_1", 0xa0, 32 },
+            { "hi_2", 0xc0, 32 },
+            { "lo_2", 0xe0, 32 },
+            { "hi_3", 0x100, 32 },
+            { "lo_3", 0x120, 32 },
+            { "hi_4", 0x140, 32 },
+            { "lo_4", 0x160, 32 },
+            { "hi_5", 0x180, 32 },
+            { "lo_5", 0x1a0, 32 },
+            { "hi_6", 0x1c0, 32 },
+            { "lo_6", 0x1e0, 32 },
+            { "hi_7", 0x200, 32 },
+            { "lo_7", 0x220, 32 },
+            { "hi_8", 0x240, 32 },
+            { "lo_8", 0x260, 32 },
+            { "hi_9", 0x280, 32 },
+            { "lo_9", 0x2a0, 32 },
+            { "hi_10", 0x2c0, 32 },
+            { "lo_10", 0x2e0, 32 },
+            { "hi_11", 0x300, 32 },
+            { "lo_11", 0x320, 32 },
+            { "hi_12", 0x340, 32 },
+            { "lo_12", 0x360, 32 },
+            { "hi_13", 0x380, 32 },
+            { "lo_13", 0x3a0, 32 },
+            { "hi_14", 0x3c0, 32 },
+            { "lo_14", 0x3e0, 32 },
+            { "hi_15", 0x400, 32 },
+            { "lo_15", 0x420, 32 },
+            { "fc_fec_corrected_blocks_lane4_high", 0x180, 32 },
+            { "fc_fec_corrected_blocks_lane4_low", 0x1a0, 32 },
+            { "fc_fec_corrected_blocks_lane5_high", 0x1c0, 32 },
+            { "fc_fec_corrected_blocks_lane5_low", 0x1e0, 32 },
+            { "fc_fec_corrected_blocks_lane6_high", 0x200, 32 },
+            { "fc_fec_corrected_blocks_lane6_low", 0x220, 32 },
+            { "fc_fec_corrected_blocks_lane7_high", 0x240, 32 },
+            { "fc_fec_corrected_blocks_lane7_low", 0x260, 32 },
+            { "fc_fec_uncorrectable_blocks_lane4_high", 0x380, 32 },
+            { "fc_fec_uncorrectable_blocks_lane4_low", 0x3a0, 32 },
+            { "fc_fec_uncorrectable_blocks_lane5_high", 0x3c0, 32 },
+            { "fc_fec_uncorrectable_blocks_lane5_low", 0x3e0, 32 },
+            { "fc_fec_uncorrectable_blocks_lane6_high", 0x400, 32 },
+            { "fc_fec_uncorrectable_blocks_lane6_low", 0x420, 32 },
+            { "fc_fec_uncorrectable_blocks_lane7_high", 0x440, 32 },
+            { "fc_fec_uncorrectable_blocks_lane7_low", 0x460, 32 },
+        };
+        count = sizeof(table) / sizeof(table[0]);
+        return table;
+    }
+};
+
+struct PTYS {
+    static const char* name() { return "PTYS"; }
+    static constexpr u_int32_t size = 0x200;
+
+    struct proto_mask : AdbRegField<0x0, 3> {
+        typedef PTYS reg;
+        static const char* name() { return "proto_mask"; }
+    };
+    struct lp_msb : AdbRegField<0xc, 2> {
+        typedef PTYS reg;
+        static const char* name() { return "lp_msb"; }
+    };
+    struct local_port : AdbRegField<0x10, 8> {
+        typedef PTYS reg;
+        static const char* name() { return "local_port"; }
+    };
+    struct force_tx_aba_param : AdbRegField<0x18, 1> {
+        typedef PTYS reg;
+        static const char* name() { return "force_tx_aba_param"; }
+    };
+    struct an_disable_cap : AdbRegField<0x1d, 1> {
+        typedef PTYS reg;
+        static const char* name() { return "an_disable_cap"; }
+    };
+    struct an_disable_admin : AdbRegField<0x1e, 1> {
+        typedef PTYS reg;
+        static const char* name() { return "an_disable_admin"; }
+    };
+    struct reserved_high : AdbRegField<0x1f, 1> {
+        typedef PTYS reg;
+        static const char* name() { return "reserved_high"; }
+    };
+    struct data_rate_oper : AdbRegField<0x20, 16> {
+        typedef PTYS reg;
+        static const char* name() { return "data_rate_oper"; }
+    };
+    struct max_port_rate : AdbRegField<0x30, 12> {
+        typedef PTYS reg;
+        static const char* name() { return "max_port_rate"; }
+    };
+    struct an_status : AdbRegField<0x3c, 4> {
+        typedef PTYS reg;
+        static const char* name() { return "an_status"; }
+    };
+    struct ext_eth_proto_capability : AdbRegField<0x40, 32> {
+        typedef PTYS reg;
+        static const char* name() { return "ext_eth_proto_capability"; }
+    };
+    struct eth_proto_capability : AdbRegField<0x60, 32> {
+        typedef PTYS reg;
+        static const char* name() { return "eth_proto_capability"; }
+    };
+    struct ib_proto_capability : AdbRegField<0x80, 16> {
+        typedef PTYS reg;
+        static const char* name() { return "ib_proto_capability"; }
+    };
+    struct ib_link_width_capability : AdbRegField<0x90, 16> {
+        typedef PTYS reg;
+        static const char* name() { return "ib_link_width_capability"; }
+    };
+    struct ext_eth_proto_admin : AdbRegField<0xa0, 32> {
+        typedef PTYS reg;
+        static const char* name() { return "ext_eth_proto_admin"; }
+    };
+    struct eth_proto_admin : AdbRegField<0xc0, 32> {
+        typedef PTYS reg;
+        static const char* name() { return "eth_proto_admin"; }
+    };
+    struct ib_proto_admin : AdbRegField<0xe0, 16> {
+        typedef PTYS reg;
+        static const char* name() { return "ib_proto_admin"; }
+    };
+    struct ib_link_width_admin : AdbRegField<0xf0, 16> {
+        typedef PTYS reg;
+        static const char* name() { return "ib_link_width_admin"; }
+    };
+    struct ext_eth_proto_oper : AdbRegField<0x100, 32> {
+        typedef PTYS reg;
+        static const char* name() { return "ext_eth_proto_oper"; }
+    };
+    struct eth_proto_oper : AdbRegField<0x120, 32> {
+        typedef PTYS reg;
+        static const char* name() { return "eth_proto_oper"; }
+    };
+    struct ib_proto_oper : AdbRegField<0x140, 16> {
+        typedef PTYS reg;
+        static const char* name() { return "ib_proto_oper"; }
+    };
+    struct ib_link_width_oper : AdbRegField<0x150, 16> {
+        typedef PTYS reg;
+        static const char* name() { return "ib_link_width_oper"; }
+    };
+    struct connector_type : AdbRegField<0x160, 4> {
+        typedef PTYS reg;
+        static const char* name() { return "connector_type"; }
+    };
+    struct force_kr_frames_admin : AdbRegField<0x17c, 2> {
+        typedef PTYS reg;
+        static const char* name() { return "force_kr_frames_admin"; }
+    };
+    struct force_kr_frames_cap : AdbRegField<0x17e, 1> {
+        typedef PTYS reg;
+        static const char* name() { return "force_kr_frames_cap"; }
+    };
+    struct eth_proto_lp_advertise : AdbRegField<0x180, 32> {
+        typedef PTYS reg;
+        static const char* name() { return "eth_proto_lp_advertise"; }
+    };
+
+    static const AdbRegFieldDesc* fields(size_t &count)
+    {
+        static const AdbRegFieldDesc table[] = {
+            { "proto_mask", 0x0, 3 },
+            { "lp_msb", 0xc, 2 },
+            { "local_port", 0x10, 8 },
+            { "force_tx_aba_param", 0x18, 1 },
+            { "an_disable_cap", 0x1d, 1 },
+            { "an_disable_admin", 0x1e, 1 },
+            { "reserved_high", 0x1f, 1 },
+            { "data_rate_oper", 0x20, 16 },
+            { "max_port_rate", 0x30, 12 },
+            { "an_status", 0x3c, 4 },
+            { "ext_eth_proto_capability", 0x40, 32 },
+            { "eth_proto_capability", 0x60, 32 },
+            { "ib_proto_capability", 0x80, 16 },
+            { "ib_link_width_capability", 0x90, 16 },
+            { "ext_eth_proto_admin", 0xa0, 32 },
+            { "eth_proto_admin", 0xc0, 32 },
+            { "ib_proto_admin", 0xe0, 16 },
+            { "ib_link_width_admin", 0xf0, 16 },
+            { "ext_eth_proto_oper", 0x100, 32 },
+            { "eth_proto_oper", 0x120, 32 },
+            { "ib_proto_oper", 0x140, 16 },
+            { "ib_link_width_oper", 0x150, 16 },
+            { "connector_type", 0x160, 4 },
+            { "force_kr_frames_admin", 0x17c, 2 },
+            { "force_kr_frames_cap", 0x17e, 1 },
+            { "eth_proto_lp_advertise", 0x180, 32 },
+        };
+        count = sizeof(table) / sizeof(table[0]);
+        return table;
+    }
+};
+
+struct SLTP {
+    static const char* name() { return "SLTP"; }
+    static constexpr u_int32_t size = 0x260;
+
+    struct c_db : AdbRegField<0x0, 1> {
+        typedef SLTP reg;
+        static const char* name() { return "c_db"; }
+    };
+    struct lane_speed : AdbRegField<0x4, 4> {
+        typedef SLTP reg;
+        static const char* name() { return "lane_speed"; }
+    };
+    struct lane : AdbRegField<0x8, 4> {
+        typedef SLTP reg;
+        static const char* name() { return "lane"; }
+    };
+    struct tx_policy : AdbRegField<0xd, 1> {
+        typedef SLTP reg;
+        static const char* name() { return "tx_policy"; }
+    };
+    struct pnat : AdbRegField<0xe, 2> {
+        typedef SLTP reg;
+        static const char* name() { return "pnat"; }
+    };
+    struct local_port : AdbRegField<0x10, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "local_port"; }
+    };
+    struct version : AdbRegField<0x18, 4> {
+        typedef SLTP reg;
+        static const char* name() { return "version"; }
+    };
+    struct status : AdbRegField<0x1c, 4> {
+        typedef SLTP reg;
+        static const char* name() { return "status"; }
+    };
+    struct ob_tap2 : AdbRegField<0x40, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "ob_tap2"; }
+    };
+    struct ob_tap1 : AdbRegField<0x48, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "ob_tap1"; }
+    };
+    struct ob_tap0 : AdbRegField<0x50, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "ob_tap0"; }
+    };
+    struct polarity : AdbRegField<0x58, 1> {
+        typedef SLTP reg;
+        static const char* name() { return "polarity"; }
+    };
+    struct ob_bias : AdbRegField<0x60, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "ob_bias"; }
+    };
+    struct ob_reg : AdbRegField<0x68, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "ob_reg"; }
+    };
+    struct ob_preemp_mode : AdbRegField<0x70, 4> {
+        typedef SLTP reg;
+        static const char* name() { return "ob_preemp_mode"; }
+    };
+    struct ob_leva : AdbRegField<0x74, 4> {
+        typedef SLTP reg;
+        static const char* name() { return "ob_leva"; }
+    };
+    struct ob_bad_stat : AdbRegField<0x9d, 2> {
+        typedef SLTP reg;
+        static const char* name() { return "ob_bad_stat"; }
+    };
+    struct ob_norm : AdbRegField<0x9f, 1> {
+        typedef SLTP reg;
+        static const char* name() { return "ob_norm"; }
+    };
+    struct post_tap : AdbRegField<0x40, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "post_tap"; }
+    };
+    struct main_tap : AdbRegField<0x48, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "main_tap"; }
+    };
+    struct pre_tap : AdbRegField<0x50, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "pre_tap"; }
+    };
+    struct pre_2_tap : AdbRegField<0x58, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "pre_2_tap"; }
+    };
+    struct ob_alev_out : AdbRegField<0x60, 5> {
+        typedef SLTP reg;
+        static const char* name() { return "ob_alev_out"; }
+    };
+    struct ob_amp : AdbRegField<0x68, 7> {
+        typedef SLTP reg;
+        static const char* name() { return "ob_amp"; }
+    };
+    struct ob_m2lp : AdbRegField<0x79, 7> {
+        typedef SLTP reg;
+        static const char* name() { return "ob_m2lp"; }
+    };
+    struct inner_eye_1 : AdbRegField<0x60, 16> {
+        typedef SLTP reg;
+        static const char* name() { return "inner_eye_1"; }
+    };
+    struct inner_eye_2 : AdbRegField<0x70, 16> {
+        typedef SLTP reg;
+        static const char* name() { return "inner_eye_2"; }
+    };
+    struct tx_swing : AdbRegField<0x80, 4> {
+        typedef SLTP reg;
+        static const char* name() { return "tx_swing"; }
+    };
+    struct fir_pre2 : AdbRegField<0x20, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "fir_pre2"; }
+    };
+    struct fir_pre3 : AdbRegField<0x28, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "fir_pre3"; }
+    };
+    struct fir_post1 : AdbRegField<0x48, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "fir_post1"; }
+    };
+    struct fir_main : AdbRegField<0x50, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "fir_main"; }
+    };
+    struct fir_pre1 : AdbRegField<0x58, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "fir_pre1"; }
+    };
+    struct lut0 : AdbRegField<0x60, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut0"; }
+    };
+    struct lut1 : AdbRegField<0x68, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut1"; }
+    };
+    struct lut2 : AdbRegField<0x70, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut2"; }
+    };
+    struct lut3 : AdbRegField<0x78, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut3"; }
+    };
+    struct lut4 : AdbRegField<0x80, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut4"; }
+    };
+    struct lut5 : AdbRegField<0x88, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut5"; }
+    };
+    struct lut6 : AdbRegField<0x90, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut6"; }
+    };
+    struct lut7 : AdbRegField<0x98, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut7"; }
+    };
+    struct lut8 : AdbRegField<0xa0, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut8"; }
+    };
+    struct lut9 : AdbRegField<0xa8, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut9"; }
+    };
+    struct lut10 : AdbRegField<0xb0, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut10"; }
+    };
+    struct lut11 : AdbRegField<0xb8, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut11"; }
+    };
+    struct lut12 : AdbRegField<0xc0, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut12"; }
+    };
+    struct lut13 : AdbRegField<0xc8, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut13"; }
+    };
+    struct lut14 : AdbRegField<0xd0, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut14"; }
+    };
+    struct lut15 : AdbRegField<0xd8, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut15"; }
+    };
+    struct lut16 : AdbRegField<0xe0, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut16"; }
+    };
+    struct lut17 : AdbRegField<0xe8, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut17"; }
+    };
+    struct lut18 : AdbRegField<0xf0, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut18"; }
+    };
+    struct lut19 : AdbRegField<0xf8, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut19"; }
+    };
+    struct lut20 : AdbRegField<0x100, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut20"; }
+    };
+    struct lut21 : AdbRegField<0x108, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut21"; }
+    };
+    struct lut22 : AdbRegField<0x110, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut22"; }
+    };
+    struct lut23 : AdbRegField<0x118, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut23"; }
+    };
+    struct lut24 : AdbRegField<0x120, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut24"; }
+    };
+    struct lut25 : AdbRegField<0x128, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut25"; }
+    };
+    struct lut26 : AdbRegField<0x130, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut26"; }
+    };
+    struct lut27 : AdbRegField<0x138, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut27"; }
+    };
+    struct lut28 : AdbRegField<0x140, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut28"; }
+    };
+    struct lut29 : AdbRegField<0x148, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut29"; }
+    };
+    struct lut30 : AdbRegField<0x150, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut30"; }
+    };
+    struct lut31 : AdbRegField<0x158, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut31"; }
+    };
+    struct lut32 : AdbRegField<0x160, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut32"; }
+    };
+    struct lut33 : AdbRegField<0x168, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut33"; }
+    };
+    struct lut34 : AdbRegField<0x170, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut34"; }
+    };
+    struct lut35 : AdbRegField<0x178, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut35"; }
+    };
+    struct lut36 : AdbRegField<0x180, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut36"; }
+    };
+    struct lut37 : AdbRegField<0x188, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut37"; }
+    };
+    struct lut38 : AdbRegField<0x190, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut38"; }
+    };
+    struct lut39 : AdbRegField<0x198, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut39"; }
+    };
+    struct lut40 : AdbRegField<0x1a0, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut40"; }
+    };
+    struct lut41 : AdbRegField<0x1a8, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut41"; }
+    };
+    struct lut42 : AdbRegField<0x1b0, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut42"; }
+    };
+    struct lut43 : AdbRegField<0x1b8, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut43"; }
+    };
+    struct lut44 : AdbRegField<0x1c0, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut44"; }
+    };
+    struct lut45 : AdbRegField<0x1c8, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut45"; }
+    };
+    struct lut46 : AdbRegField<0x1d0, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut46"; }
+    };
+    struct lut47 : AdbRegField<0x1d8, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut47"; }
+    };
+    struct lut48 : AdbRegField<0x1e0, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut48"; }
+    };
+    struct lut49 : AdbRegField<0x1e8, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut49"; }
+    };
+    struct lut50 : AdbRegField<0x1f0, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut50"; }
+    };
+    struct lut51 : AdbRegField<0x1f8, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut51"; }
+    };
+    struct lut52 : AdbRegField<0x200, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut52"; }
+    };
+    struct lut53 : AdbRegField<0x208, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut53"; }
+    };
+    struct lut54 : AdbRegField<0x210, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut54"; }
+    };
+    struct lut55 : AdbRegField<0x218, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut55"; }
+    };
+    struct lut56 : AdbRegField<0x220, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut56"; }
+    };
+    struct lut57 : AdbRegField<0x228, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut57"; }
+    };
+    struct lut58 : AdbRegField<0x230, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut58"; }
+    };
+    struct lut59 : AdbRegField<0x238, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut59"; }
+    };
+    struct lut60 : AdbRegField<0x240, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut60"; }
+    };
+    struct lut61 : AdbRegField<0x248, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut61"; }
+    };
+    struct lut62 : AdbRegField<0x250, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut62"; }
+    };
+    struct lut63 : AdbRegField<0x258, 8> {
+        typedef SLTP reg;
+        static const char* name() { return "lut63"; }
+    };
+
+    static const AdbRegFieldDesc* fields(size_t &count)
+    {
+        static const AdbRegFieldDesc table[] = {
+            { "c_db", 0x0, 1 },
+            { "lane_speed", 0x4, 4 },
+            { "lane", 0x8, 4 },
+            { "tx_policy", 0xd, 1 },
+            { "pnat", 0xe, 2 },
+            { "local_port", 0x10, 8 },
+            { "version", 0x18, 4 },
+            { "status", 0x1c, 4 },
+            { "ob_tap2", 0x40, 8 },
+            { "ob_tap1", 0x48, 8 },
+            { "ob_tap0", 0x50, 8 },
+            { "polarity", 0x58, 1 },
+            { "ob_bias", 0x60, 8 },
+            { "ob_reg", 0x68, 8 },
+            { "ob_preemp_mode", 0x70, 4 },
+            { "ob_leva", 0x74, 4 },
+            { "ob_bad_stat", 0x9d, 2 },
+            { "ob_norm", 0x9f, 1 },
+            { "post_tap", 0x40, 8 },
+            { "main_tap", 0x48, 8 },
+            { "pre_tap", 0x50, 8 },
+            { "pre_2_tap", 0x58, 8 },
+            { "ob_alev_out", 0x60, 5 },
+            { "ob_amp", 0x68, 7 },
+            { "ob_m2lp", 0x79, 7 },
+            { "inner_eye_1", 0x60, 16 },
+            { "inner_eye_2", 0x70, 16 },
+            { "tx_swing", 0x80, 4 },
+            { "fir_pre2", 0x20, 8 },
+            { "fir_pre3", 0x28, 8 },
+            { "fir_post1", 0x48, 8 },
+            { "fir_main", 0x50, 8 },
+            { "fir_pre1", 0x58, 8 },
+            { "lut0", 0x60, 8 },
+            { "lut1", 0x68, 8 },
+            { "lut2", 0x70, 8 },
+            { "lut3", 0x78, 8 },
+            { "lut4", 0x80, 8 },
+            { "lut5", 0x88, 8 },
+            { "lut6", 0x90, 8 },
+            { "lut7", 0x98, 8 },
+            { "lut8", 0xa0, 8 },
+            { "lut9", 0xa8, 8 },
+            { "lut10", 0xb0, 8 },
+            { "lut11", 0xb8, 8 },
+            { "lut12", 0xc0, 8 },
+            { "lut13", 0xc8, 8 },
+            { "lut14", 0xd0, 8 },
+            { "lut15", 0xd8, 8 },
+            { "lut16", 0xe0, 8 },
+            { "lut17", 0xe8, 8 },
+            { "lut18", 0xf0, 8 },
+            { "lut19", 0xf8, 8 },
+            { "lut20", 0x100, 8 },
+            { "lut21", 0x108, 8 },
+            { "lut22", 0x110, 8 },
+            { "lut23", 0x118, 8 },
+            { "lut24", 0x120, 8 },
+            { "lut25", 0x128, 8 },
+            { "lut26", 0x130, 8 },
+            { "lut27", 0x138, 8 },
+            { "lut28", 0x140, 8 },
+            { "lut29", 0x148, 8 },
+            { "lut30", 0x150, 8 },
+            { "lut31", 0x158, 8 },
+            { "lut32", 0x160, 8 },
+            { "lut33", 0x168, 8 },
+            { "lut34", 0x170, 8 },
+            { "lut35", 0x178, 8 },
+            { "lut36", 0x180, 8 },
+            { "lut37", 0x188, 8 },
+            { "lut38", 0x190, 8 },
+            { "lut39", 0x198, 8 },
+            { "lut40", 0x1a0, 8 },
+            { "lut41", 0x1a8, 8 },
+            { "lut42", 0x1b0, 8 },
+            { "lut43", 0x1b8, 8 },
+            { "lut44", 0x1c0, 8 },
+            { "lut45", 0x1c8, 8 },
+            { "lut46", 0x1d0, 8 },
+            { "lut47", 0x1d8, 8 },
+            { "lut48", 0x1e0, 8 },
+            { "lut49", 0x1e8, 8 },
+            { "lut50", 0x1f0, 8 },
+            { "lut51", 0x1f8, 8 },
+            { "lut52", 0x200, 8 },
+            { "lut53", 0x208, 8 },
+            { "lut54", 0x210, 8 },
+            { "lut55", 0x218, 8 },
+            { "lut56", 0x220, 8 },
+            { "lut57", 0x228, 8 },
+            { "lut58", 0x230, 8 },
+            { "lut59", 0x238, 8 },
+            { "lut60", 0x240, 8 },
+            { "lut61", 0x248, 8 },
+            { "lut62", 0x250, 8 },
+            { "lut63", 0x258, 8 },
+        };
+        count = sizeof(table) / sizeof(table[0]);
+        return table;
+    }
+};
+
+struct MCIA {
+    static const char* name() { return "MCIA"; }
+    static constexpr u_int32_t size = 0x480;
+
+    struct status : AdbRegField<0x0, 8> {
+        typedef MCIA reg;
+        static const char* name() { return "status"; }
+    };
+    struct slot_index : AdbRegField<0xc, 4> {
+        typedef MCIA reg;
+        static const char* name() { return "slot_index"; }
+    };
+    struct module : AdbRegField<0x10, 8> {
+        typedef MCIA reg;
+        static const char* name() { return "module"; }
+    };
+    struct l : AdbRegField<0x1f, 1> {
+        typedef MCIA reg;
+        static const char* name() { return "l"; }
+    };
+    struct device_address : AdbRegField<0x20, 16> {
+        typedef MCIA reg;
+        static const char* name() { return "device_address"; }
+    };
+    struct page_number : AdbRegField<0x30, 8> {
+        typedef MCIA reg;
+        static const char* name() { return "page_number"; }
+    };
+    struct i2c_device_address : AdbRegField<0x38, 8> {
+        typedef MCIA reg;
+        static const char* name() { return "i2c_device_address"; }
+    };
+    struct size_ : AdbRegField<0x40, 16> {
+        typedef MCIA reg;
+        static const char* name() { return "size"; }
+    };
+    struct bank_number : AdbRegField<0x50, 8> {
+        typedef MCIA reg;
+        static const char* name() { return "bank_number"; }
+    };
+    struct dword_0 : AdbRegField<0x80, 32> {
+        typedef MCIA reg;
+        static const char* name() { return "dword[0]"; }
+    };
+    struct dword_1 : AdbRegField<0xa0, 32> {
+        typedef MCIA reg;
+        static const char* name() { return "dword[1]"; }
+    };
+    struct dword_2 : AdbRegField<0xc0, 32> {
+        typedef MCIA reg;
+        static const char* name() { return "dword[2]"; }
+    };
+    struct dword_3 : AdbRegField<0xe0, 32> {
+        typedef MCIA reg;
+        static const char* name() { return "dword[3]"; }
+    };
+    struct dword_4 : AdbRegField<0x100, 32> {
+        typedef MCIA reg;
+        static const char* name() { return "dword[4]"; }
+    };
+    struct dword_5 : AdbRegField<0x120, 32> {
+        typedef MCIA reg;
+        static const char* name() { return "dword[5]"; }
+    };
+    struct dword_6 : AdbRegField<0x140, 32> {
+        typedef MCIA reg;
+        static const char* name() { return "dword[6]"; }
+    };
+    struct dword_7 : AdbRegField<0x160, 32> {
+        typedef MCIA reg;
+        static const char* name() { return "dword[7]"; }
+    };
+    struct dword_8 : AdbRegField<0x180, 32> {
+        typedef MCIA reg;
+        static const char* name() { return "dword[8]"; }
+    };
+    struct dword_9 : AdbRegField<0x1a0, 32> {
+        typedef MCIA reg;
+        static const char* name() { return "dword[9]"; }
+    };
+    struct dword_10 : AdbRegField<0x1c0, 32> {
+        typedef MCIA reg;
+        static const char* name() { return "dword[10]"; }
+    };
+    struct dword_11 : AdbRegField<0x1e0, 32> {
+        typedef MCIA reg;
+        static const char* name() { return "dword[11]"; }
+    };
+    struct dword_12 : AdbRegField<0x200, 32> {
+        typedef MCIA reg;
+        static const char* name() { return "dword[12]"; }
+    };
+    struct dword_13 : AdbRegField<0x220, 32> {
+        typedef MCIA reg;
+        static const char* name() { return "dword[13]"; }
+    };
+    struct dword_14 : AdbRegField<0x240, 32> {
+        typedef MCIA reg;
+        static const char* name() { return "dword[14]"; }
+    };
+    struct dword_15 : AdbRegField<0x260, 32> {
+        typedef MCIA reg;
+        static const char* name() { return "dword[15]"; }
+    };
+    struct dword_16 : AdbRegField<0x280, 32> {
+        typedef MCIA reg;
+        static const char* name() { return "dword[16]"; }
+    };
+    struct dword_17 : AdbRegField<0x2a0, 32> {
+        typedef MCIA reg;
+        static const char* name() { return "dword[17]"; }
+    };
+    struct dword_18 : AdbRegField<0x2c0, 32> {
+        typedef MCIA reg;
+        static const char* name() { return "dword[18]"; }
+    };
+    struct dword_19 : AdbRegField<0x2e0, 32> {
+        typedef MCIA reg;
+        static const char* name() { return "dword[19]"; }
+    };
+    struct dword_20 : AdbRegField<0x300, 32> {
+        typedef MCIA reg;
+        static const char* name() { return "dword[20]"; }
+    };
+    struct dword_21 : AdbRegField<0x320, 32> {
+        typedef MCIA reg;
+        static const char* name() { return "dword[21]"; }
+    };
+    struct dword_22 : AdbRegField<0x340, 32> {
+        typedef MCIA reg;
+        static const char* name() { return "dword[22]"; }
+    };
+    struct dword_23 : AdbRegField<0x360, 32> {
+        typedef MCIA reg;
+        static const char* name() { return "dword[23]"; }
+    };
+    struct dword_24 : AdbRegField<0x380, 32> {
+        typedef MCIA reg;
+        static const char* name() { return "dword[24]"; }
+    };
+    struct dword_25 : AdbRegField<0x3a0, 32> {
+        typedef MCIA reg;
+        static const char* name() { return "dword[25]"; }
+    };
+    struct dword_26 : AdbRegField<0x3c0, 32> {
+        typedef MCIA reg;
+        static const char* name() { return "dword[26]"; }
+    };
+    struct dword_27 : AdbRegField<0x3e0, 32> {
+        typedef MCIA reg;
+        static const char* name() { return "dword[27]"; }
+    };
+    struct dword_28 : AdbRegField<0x400, 32> {
+        typedef MCIA reg;
+        static const char* name() { return "dword[28]"; }
+    };
+    struct dword_29 : AdbRegField<0x420, 32> {
+        typedef MCIA reg;
+        static const char* name() { return "dword[29]"; }
+    };
+    struct dword_30 : AdbRegField<0x440, 32> {
+        typedef MCIA reg;
+        static const char* name() { return "dword[30]"; }
+    };
+    struct dword_31 : AdbRegField<0x460, 32> {
+        typedef MCIA reg;
+        static const char* name() { return "dword[31]"; }
+    };
+
+    static const AdbRegFieldDesc* fields(size_t &count)
+    {
+        static const AdbRegFieldDesc table[] = {
+            { "status", 0x0, 8 },
+            { "slot_index", 0xc, 4 },
+            { "module", 0x10, 8 },
+            { "l", 0x1f, 1 },
+            { "device_address", 0x20, 16 },
+            { "page_number", 0x30, 8 },
+            { "i2c_device_address", 0x38, 8 },
+            { "size", 0x40, 16 },
+            { "bank_number", 0x50, 8 },
+            { "dword[0]", 0x80, 32 },
+            { "dword[1]", 0xa0, 32 },
+            { "dword[2]", 0xc0, 32 },
+            { "dword[3]", 0xe0, 32 },
+            { "dword[4]", 0x100, 32 },
+            { "dword[5]", 0x120, 32 },
+            { "dword[6]", 0x140, 32 },
+            { "dword[7]", 0x160, 32 },
+            { "dword[8]", 0x180, 32 },
+            { "dword[9]", 0x1a0, 32 },
+            { "dword[10]", 0x1c0, 32 },
+            { "dword[11]", 0x1e0, 32 },
+            { "dword[12]", 0x200, 32 },
+            { "dword[13]", 0x220, 32 },
+            { "dword[14]", 0x240, 32 },
+            { "dword[15]", 0x260, 32 },
+            { "dword[16]", 0x280, 32 },
+            { "dword[17]", 0x2a0, 32 },
+            { "dword[18]", 0x2c0, 32 },
+            { "dword[19]", 0x2e0, 32 },
+            { "dword[20]", 0x300, 32 },
+            { "dword[21]", 0x320, 32 },
+            { "dword[22]", 0x340, 32 },
+            { "dword[23]", 0x360, 32 },
+            { "dword[24]", 0x380, 32 },
+            { "dword[25]", 0x3a0, 32 },
+            { "dword[26]", 0x3c0, 32 },
+            { "dword[27]", 0x3e0, 32 },
+            { "dword[28]", 0x400, 32 },
+            { "dword[29]", 0x420, 32 },
+            { "dword[30]", 0x440, 32 },
+            { "dword[31]", 0x460, 32 },
+        };
+        count = sizeof(table) / sizeof(table[0]);
+        return table;
+    }
+};
+
+struct SLRED {
+    static const char* name() { return "SLRED"; }
+    static constexpr u_int32_t size = 0x540;
+
+    struct page_data_sel : AdbRegField<0x0, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "page_data_sel"; }
+    };
+    struct lane : AdbRegField<0x8, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "lane"; }
+    };
+    struct lp_msb : AdbRegField<0xc, 2> {
+        typedef SLRED reg;
+        static const char* name() { return "lp_msb"; }
+    };
+    struct pnat : AdbRegField<0xe, 2> {
+        typedef SLRED reg;
+        static const char* name() { return "pnat"; }
+    };
+    struct local_port : AdbRegField<0x10, 8> {
+        typedef SLRED reg;
+        static const char* name() { return "local_port"; }
+    };
+    struct version : AdbRegField<0x18, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "version"; }
+    };
+    struct status : AdbRegField<0x1c, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "status"; }
+    };
+    struct lane_speed : AdbRegField<0x20, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "lane_speed"; }
+    };
+    struct abort : AdbRegField<0x2e, 1> {
+        typedef SLRED reg;
+        static const char* name() { return "abort"; }
+    };
+    struct err_res_base : AdbRegField<0x2f, 3> {
+        typedef SLRED reg;
+        static const char* name() { return "err_res_base"; }
+    };
+    struct eye_sel : AdbRegField<0x32, 2> {
+        typedef SLRED reg;
+        static const char* name() { return "eye_sel"; }
+    };
+    struct measure_time : AdbRegField<0x34, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "measure_time"; }
+    };
+    struct eye_diag_dim : AdbRegField<0x38, 3> {
+        typedef SLRED reg;
+        static const char* name() { return "eye_diag_dim"; }
+    };
+    struct err_res_scale : AdbRegField<0x3b, 2> {
+        typedef SLRED reg;
+        static const char* name() { return "err_res_scale"; }
+    };
+    struct destructive_ctrl : AdbRegField<0x3d, 1> {
+        typedef SLRED reg;
+        static const char* name() { return "destructive_ctrl"; }
+    };
+    struct last_scan : AdbRegField<0x3e, 1> {
+        typedef SLRED reg;
+        static const char* name() { return "last_scan"; }
+    };
+    struct en : AdbRegField<0x3f, 1> {
+        typedef SLRED reg;
+        static const char* name() { return "en"; }
+    };
+    struct mv_ticks_res : AdbRegField<0x40, 16> {
+        typedef SLRED reg;
+        static const char* name() { return "mv_ticks_res"; }
+    };
+    struct ps_ticks_res : AdbRegField<0x50, 16> {
+        typedef SLRED reg;
+        static const char* name() { return "ps_ticks_res"; }
+    };
+    struct mv_center_pos : AdbRegField<0x60, 16> {
+        typedef SLRED reg;
+        static const char* name() { return "mv_center_pos"; }
+    };
+    struct ps_center_pos : AdbRegField<0x70, 16> {
+        typedef SLRED reg;
+        static const char* name() { return "ps_center_pos"; }
+    };
+    struct margin : AdbRegField<0x80, 24> {
+        typedef SLRED reg;
+        static const char* name() { return "margin"; }
+    };
+    struct margin_version : AdbRegField<0x98, 8> {
+        typedef SLRED reg;
+        static const char* name() { return "margin_version"; }
+    };
+    struct height_eo_neg : AdbRegField<0xa0, 16> {
+        typedef SLRED reg;
+        static const char* name() { return "height_eo_neg"; }
+    };
+    struct height_eo_pos : AdbRegField<0xb0, 16> {
+        typedef SLRED reg;
+        static const char* name() { return "height_eo_pos"; }
+    };
+    struct phase_eo_neg : AdbRegField<0xc0, 16> {
+        typedef SLRED reg;
+        static const char* name() { return "phase_eo_neg"; }
+    };
+    struct phase_eo_pos : AdbRegField<0xd0, 16> {
+        typedef SLRED reg;
+        static const char* name() { return "phase_eo_pos"; }
+    };
+    struct err_val_7 : AdbRegField<0x40, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[7]"; }
+    };
+    struct err_val_6 : AdbRegField<0x44, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[6]"; }
+    };
+    struct err_val_5 : AdbRegField<0x48, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[5]"; }
+    };
+    struct err_val_4 : AdbRegField<0x4c, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[4]"; }
+    };
+    struct err_val_3 : AdbRegField<0x50, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[3]"; }
+    };
+    struct err_val_2 : AdbRegField<0x54, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[2]"; }
+    };
+    struct err_val_1 : AdbRegField<0x58, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[1]"; }
+    };
+    struct err_val_0 : AdbRegField<0x5c, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[0]"; }
+    };
+    struct err_val_15 : AdbRegField<0x60, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[15]"; }
+    };
+    struct err_val_14 : AdbRegField<0x64, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[14]"; }
+    };
+    struct err_val_13 : AdbRegField<0x68, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[13]"; }
+    };
+    struct err_val_12 : AdbRegField<0x6c, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[12]"; }
+    };
+    struct err_val_11 : AdbRegField<0x70, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[11]"; }
+    };
+    struct err_val_10 : AdbRegField<0x74, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[10]"; }
+    };
+    struct err_val_9 : AdbRegField<0x78, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[9]"; }
+    };
+    struct err_val_8 : AdbRegField<0x7c, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[8]"; }
+    };
+    struct err_val_23 : AdbRegField<0x80, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[23]"; }
+    };
+    struct err_val_22 : AdbRegField<0x84, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[22]"; }
+    };
+    struct err_val_21 : AdbRegField<0x88, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[21]"; }
+    };
+    struct err_val_20 : AdbRegField<0x8c, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[20]"; }
+    };
+    struct err_val_19 : AdbRegField<0x90, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[19]"; }
+    };
+    struct err_val_18 : AdbRegField<0x94, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[18]"; }
+    };
+    struct err_val_17 : AdbRegField<0x98, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[17]"; }
+    };
+    struct err_val_16 : AdbRegField<0x9c, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[16]"; }
+    };
+    struct err_val_31 : AdbRegField<0xa0, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[31]"; }
+    };
+    struct err_val_30 : AdbRegField<0xa4, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[30]"; }
+    };
+    struct err_val_29 : AdbRegField<0xa8, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[29]"; }
+    };
+    struct err_val_28 : AdbRegField<0xac, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[28]"; }
+    };
+    struct err_val_27 : AdbRegField<0xb0, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[27]"; }
+    };
+    struct err_val_26 : AdbRegField<0xb4, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[26]"; }
+    };
+    struct err_val_25 : AdbRegField<0xb8, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[25]"; }
+    };
+    struct err_val_24 : AdbRegField<0xbc, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[24]"; }
+    };
+    struct err_val_39 : AdbRegField<0xc0, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[39]"; }
+    };
+    struct err_val_38 : AdbRegField<0xc4, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[38]"; }
+    };
+    struct err_val_37 : AdbRegField<0xc8, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[37]"; }
+    };
+    struct err_val_36 : AdbRegField<0xcc, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[36]"; }
+    };
+    struct err_val_35 : AdbRegField<0xd0, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[35]"; }
+    };
+    struct err_val_34 : AdbRegField<0xd4, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[34]"; }
+    };
+    struct err_val_33 : AdbRegField<0xd8, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[33]"; }
+    };
+    struct err_val_32 : AdbRegField<0xdc, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[32]"; }
+    };
+    struct err_val_47 : AdbRegField<0xe0, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[47]"; }
+    };
+    struct err_val_46 : AdbRegField<0xe4, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[46]"; }
+    };
+    struct err_val_45 : AdbRegField<0xe8, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[45]"; }
+    };
+    struct err_val_44 : AdbRegField<0xec, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[44]"; }
+    };
+    struct err_val_43 : AdbRegField<0xf0, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[43]"; }
+    };
+    struct err_val_42 : AdbRegField<0xf4, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[42]"; }
+    };
+    struct err_val_41 : AdbRegField<0xf8, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[41]"; }
+    };
+    struct err_val_40 : AdbRegField<0xfc, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[40]"; }
+    };
+    struct err_val_55 : AdbRegField<0x100, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[55]"; }
+    };
+    struct err_val_54 : AdbRegField<0x104, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[54]"; }
+    };
+    struct err_val_53 : AdbRegField<0x108, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[53]"; }
+    };
+    struct err_val_52 : AdbRegField<0x10c, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[52]"; }
+    };
+    struct err_val_51 : AdbRegField<0x110, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[51]"; }
+    };
+    struct err_val_50 : AdbRegField<0x114, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[50]"; }
+    };
+    struct err_val_49 : AdbRegField<0x118, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[49]"; }
+    };
+    struct err_val_48 : AdbRegField<0x11c, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[48]"; }
+    };
+    struct err_val_63 : AdbRegField<0x120, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[63]"; }
+    };
+    struct err_val_62 : AdbRegField<0x124, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[62]"; }
+    };
+    struct err_val_61 : AdbRegField<0x128, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[61]"; }
+    };
+    struct err_val_60 : AdbRegField<0x12c, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[60]"; }
+    };
+    struct err_val_59 : AdbRegField<0x130, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[59]"; }
+    };
+    struct err_val_58 : AdbRegField<0x134, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[58]"; }
+    };
+    struct err_val_57 : AdbRegField<0x138, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[57]"; }
+    };
+    struct err_val_56 : AdbRegField<0x13c, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[56]"; }
+    };
+    struct err_val_71 : AdbRegField<0x140, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[71]"; }
+    };
+    struct err_val_70 : AdbRegField<0x144, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[70]"; }
+    };
+    struct err_val_69 : AdbRegField<0x148, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[69]"; }
+    };
+    struct err_val_68 : AdbRegField<0x14c, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[68]"; }
+    };
+    struct err_val_67 : AdbRegField<0x150, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[67]"; }
+    };
+    struct err_val_66 : AdbRegField<0x154, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[66]"; }
+    };
+    struct err_val_65 : AdbRegField<0x158, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[65]"; }
+    };
+    struct err_val_64 : AdbRegField<0x15c, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[64]"; }
+    };
+    struct err_val_79 : AdbRegField<0x160, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[79]"; }
+    };
+    struct err_val_78 : AdbRegField<0x164, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[78]"; }
+    };
+    struct err_val_77 : AdbRegField<0x168, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[77]"; }
+    };
+    struct err_val_76 : AdbRegField<0x16c, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[76]"; }
+    };
+    struct err_val_75 : AdbRegField<0x170, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[75]"; }
+    };
+    struct err_val_74 : AdbRegField<0x174, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[74]"; }
+    };
+    struct err_val_73 : AdbRegField<0x178, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[73]"; }
+    };
+    struct err_val_72 : AdbRegField<0x17c, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[72]"; }
+    };
+    struct err_val_87 : AdbRegField<0x180, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[87]"; }
+    };
+    struct err_val_86 : AdbRegField<0x184, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[86]"; }
+    };
+    struct err_val_85 : AdbRegField<0x188, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[85]"; }
+    };
+    struct err_val_84 : AdbRegField<0x18c, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[84]"; }
+    };
+    struct err_val_83 : AdbRegField<0x190, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[83]"; }
+    };
+    struct err_val_82 : AdbRegField<0x194, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[82]"; }
+    };
+    struct err_val_81 : AdbRegField<0x198, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[81]"; }
+    };
+    struct err_val_80 : AdbRegField<0x19c, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[80]"; }
+    };
+    struct err_val_95 : AdbRegField<0x1a0, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[95]"; }
+    };
+    struct err_val_94 : AdbRegField<0x1a4, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[94]"; }
+    };
+    struct err_val_93 : AdbRegField<0x1a8, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[93]"; }
+    };
+    struct err_val_92 : AdbRegField<0x1ac, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[92]"; }
+    };
+    struct err_val_91 : AdbRegField<0x1b0, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[91]"; }
+    };
+    struct err_val_90 : AdbRegField<0x1b4, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[90]"; }
+    };
+    struct err_val_89 : AdbRegField<0x1b8, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[89]"; }
+    };
+    struct err_val_88 : AdbRegField<0x1bc, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[88]"; }
+    };
+    struct err_val_103 : AdbRegField<0x1c0, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[103]"; }
+    };
+    struct err_val_102 : AdbRegField<0x1c4, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[102]"; }
+    };
+    struct err_val_101 : AdbRegField<0x1c8, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[101]"; }
+    };
+    struct err_val_100 : AdbRegField<0x1cc, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[100]"; }
+    };
+    struct err_val_99 : AdbRegField<0x1d0, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[99]"; }
+    };
+    struct err_val_98 : AdbRegField<0x1d4, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[98]"; }
+    };
+    struct err_val_97 : AdbRegField<0x1d8, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[97]"; }
+    };
+    struct err_val_96 : AdbRegField<0x1dc, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[96]"; }
+    };
+    struct err_val_111 : AdbRegField<0x1e0, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[111]"; }
+    };
+    struct err_val_110 : AdbRegField<0x1e4, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[110]"; }
+    };
+    struct err_val_109 : AdbRegField<0x1e8, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[109]"; }
+    };
+    struct err_val_108 : AdbRegField<0x1ec, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[108]"; }
+    };
+    struct err_val_107 : AdbRegField<0x1f0, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[107]"; }
+    };
+    struct err_val_106 : AdbRegField<0x1f4, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[106]"; }
+    };
+    struct err_val_105 : AdbRegField<0x1f8, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[105]"; }
+    };
+    struct err_val_104 : AdbRegField<0x1fc, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[104]"; }
+    };
+    struct err_val_119 : AdbRegField<0x200, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[119]"; }
+    };
+    struct err_val_118 : AdbRegField<0x204, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[118]"; }
+    };
+    struct err_val_117 : AdbRegField<0x208, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[117]"; }
+    };
+    struct err_val_116 : AdbRegField<0x20c, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[116]"; }
+    };
+    struct err_val_115 : AdbRegField<0x210, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[115]"; }
+    };
+    struct err_val_114 : AdbRegField<0x214, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[114]"; }
+    };
+    struct err_val_113 : AdbRegField<0x218, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[113]"; }
+    };
+    struct err_val_112 : AdbRegField<0x21c, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[112]"; }
+    };
+    struct err_val_127 : AdbRegField<0x220, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[127]"; }
+    };
+    struct err_val_126 : AdbRegField<0x224, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[126]"; }
+    };
+    struct err_val_125 : AdbRegField<0x228, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[125]"; }
+    };
+    struct err_val_124 : AdbRegField<0x22c, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[124]"; }
+    };
+    struct err_val_123 : AdbRegField<0x230, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[123]"; }
+    };
+    struct err_val_122 : AdbRegField<0x234, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[122]"; }
+    };
+    struct err_val_121 : AdbRegField<0x238, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[121]"; }
+    };
+    struct err_val_120 : AdbRegField<0x23c, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[120]"; }
+    };
+    struct err_val_135 : AdbRegField<0x240, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[135]"; }
+    };
+    struct err_val_134 : AdbRegField<0x244, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[134]"; }
+    };
+    struct err_val_133 : AdbRegField<0x248, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[133]"; }
+    };
+    struct err_val_132 : AdbRegField<0x24c, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[132]"; }
+    };
+    struct err_val_131 : AdbRegField<0x250, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[131]"; }
+    };
+    struct err_val_130 : AdbRegField<0x254, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[130]"; }
+    };
+    struct err_val_129 : AdbRegField<0x258, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[129]"; }
+    };
+    struct err_val_128 : AdbRegField<0x25c, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[128]"; }
+    };
+    struct err_val_143 : AdbRegField<0x260, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[143]"; }
+    };
+    struct err_val_142 : AdbRegField<0x264, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[142]"; }
+    };
+    struct err_val_141 : AdbRegField<0x268, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[141]"; }
+    };
+    struct err_val_140 : AdbRegField<0x26c, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[140]"; }
+    };
+    struct err_val_139 : AdbRegField<0x270, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[139]"; }
+    };
+    struct err_val_138 : AdbRegField<0x274, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[138]"; }
+    };
+    struct err_val_137 : AdbRegField<0x278, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[137]"; }
+    };
+    struct err_val_136 : AdbRegField<0x27c, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[136]"; }
+    };
+    struct err_val_151 : AdbRegField<0x280, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[151]"; }
+    };
+    struct err_val_150 : AdbRegField<0x284, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[150]"; }
+    };
+    struct err_val_149 : AdbRegField<0x288, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[149]"; }
+    };
+    struct err_val_148 : AdbRegField<0x28c, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[148]"; }
+    };
+    struct err_val_147 : AdbRegField<0x290, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[147]"; }
+    };
+    struct err_val_146 : AdbRegField<0x294, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[146]"; }
+    };
+    struct err_val_145 : AdbRegField<0x298, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[145]"; }
+    };
+    struct err_val_144 : AdbRegField<0x29c, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[144]"; }
+    };
+    struct err_val_159 : AdbRegField<0x2a0, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[159]"; }
+    };
+    struct err_val_158 : AdbRegField<0x2a4, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[158]"; }
+    };
+    struct err_val_157 : AdbRegField<0x2a8, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[157]"; }
+    };
+    struct err_val_156 : AdbRegField<0x2ac, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[156]"; }
+    };
+    struct err_val_155 : AdbRegField<0x2b0, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[155]"; }
+    };
+    struct err_val_154 : AdbRegField<0x2b4, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[154]"; }
+    };
+    struct err_val_153 : AdbRegField<0x2b8, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[153]"; }
+    };
+    struct err_val_152 : AdbRegField<0x2bc, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[152]"; }
+    };
+    struct err_val_167 : AdbRegField<0x2c0, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[167]"; }
+    };
+    struct err_val_166 : AdbRegField<0x2c4, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[166]"; }
+    };
+    struct err_val_165 : AdbRegField<0x2c8, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[165]"; }
+    };
+    struct err_val_164 : AdbRegField<0x2cc, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[164]"; }
+    };
+    struct err_val_163 : AdbRegField<0x2d0, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[163]"; }
+    };
+    struct err_val_162 : AdbRegField<0x2d4, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[162]"; }
+    };
+    struct err_val_161 : AdbRegField<0x2d8, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[161]"; }
+    };
+    struct err_val_160 : AdbRegField<0x2dc, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[160]"; }
+    };
+    struct err_val_175 : AdbRegField<0x2e0, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[175]"; }
+    };
+    struct err_val_174 : AdbRegField<0x2e4, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[174]"; }
+    };
+    struct err_val_173 : AdbRegField<0x2e8, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[173]"; }
+    };
+    struct err_val_172 : AdbRegField<0x2ec, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[172]"; }
+    };
+    struct err_val_171 : AdbRegField<0x2f0, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[171]"; }
+    };
+    struct err_val_170 : AdbRegField<0x2f4, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[170]"; }
+    };
+    struct err_val_169 : AdbRegField<0x2f8, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[169]"; }
+    };
+    struct err_val_168 : AdbRegField<0x2fc, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[168]"; }
+    };
+    struct err_val_183 : AdbRegField<0x300, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[183]"; }
+    };
+    struct err_val_182 : AdbRegField<0x304, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[182]"; }
+    };
+    struct err_val_181 : AdbRegField<0x308, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[181]"; }
+    };
+    struct err_val_180 : AdbRegField<0x30c, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[180]"; }
+    };
+    struct err_val_179 : AdbRegField<0x310, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[179]"; }
+    };
+    struct err_val_178 : AdbRegField<0x314, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[178]"; }
+    };
+    struct err_val_177 : AdbRegField<0x318, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[177]"; }
+    };
+    struct err_val_176 : AdbRegField<0x31c, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[176]"; }
+    };
+    struct err_val_191 : AdbRegField<0x320, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[191]"; }
+    };
+    struct err_val_190 : AdbRegField<0x324, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[190]"; }
+    };
+    struct err_val_189 : AdbRegField<0x328, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[189]"; }
+    };
+    struct err_val_188 : AdbRegField<0x32c, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[188]"; }
+    };
+    struct err_val_187 : AdbRegField<0x330, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[187]"; }
+    };
+    struct err_val_186 : AdbRegField<0x334, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[186]"; }
+    };
+    struct err_val_185 : AdbRegField<0x338, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[185]"; }
+    };
+    struct err_val_184 : AdbRegField<0x33c, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[184]"; }
+    };
+    struct err_val_199 : AdbRegField<0x340, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[199]"; }
+    };
+    struct err_val_198 : AdbRegField<0x344, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[198]"; }
+    };
+    struct err_val_197 : AdbRegField<0x348, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[197]"; }
+    };
+    struct err_val_196 : AdbRegField<0x34c, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[196]"; }
+    };
+    struct err_val_195 : AdbRegField<0x350, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[195]"; }
+    };
+    struct err_val_194 : AdbRegField<0x354, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[194]"; }
+    };
+    struct err_val_193 : AdbRegField<0x358, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[193]"; }
+    };
+    struct err_val_192 : AdbRegField<0x35c, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[192]"; }
+    };
+    struct err_val_207 : AdbRegField<0x360, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[207]"; }
+    };
+    struct err_val_206 : AdbRegField<0x364, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[206]"; }
+    };
+    struct err_val_205 : AdbRegField<0x368, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[205]"; }
+    };
+    struct err_val_204 : AdbRegField<0x36c, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[204]"; }
+    };
+    struct err_val_203 : AdbRegField<0x370, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[203]"; }
+    };
+    struct err_val_202 : AdbRegField<0x374, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[202]"; }
+    };
+    struct err_val_201 : AdbRegField<0x378, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[201]"; }
+    };
+    struct err_val_200 : AdbRegField<0x37c, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[200]"; }
+    };
+    struct err_val_215 : AdbRegField<0x380, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[215]"; }
+    };
+    struct err_val_214 : AdbRegField<0x384, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[214]"; }
+    };
+    struct err_val_213 : AdbRegField<0x388, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[213]"; }
+    };
+    struct err_val_212 : AdbRegField<0x38c, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[212]"; }
+    };
+    struct err_val_211 : AdbRegField<0x390, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[211]"; }
+    };
+    struct err_val_210 : AdbRegField<0x394, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[210]"; }
+    };
+    struct err_val_209 : AdbRegField<0x398, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[209]"; }
+    };
+    struct err_val_208 : AdbRegField<0x39c, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[208]"; }
+    };
+    struct err_val_223 : AdbRegField<0x3a0, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[223]"; }
+    };
+    struct err_val_222 : AdbRegField<0x3a4, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[222]"; }
+    };
+    struct err_val_221 : AdbRegField<0x3a8, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[221]"; }
+    };
+    struct err_val_220 : AdbRegField<0x3ac, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[220]"; }
+    };
+    struct err_val_219 : AdbRegField<0x3b0, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[219]"; }
+    };
+    struct err_val_218 : AdbRegField<0x3b4, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[218]"; }
+    };
+    struct err_val_217 : AdbRegField<0x3b8, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[217]"; }
+    };
+    struct err_val_216 : AdbRegField<0x3bc, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[216]"; }
+    };
+    struct err_val_231 : AdbRegField<0x3c0, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[231]"; }
+    };
+    struct err_val_230 : AdbRegField<0x3c4, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[230]"; }
+    };
+    struct err_val_229 : AdbRegField<0x3c8, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[229]"; }
+    };
+    struct err_val_228 : AdbRegField<0x3cc, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[228]"; }
+    };
+    struct err_val_227 : AdbRegField<0x3d0, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[227]"; }
+    };
+    struct err_val_226 : AdbRegField<0x3d4, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[226]"; }
+    };
+    struct err_val_225 : AdbRegField<0x3d8, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[225]"; }
+    };
+    struct err_val_224 : AdbRegField<0x3dc, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[224]"; }
+    };
+    struct err_val_239 : AdbRegField<0x3e0, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[239]"; }
+    };
+    struct err_val_238 : AdbRegField<0x3e4, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[238]"; }
+    };
+    struct err_val_237 : AdbRegField<0x3e8, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[237]"; }
+    };
+    struct err_val_236 : AdbRegField<0x3ec, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[236]"; }
+    };
+    struct err_val_235 : AdbRegField<0x3f0, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[235]"; }
+    };
+    struct err_val_234 : AdbRegField<0x3f4, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[234]"; }
+    };
+    struct err_val_233 : AdbRegField<0x3f8, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[233]"; }
+    };
+    struct err_val_232 : AdbRegField<0x3fc, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[232]"; }
+    };
+    struct err_val_247 : AdbRegField<0x400, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[247]"; }
+    };
+    struct err_val_246 : AdbRegField<0x404, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[246]"; }
+    };
+    struct err_val_245 : AdbRegField<0x408, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[245]"; }
+    };
+    struct err_val_244 : AdbRegField<0x40c, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[244]"; }
+    };
+    struct err_val_243 : AdbRegField<0x410, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[243]"; }
+    };
+    struct err_val_242 : AdbRegField<0x414, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[242]"; }
+    };
+    struct err_val_241 : AdbRegField<0x418, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[241]"; }
+    };
+    struct err_val_240 : AdbRegField<0x41c, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[240]"; }
+    };
+    struct err_val_255 : AdbRegField<0x420, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[255]"; }
+    };
+    struct err_val_254 : AdbRegField<0x424, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[254]"; }
+    };
+    struct err_val_253 : AdbRegField<0x428, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[253]"; }
+    };
+    struct err_val_252 : AdbRegField<0x42c, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[252]"; }
+    };
+    struct err_val_251 : AdbRegField<0x430, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[251]"; }
+    };
+    struct err_val_250 : AdbRegField<0x434, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[250]"; }
+    };
+    struct err_val_249 : AdbRegField<0x438, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[249]"; }
+    };
+    struct err_val_248 : AdbRegField<0x43c, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[248]"; }
+    };
+    struct err_val_263 : AdbRegField<0x440, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[263]"; }
+    };
+    struct err_val_262 : AdbRegField<0x444, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[262]"; }
+    };
+    struct err_val_261 : AdbRegField<0x448, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[261]"; }
+    };
+    struct err_val_260 : AdbRegField<0x44c, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[260]"; }
+    };
+    struct err_val_259 : AdbRegField<0x450, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[259]"; }
+    };
+    struct err_val_258 : AdbRegField<0x454, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[258]"; }
+    };
+    struct err_val_257 : AdbRegField<0x458, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[257]"; }
+    };
+    struct err_val_256 : AdbRegField<0x45c, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[256]"; }
+    };
+    struct err_val_271 : AdbRegField<0x460, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[271]"; }
+    };
+    struct err_val_270 : AdbRegField<0x464, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[270]"; }
+    };
+    struct err_val_269 : AdbRegField<0x468, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[269]"; }
+    };
+    struct err_val_268 : AdbRegField<0x46c, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[268]"; }
+    };
+    struct err_val_267 : AdbRegField<0x470, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[267]"; }
+    };
+    struct err_val_266 : AdbRegField<0x474, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[266]"; }
+    };
+    struct err_val_265 : AdbRegField<0x478, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[265]"; }
+    };
+    struct err_val_264 : AdbRegField<0x47c, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[264]"; }
+    };
+    struct err_val_279 : AdbRegField<0x480, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[279]"; }
+    };
+    struct err_val_278 : AdbRegField<0x484, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[278]"; }
+    };
+    struct err_val_277 : AdbRegField<0x488, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[277]"; }
+    };
+    struct err_val_276 : AdbRegField<0x48c, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[276]"; }
+    };
+    struct err_val_275 : AdbRegField<0x490, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[275]"; }
+    };
+    struct err_val_274 : AdbRegField<0x494, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[274]"; }
+    };
+    struct err_val_273 : AdbRegField<0x498, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[273]"; }
+    };
+    struct err_val_272 : AdbRegField<0x49c, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[272]"; }
+    };
+    struct err_val_287 : AdbRegField<0x4a0, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[287]"; }
+    };
+    struct err_val_286 : AdbRegField<0x4a4, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[286]"; }
+    };
+    struct err_val_285 : AdbRegField<0x4a8, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[285]"; }
+    };
+    struct err_val_284 : AdbRegField<0x4ac, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[284]"; }
+    };
+    struct err_val_283 : AdbRegField<0x4b0, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[283]"; }
+    };
+    struct err_val_282 : AdbRegField<0x4b4, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[282]"; }
+    };
+    struct err_val_281 : AdbRegField<0x4b8, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[281]"; }
+    };
+    struct err_val_280 : AdbRegField<0x4bc, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[280]"; }
+    };
+    struct err_val_295 : AdbRegField<0x4c0, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[295]"; }
+    };
+    struct err_val_294 : AdbRegField<0x4c4, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[294]"; }
+    };
+    struct err_val_293 : AdbRegField<0x4c8, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[293]"; }
+    };
+    struct err_val_292 : AdbRegField<0x4cc, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[292]"; }
+    };
+    struct err_val_291 : AdbRegField<0x4d0, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[291]"; }
+    };
+    struct err_val_290 : AdbRegField<0x4d4, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[290]"; }
+    };
+    struct err_val_289 : AdbRegField<0x4d8, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[289]"; }
+    };
+    struct err_val_288 : AdbRegField<0x4dc, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[288]"; }
+    };
+    struct err_val_303 : AdbRegField<0x4e0, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[303]"; }
+    };
+    struct err_val_302 : AdbRegField<0x4e4, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[302]"; }
+    };
+    struct err_val_301 : AdbRegField<0x4e8, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[301]"; }
+    };
+    struct err_val_300 : AdbRegField<0x4ec, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[300]"; }
+    };
+    struct err_val_299 : AdbRegField<0x4f0, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[299]"; }
+    };
+    struct err_val_298 : AdbRegField<0x4f4, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[298]"; }
+    };
+    struct err_val_297 : AdbRegField<0x4f8, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[297]"; }
+    };
+    struct err_val_296 : AdbRegField<0x4fc, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[296]"; }
+    };
+    struct err_val_311 : AdbRegField<0x500, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[311]"; }
+    };
+    struct err_val_310 : AdbRegField<0x504, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[310]"; }
+    };
+    struct err_val_309 : AdbRegField<0x508, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[309]"; }
+    };
+    struct err_val_308 : AdbRegField<0x50c, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[308]"; }
+    };
+    struct err_val_307 : AdbRegField<0x510, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[307]"; }
+    };
+    struct err_val_306 : AdbRegField<0x514, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[306]"; }
+    };
+    struct err_val_305 : AdbRegField<0x518, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[305]"; }
+    };
+    struct err_val_304 : AdbRegField<0x51c, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[304]"; }
+    };
+    struct err_val_319 : AdbRegField<0x520, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[319]"; }
+    };
+    struct err_val_318 : AdbRegField<0x524, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[318]"; }
+    };
+    struct err_val_317 : AdbRegField<0x528, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[317]"; }
+    };
+    struct err_val_316 : AdbRegField<0x52c, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[316]"; }
+    };
+    struct err_val_315 : AdbRegField<0x530, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[315]"; }
+    };
+    struct err_val_314 : AdbRegField<0x534, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[314]"; }
+    };
+    struct err_val_313 : AdbRegField<0x538, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[313]"; }
+    };
+    struct err_val_312 : AdbRegField<0x53c, 4> {
+        typedef SLRED reg;
+        static const char* name() { return "err_val[312]"; }
+    };
+
+    static const AdbRegFieldDesc* fields(size_t &count)
+    {
+        static const AdbRegFieldDesc table[] = {
+            { "page_data_sel", 0x0, 4 },
+            { "lane", 0x8, 4 },
+            { "lp_msb", 0xc, 2 },
+            { "pnat", 0xe, 2 },
+            { "local_port", 0x10, 8 },
+            { "version", 0x18, 4 },
+            { "status", 0x1c, 4 },
+            { "lane_speed", 0x20, 4 },
+            { "abort", 0x2e, 1 },
+            { "err_res_base", 0x2f, 3 },
+            { "eye_sel", 0x32, 2 },
+            { "measure_time", 0x34, 4 },
+            { "eye_diag_dim", 0x38, 3 },
+            { "err_res_scale", 0x3b, 2 },
+            { "destructive_ctrl", 0x3d, 1 },
+            { "last_scan", 0x3e, 1 },
+            { "en", 0x3f, 1 },
+            { "mv_ticks_res", 0x40, 16 },
+            { "ps_ticks_res", 0x50, 16 },
+            { "mv_center_pos", 0x60, 16 },
+            { "ps_center_pos", 0x70, 16 },
+            { "margin", 0x80, 24 },
+            { "margin_version", 0x98, 8 },
+            { "height_eo_neg", 0xa0, 16 },
+            { "height_eo_pos", 0xb0, 16 },
+            { "phase_eo_neg", 0xc0, 16 },
+            { "phase_eo_pos", 0xd0, 16 },
+            { "err_val[7]", 0x40, 4 },
+            { "err_val[6]", 0x44, 4 },
+            { "err_val[5]", 0x48, 4 },
+            { "err_val[4]", 0x4c, 4 },
+            { "err_val[3]", 0x50, 4 },
+            { "err_val[2]", 0x54, 4 },
+            { "err_val[1]", 0x58, 4 },
+            { "err_val[0]", 0x5c, 4 },
+            { "err_val[15]", 0x60, 4 },
+            { "err_val[14]", 0x64, 4 },
+            { "err_val[13]", 0x68, 4 },
+            { "err_val[12]", 0x6c, 4 },
+            { "err_val[11]", 0x70, 4 },
+            { "err_val[10]", 0x74, 4 },
+            { "err_val[9]", 0x78, 4 },
+            { "err_val[8]", 0x7c, 4 },
+            { "err_val[23]", 0x80, 4 },
+            { "err_val[22]", 0x84, 4 },
+            { "err_val[21]", 0x88, 4 },
+            { "err_val[20]", 0x8c, 4 },
+            { "err_val[19]", 0x90, 4 },
+            { "err_val[18]", 0x94, 4 },
+            { "err_val[17]", 0x98, 4 },
+            { "err_val[16]", 0x9c, 4 },
+            { "err_val[31]", 0xa0, 4 },
+            { "err_val[30]", 0xa4, 4 },
+            { "err_val[29]", 0xa8, 4 },
+            { "err_val[28]", 0xac, 4 },
+            { "err_val[27]", 0xb0, 4 },
+            { "err_val[26]", 0xb4, 4 },
+            { "err_val[25]", 0xb8, 4 },
+            { "err_val[24]", 0xbc, 4 },
+            { "err_val[39]", 0xc0, 4 },
+            { "err_val[38]", 0xc4, 4 },
+            { "err_val[37]", 0xc8, 4 },
+            { "err_val[36]", 0xcc, 4 },
+            { "err_val[35]", 0xd0, 4 },
+            { "err_val[34]", 0xd4, 4 },
+            { "err_val[33]", 0xd8, 4 },
+            { "err_val[32]", 0xdc, 4 },
+            { "err_val[47]", 0xe0, 4 },
+            { "err_val[46]", 0xe4, 4 },
+            { "err_val[45]", 0xe8, 4 },
+            { "err_val[44]", 0xec, 4 },
+            { "err_val[43]", 0xf0, 4 },
+            { "err_val[42]", 0xf4, 4 },
+            { "err_val[41]", 0xf8, 4 },
+            { "err_val[40]", 0xfc, 4 },
+            { "err_val[55]", 0x100, 4 },
+            { "err_val[54]", 0x104, 4 },
+            { "err_val[53]", 0x108, 4 },
+            { "err_val[52]", 0x10c, 4 },
+            { "err_val[51]", 0x110, 4 },
+            { "err_val[50]", 0x114, 4 },
+            { "err_val[49]", 0x118, 4 },
+            { "err_val[48]", 0x11c, 4 },
+            { "err_val[63]", 0x120, 4 },
+            { "err_val[62]", 0x124, 4 },
+            { "err_val[61]", 0x128, 4 },
+            { "err_val[60]", 0x12c, 4 },
+            { "err_val[59]", 0x130, 4 },
+            { "err_val[58]", 0x134, 4 },
+            { "err_val[57]", 0x138, 4 },
+            { "err_val[56]", 0x13c, 4 },
+            { "err_val[71]", 0x140, 4 },
+            { "err_val[70]", 0x144, 4 },
+            { "err_val[69]", 0x148, 4 },
+            { "err_val[68]", 0x14c, 4 },
+            { "err_val[67]", 0x150, 4 },
+            { "err_val[66]", 0x154, 4 },
+            { "err_val[65]", 0x158, 4 },
+            { "err_val[64]", 0x15c, 4 },
+            { "err_val[79]", 0x160, 4 },
+            { "err_val[78]", 0x164, 4 },
+            { "err_val[77]", 0x168, 4 },
+            { "err_val[76]", 0x16c, 4 },
+            { "err_val[75]", 0x170, 4 },
+            { "err_val[74]", 0x174, 4 },
+            { "err_val[73]", 0x178, 4 },
+            { "err_val[72]", 0x17c, 4 },
+            { "err_val[87]", 0x180, 4 },
+            { "err_val[86]", 0x184, 4 },
+            { "err_val[85]", 0x188, 4 },
+            { "err_val[84]", 0x18c, 4 },
+            { "err_val[83]", 0x190, 4 },
+            { "err_val[82]", 0x194, 4 },
+            { "err_val[81]", 0x198, 4 },
+            { "err_val[80]", 0x19c, 4 },
+            { "err_val[95]", 0x1a0, 4 },
+            { "err_val[94]", 0x1a4, 4 },
+            { "err_val[93]", 0x1a8, 4 },
+            { "err_val[92]", 0x1ac, 4 },
+            { "err_val[91]", 0x1b0, 4 },
+            { "err_val[90]", 0x1b4, 4 },
+            { "err_val[89]", 0x1b8, 4 },
+            { "err_val[88]", 0x1bc, 4 },
+            { "err_val[103]", 0x1c0, 4 },
+            { "err_val[102]", 0x1c4, 4 },
+            { "err_val[101]", 0x1c8, 4 },
+            { "err_val[100]", 0x1cc, 4 },
+            { "err_val[99]", 0x1d0, 4 },
+            { "err_val[98]", 0x1d4, 4 },
+            { "err_val[97]", 0x1d8, 4 },
+            { "err_val[96]", 0x1dc, 4 },
+            { "err_val[111]", 0x1e0, 4 },
+            { "err_val[110]", 0x1e4, 4 },
+            { "err_val[109]", 0x1e8, 4 },
+            { "err_val[108]", 0x1ec, 4 },
+            { "err_val[107]", 0x1f0, 4 },
+            { "err_val[106]", 0x1f4, 4 },
+            { "err_val[105]", 0x1f8, 4 },
+            { "err_val[104]", 0x1fc, 4 },
+            { "err_val[119]", 0x200, 4 },
+            { "err_val[118]", 0x204, 4 },
+            { "err_val[117]", 0x208, 4 },
+            { "err_val[116]", 0x20c, 4 },
+            { "err_val[115]", 0x210, 4 },
+            { "err_val[114]", 0x214, 4 },
+            { "err_val[113]", 0x218, 4 },
+            { "err_val[112]", 0x21c, 4 },
+            { "err_val[127]", 0x220, 4 },
+            { "err_val[126]", 0x224, 4 },
+            { "err_val[125]", 0x228, 4 },
+            { "err_val[124]", 0x22c, 4 },
+            { "err_val[123]", 0x230, 4 },
+            { "err_val[122]", 0x234, 4 },
+            { "err_val[121]", 0x238, 4 },
+            { "err_val[120]", 0x23c, 4 },
+            { "err_val[135]", 0x240, 4 },
+            { "err_val[134]", 0x244, 4 },
+            { "err_val[133]", 0x248, 4 },
+            { "err_val[132]", 0x24c, 4 },
+            { "err_val[131]", 0x250, 4 },
+            { "err_val[130]", 0x254, 4 },
+            { "err_val[129]", 0x258, 4 },
+            { "err_val[128]", 0x25c, 4 },
+            { "err_val[143]", 0x260, 4 },
+            { "err_val[142]", 0x264, 4 },
+            { "err_val[141]", 0x268, 4 },
+            { "err_val[140]", 0x26c, 4 },
+            { "err_val[139]", 0x270, 4 },
+            { "err_val[138]", 0x274, 4 },
+            { "err_val[137]", 0x278, 4 },
+            { "err_val[136]", 0x27c, 4 },
+            { "err_val[151]", 0x280, 4 },
+            { "err_val[150]", 0x284, 4 },
+            { "err_val[149]", 0x288, 4 },
+            { "err_val[148]", 0x28c, 4 },
+            { "err_val[147]", 0x290, 4 },
+            { "err_val[146]", 0x294, 4 },
+            { "err_val[145]", 0x298, 4 },
+            { "err_val[144]", 0x29c, 4 },
+            { "err_val[159]", 0x2a0, 4 },
+            { "err_val[158]", 0x2a4, 4 },
+            { "err_val[157]", 0x2a8, 4 },
+            { "err_val[156]", 0x2ac, 4 },
+            { "err_val[155]", 0x2b0, 4 },
+            { "err_val[154]", 0x2b4, 4 },
+            { "err_val[153]", 0x2b8, 4 },
+            { "err_val[152]", 0x2bc, 4 },
+            { "err_val[167]", 0x2c0, 4 },
+            { "err_val[166]", 0x2c4, 4 },
+            { "err_val[165]", 0x2c8, 4 },
+            { "err_val[164]", 0x2cc, 4 },
+            { "err_val[163]", 0x2d0, 4 },
+            { "err_val[162]", 0x2d4, 4 },
+            { "err_val[161]", 0x2d8, 4 },
+            { "err_val[160]", 0x2dc, 4 },
+            { "err_val[175]", 0x2e0, 4 },
+            { "err_val[174]", 0x2e4, 4 },
+            { "err_val[173]", 0x2e8, 4 },
+            { "err_val[172]", 0x2ec, 4 },
+            { "err_val[171]", 0x2f0, 4 },
+            { "err_val[170]", 0x2f4, 4 },
+            { "err_val[169]", 0x2f8, 4 },
+            { "err_val[168]", 0x2fc, 4 },
+            { "err_val[183]", 0x300, 4 },
+            { "err_val[182]", 0x304, 4 },
+            { "err_val[181]", 0x308, 4 },
+            { "err_val[180]", 0x30c, 4 },
+            { "err_val[179]", 0x310, 4 },
+            { "err_val[178]", 0x314, 4 },
+            { "err_val[177]", 0x318, 4 },
+            { "err_val[176]", 0x31c, 4 },
+            { "err_val[191]", 0x320, 4 },
+            { "err_val[190]", 0x324, 4 },
+            { "err_val[189]", 0x328, 4 },
+            { "err_val[188]", 0x32c, 4 },
+            { "err_val[187]", 0x330, 4 },
+            { "err_val[186]", 0x334, 4 },
+            { "err_val[185]", 0x338, 4 },
+            { "err_val[184]", 0x33c, 4 },
+            { "err_val[199]", 0x340, 4 },
+            { "err_val[198]", 0x344, 4 },
+            { "err_val[197]", 0x348, 4 },
+            { "err_val[196]", 0x34c, 4 },
+            { "err_val[195]", 0x350, 4 },
+            { "err_val[194]", 0x354, 4 },
+            { "err_val[193]", 0x358, 4 },
+            { "err_val[192]", 0x35c, 4 },
+            { "err_val[207]", 0x360, 4 },
+            { "err_val[206]", 0x364, 4 },
+            { "err_val[205]", 0x368, 4 },
+            { "err_val[204]", 0x36c, 4 },
+            { "err_val[203]", 0x370, 4 },
+            { "err_val[202]", 0x374, 4 },
+            { "err_val[201]", 0x378, 4 },
+            { "err_val[200]", 0x37c, 4 },
+            { "err_val[215]", 0x380, 4 },
+            { "err_val[214]", 0x384, 4 },
+            { "err_val[213]", 0x388, 4 },
+            { "err_val[212]", 0x38c, 4 },
+            { "err_val[211]", 0x390, 4 },
+            { "err_val[210]", 0x394, 4 },
+            { "err_val[209]", 0x398, 4 },
+            { "err_val[208]", 0x39c, 4 },
+            { "err_val[223]", 0x3a0, 4 },
+            { "err_val[222]", 0x3a4, 4 },
+            { "err_val[221]", 0x3a8, 4 },
+            { "err_val[220]", 0x3ac, 4 },
+            { "err_val[219]", 0x3b0, 4 },
+            { "err_val[218]", 0x3b4, 4 },
+            { "err_val[217]", 0x3b8, 4 },
+            { "err_val[216]", 0x3bc, 4 },
+            { "err_val[231]", 0x3c0, 4 },
+            { "err_val[230]", 0x3c4, 4 },
+            { "err_val[229]", 0x3c8, 4 },
+            { "err_val[228]", 0x3cc, 4 },
+            { "err_val[227]", 0x3d0, 4 },
+            { "err_val[226]", 0x3d4, 4 },
+            { "err_val[225]", 0x3d8, 4 },
+            { "err_val[224]", 0x3dc, 4 },
+            { "err_val[239]", 0x3e0, 4 },
+            { "err_val[238]", 0x3e4, 4 },
+            { "err_val[237]", 0x3e8, 4 },
+            { "err_val[236]", 0x3ec, 4 },
+            { "err_val[235]", 0x3f0, 4 },
+            { "err_val[234]", 0x3f4, 4 },
+            { "err_val[233]", 0x3f8, 4 },
+            { "err_val[232]", 0x3fc, 4 },
+            { "err_val[247]", 0x400, 4 },
+            { "err_val[246]", 0x404, 4 },
+            { "err_val[245]", 0x408, 4 },
+            { "err_val[244]", 0x40c, 4 },
+            { "err_val[243]", 0x410, 4 },
+            { "err_val[242]", 0x414, 4 },
+            { "err_val[241]", 0x418, 4 },
+            { "err_val[240]", 0x41c, 4 },
+            { "err_val[255]", 0x420, 4 },
+            { "err_val[254]", 0x424, 4 },
+            { "err_val[253]", 0x428, 4 },
+            { "err_val[252]", 0x42c, 4 },
+            { "err_val[251]", 0x430, 4 },
+            { "err_val[250]", 0x434, 4 },
+            { "err_val[249]", 0x438, 4 },
+            { "err_val[248]", 0x43c, 4 },
+            { "err_val[263]", 0x440, 4 },
+            { "err_val[262]", 0x444, 4 },
+            { "err_val[261]", 0x448, 4 },
+            { "err_val[260]", 0x44c, 4 },
+            { "err_val[259]", 0x450, 4 },
+            { "err_val[258]", 0x454, 4 },
+            { "err_val[257]", 0x458, 4 },
+            { "err_val[256]", 0x45c, 4 },
+            { "err_val[271]", 0x460, 4 },
+            { "err_val[270]", 0x464, 4 },
+            { "err_val[269]", 0x468, 4 },
+            { "err_val[268]", 0x46c, 4 },
+            { "err_val[267]", 0x470, 4 },
+            { "err_val[266]", 0x474, 4 },
+            { "err_val[265]", 0x478, 4 },
+            { "err_val[264]", 0x47c, 4 },
+            { "err_val[279]", 0x480, 4 },
+            { "err_val[278]", 0x484, 4 },
+            { "err_val[277]", 0x488, 4 },
+            { "err_val[276]", 0x48c, 4 },
+            { "err_val[275]", 0x490, 4 },
+            { "err_val[274]", 0x494, 4 },
+            { "err_val[273]", 0x498, 4 },
+            { "err_val[272]", 0x49c, 4 },
+            { "err_val[287]", 0x4a0, 4 },
+            { "err_val[286]", 0x4a4, 4 },
+            { "err_val[285]", 0x4a8, 4 },
+            { "err_val[284]", 0x4ac, 4 },
+            { "err_val[283]", 0x4b0, 4 },
+            { "err_val[282]", 0x4b4, 4 },
+            { "err_val[281]", 0x4b8, 4 },
+            { "err_val[280]", 0x4bc, 4 },
+            { "err_val[295]", 0x4c0, 4 },
+            { "err_val[294]", 0x4c4, 4 },
+            { "err_val[293]", 0x4c8, 4 },
+            { "err_val[292]", 0x4cc, 4 },
+            { "err_val[291]", 0x4d0, 4 },
+            { "err_val[290]", 0x4d4, 4 },
+            { "err_val[289]", 0x4d8, 4 },
+            { "err_val[288]", 0x4dc, 4 },
+            { "err_val[303]", 0x4e0, 4 },
+            { "err_val[302]", 0x4e4, 4 },
+            { "err_val[301]", 0x4e8, 4 },
+            { "err_val[300]", 0x4ec, 4 },
+            { "err_val[299]", 0x4f0, 4 },
+            { "err_val[298]", 0x4f4, 4 },
+            { "err_val[297]", 0x4f8, 4 },
+            { "err_val[296]", 0x4fc, 4 },
+            { "err_val[311]", 0x500, 4 },
+            { "err_val[310]", 0x504, 4 },
+            { "err_val[309]", 0x508, 4 },
+            { "err_val[308]", 0x50c, 4 },
+            { "err_val[307]", 0x510, 4 },
+            { "err_val[306]", 0x514, 4 },
+            { "err_val[305]", 0x518, 4 },
+            { "err_val[304]", 0x51c, 4 },
+            { "err_val[319]", 0x520, 4 },
+            { "err_val[318]", 0x524, 4 },
+            { "err_val[317]", 0x528, 4 },
+            { "err_val[316]", 0x52c, 4 },
+            { "err_val[315]", 0x530, 4 },
+            { "err_val[314]", 0x534, 4 },
+            { "err_val[313]", 0x538, 4 },
+            { "err_val[312]", 0x53c, 4 },
+        };
+        count = sizeof(table) / sizeof(table[0]);
+        return table;
+    }
+};
+
+} // namespace adb_regs
+
+#endif // MLXLINK_REG_LAYOUTS_H
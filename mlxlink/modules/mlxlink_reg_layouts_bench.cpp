@@ -0,0 +1,135 @@
+/*
+ * Copyright (C) Jan 2019 Mellanox Technologies Ltd. All rights reserved.
+ *
+ * This software is available to you under a choice of one of two
+ * licenses.  You may choose to be licensed under the terms of the GNU
+ * General Public License (GPL) Version 2, available from the file
+ * COPYING in the main directory of this source tree, or the
+ * OpenIB.org BSD license below:
+ *
+ *     Redistribution and use in source and binary forms, with or
+ *     without modification, are permitted provided that the following
+ *     conditions are met:
+ *
+ *      - Redistributions of source code must retain the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer.
+ *
+ *      - Redistributions in binary form must reproduce the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer in the documentation and/or other materials
+ *        provided with the distribution.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * Per-access cost of a register field read by name, through a resolved
+ * AdbInstance, and through the accessors generated in mlxlink_reg_layouts.h.
+ * Also checks some generated MCIA fields against the loaded ADB. Not part
+ * of the build, from the top of a built tree:
+ *   g++ -O2 -std=c++11 -I. -Icommon -Iadb_parser mlxlink/modules/mlxlink_reg_layouts_bench.cpp \
+ *       adb_parser/libadb_parser.a mft_utils/libmftutils.a -lboost_regex -lboost_filesystem \
+ *       -lboost_system -lexpat -lpthread -o reg_layouts_bench
+ *   ./reg_layouts_bench tools_layouts/adb/prm/hca/ext/register_access_table.adb
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <string>
+#include <vector>
+#include <adb_parser/adb_parser.h>
+#include "mlxlink_reg_layouts.h"
+
+#define ROUNDS 2000000
+
+static double now()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+template <typename F>
+static int checkField(AdbInstance *node, u_int8_t *buf)
+{
+    AdbInstance *field = node->getChildByPath(F::name());
+    if (!field || field->offset - node->offset != F::offset || field->size != F::size) {
+        printf("-E- MCIA.%s does not match the ADB\n", F::name());
+        return 1;
+    }
+    if (field->popBuf(buf) != F::get(buf)) {
+        printf("-E- MCIA.%s reads differently\n", F::name());
+        return 1;
+    }
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc < 2) {
+        printf("usage: %s <register_access_table.adb>\n", argv[0]);
+        return 1;
+    }
+    Adb adb;
+    if (!adb.load(argv[1], false, NULL, false)) {
+        printf("-E- %s\n", adb.getLastError().c_str());
+        return 1;
+    }
+    AdbInstance *node = adb.createLayout("mcia_ext", false, NULL);
+    if (!node) {
+        printf("-E- %s\n", adb.getLastError().c_str());
+        return 1;
+    }
+
+    std::vector<u_int8_t> buf(adb_regs::MCIA::size / 8);
+    srand(5);
+    for (size_t i = 0; i < buf.size(); i++) {
+        buf[i] = (u_int8_t)rand();
+    }
+    int errors = checkField<adb_regs::MCIA::page_number>(node, &buf[0]) +
+                 checkField<adb_regs::MCIA::device_address>(node, &buf[0]) +
+                 checkField<adb_regs::MCIA::i2c_device_address>(node, &buf[0]) +
+                 checkField<adb_regs::MCIA::module>(node, &buf[0]) +
+                 checkField<adb_regs::MCIA::size_>(node, &buf[0]) +
+                 checkField<adb_regs::MCIA::dword_0>(node, &buf[0]);
+    if (errors) {
+        return 1;
+    }
+
+    volatile u_int64_t sink;
+    u_int64_t sum = 0;
+    double t = now();
+    for (int i = 0; i < ROUNDS; i++) {
+        buf[6] = (u_int8_t)i;
+        sum += node->getChildByPath("page_number")->popBuf(&buf[0]);
+    }
+    printf("name lookup:    %6.2f ns per access\n", (now() - t) * 1e9 / ROUNDS);
+
+    AdbInstance *field = node->getChildByPath("page_number");
+    t = now();
+    for (int i = 0; i < ROUNDS; i++) {
+        buf[6] = (u_int8_t)i;
+        sum += field->popBuf(&buf[0]);
+    }
+    printf("AdbInstance:    %6.2f ns per access\n", (now() - t) * 1e9 / ROUNDS);
+
+    t = now();
+    for (int i = 0; i < ROUNDS; i++) {
+        buf[6] = (u_int8_t)i;
+        sum += adb_regs::MCIA::page_number::get(&buf[0]);
+    }
+    printf("typed accessor: %6.2f ns per access\n", (now() - t) * 1e9 / ROUNDS);
+    sink = sum;
+    (void)sink;
+    delete node;
+    return 0;
+}
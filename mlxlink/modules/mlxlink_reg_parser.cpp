@@ -34,12 +34,50 @@
 
 #include "mlxlink_reg_parser.h"
 
+MlxlinkRegCache::MlxlinkRegCache()
+{
+    _enabled = true;
+    _hits = 0;
+    _misses = 0;
+}
+
+bool MlxlinkRegCache::lookup(const string &key, std::vector<u_int32_t> &buffer)
+{
+    std::map<string, std::vector<u_int32_t> >::const_iterator it = _entries.find(key);
+    if (it == _entries.end()) {
+        _misses++;
+        return false;
+    }
+    _hits++;
+    buffer = it->second;
+    return true;
+}
+
+void MlxlinkRegCache::store(const string &key, const std::vector<u_int32_t> &buffer)
+{
+    _entries[key] = buffer;
+}
+
+void MlxlinkRegCache::clear()
+{
+    _entries.clear();
+}
+
+void MlxlinkRegCache::disable()
+{
+    _enabled = false;
+    _entries.clear();
+}
+
 MlxlinkRegParser::MlxlinkRegParser() : RegAccessParser("", "", NULL, 0)
 {
     _mf = NULL;
     _regLib = NULL;
     _gvmiAddress = 0;
     _mlxlinkLogger = NULL;
+    _regCache = NULL;
+    _lastLayout = LayoutKey(NULL, NULL);
+    _lastLayoutValid = false;
 }
 
 MlxlinkRegParser::~MlxlinkRegParser()
@@ -74,15 +112,35 @@ void MlxlinkRegParser::genBuffSendRegister(const string &regName, maccess_reg_me
 {
     DEBUG_LOG(_mlxlinkLogger, "%-15s: %s\n", "ACCESS_METHOD",
                 method == MACCESS_REG_METHOD_GET ? "GET": "SET");
+    _buffer = genBuffUnknown();
+    string cacheKey;
+    if (_regCache && _regCache->_enabled) {
+        if (method == MACCESS_REG_METHOD_GET) {
+            cacheKey = regName + ':';
+            if (!_buffer.empty()) {
+                cacheKey.append((const char*)&_buffer[0],
+                                _buffer.size() * sizeof(u_int32_t));
+            }
+            if (_regCache->lookup(cacheKey, _buffer)) {
+                DEBUG_LOG(_mlxlinkLogger, "%-15s: %s\n", "CACHED_RESULT",
+                          (char*)regName.c_str());
+                return;
+            }
+        } else {
+            _regCache->clear();
+        }
+    }
     if (_gvmiAddress) {
         writeGvmi(1);
     }
-    _buffer = genBuffUnknown();
     (_regLib)->sendRegister(regName, method, _buffer);
 
     if (_gvmiAddress) {
         writeGvmi(0);
     }
+    if (!cacheKey.empty()) {
+        _regCache->store(cacheKey, _buffer);
+    }
 }
 
 void MlxlinkRegParser::writeGvmi(u_int32_t data)
@@ -97,6 +155,13 @@ void MlxlinkRegParser::updateField(string field_name, u_int32_t value)
     RegAccessParser::updateField(field_name, value);
 }
 
+void MlxlinkRegParser::updateField(AdbInstance *field, u_int32_t value)
+{
+    DEBUG_LOG(_mlxlinkLogger, "%-15s: %-30s\tVALUE: 0x%08x (%d)\n",
+              "UPDATE_FIELD", (char*)field->name.c_str(),value,value);
+    RegAccessParser::updateField(field, value);
+}
+
 string MlxlinkRegParser::getFieldStr(const string &field)
 {
     return to_string(getFieldValue(field));
@@ -110,3 +175,42 @@ u_int32_t MlxlinkRegParser::getFieldValue(string field_name)
     return field_Val;
 }
 
+u_int32_t MlxlinkRegParser::getFieldValue(AdbInstance *field)
+{
+    u_int32_t field_Val = RegAccessParser::getFieldValue(field, _buffer);
+    DEBUG_LOG(_mlxlinkLogger,"%-15s: %-30s\tVALUE: 0x%08x (%d)\n","GET_FIELD",
+            (char*)field->name.c_str(),field_Val,field_Val) ;
+    return field_Val;
+}
+
+bool MlxlinkRegParser::isLayoutValid(RegFieldsFunc fields)
+{
+    LayoutKey key(_regNode, fields);
+    if (key == _lastLayout) {
+        return _lastLayoutValid;
+    }
+    std::map<LayoutKey, bool>::iterator it = _layoutChecks.find(key);
+    if (it == _layoutChecks.end()) {
+        // Compare every generated field with the register the device's ADB
+        // describes, a single difference disables the typed path for it
+        bool valid = _regNode != NULL;
+        size_t count = 0;
+        const AdbRegFieldDesc *desc = fields(count);
+        for (size_t i = 0; valid && i < count; i++) {
+            try {
+                AdbInstance *field = getFieldHandle(desc[i].name);
+                valid = field->offset == desc[i].offset && field->size == desc[i].size;
+            } catch (MlxRegException &exc) {
+                valid = false;
+            }
+        }
+        if (!valid) {
+            DEBUG_LOG(_mlxlinkLogger, "%-15s: %s\n", "LAYOUT_MISMATCH",
+                      _regNode ? _regNode->name.c_str() : "unknown register");
+        }
+        it = _layoutChecks.insert(std::make_pair(key, valid)).first;
+    }
+    _lastLayout = key;
+    _lastLayoutValid = it->second;
+    return _lastLayoutValid;
+}
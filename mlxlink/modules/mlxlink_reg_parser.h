@@ -36,6 +36,7 @@
 
 #include "mlxlink_utils.h"
 #include <mtcr.h>
+#include <adb_parser/adb_reg_field.h>
 
 using namespace mlxreg;
 #define PRINT_LOG(mlxlinklogger, title)\
@@ -48,6 +49,28 @@ using namespace mlxreg;
         mlxlinklogger->debugLog(format, __VA_ARGS__);\
     }\
 
+// Results of the GET accesses made during one run, keyed by the register name
+// and the request buffer (the index fields). Shared by a commander and the
+// sub-commanders it creates, any SET through one of them drops all entries
+// since writing one register can change what others report (e.g. PAOS and
+// PDDR).
+class MlxlinkRegCache {
+public:
+    MlxlinkRegCache();
+
+    bool lookup(const string &key, std::vector<u_int32_t> &buffer);
+    void store(const string &key, const std::vector<u_int32_t> &buffer);
+    void clear();
+    void disable();
+
+    bool _enabled;
+    u_int32_t _hits;
+    u_int32_t _misses;
+
+private:
+    std::map<string, std::vector<u_int32_t> > _entries;
+};
+
 class MlxlinkRegParser :public RegAccessParser{
 public:
     MlxlinkRegParser();
@@ -60,12 +83,51 @@ public:
     void writeGvmi(u_int32_t data);
     void updateField(string field_name, u_int32_t value);
     u_int32_t getFieldValue(string field_name);
+    void updateField(AdbInstance *field, u_int32_t value);
+    u_int32_t getFieldValue(AdbInstance *field);
     string getFieldStr(const string &field);
 
+    // Typed access through the structs generated in mlxlink_reg_layouts.h,
+    // e.g. updateField<adb_regs::MCIA::module>(module). The generated layout
+    // is checked once against the loaded ADB, on mismatch these fall back to
+    // the lookup by name.
+    template <class F> void updateField(u_int32_t value)
+    {
+        if (!isLayoutValid(&F::reg::fields)) {
+            updateField(string(F::name()), value);
+            return;
+        }
+        DEBUG_LOG(_mlxlinkLogger, "%-15s: %-30s\tVALUE: 0x%08x (%d)\n",
+                  "UPDATE_FIELD", F::name(), value, value);
+        updateBuffer(F::offset, F::size, value);
+    }
+
+    template <class F> u_int32_t getFieldValue()
+    {
+        if (!isLayoutValid(&F::reg::fields)) {
+            return getFieldValue(string(F::name()));
+        }
+        u_int32_t field_Val = (u_int32_t)F::get((const u_int8_t*)&_buffer[0]);
+        DEBUG_LOG(_mlxlinkLogger, "%-15s: %-30s\tVALUE: 0x%08x (%d)\n",
+                  "GET_FIELD", F::name(), field_Val, field_Val);
+        return field_Val;
+    }
+
     u_int32_t _gvmiAddress;
     MlxRegLib *_regLib;
     mfile *_mf;
     MlxlinkLogger *_mlxlinkLogger;
+    MlxlinkRegCache *_regCache;
+
+private:
+    typedef const AdbRegFieldDesc* (*RegFieldsFunc)(size_t &count);
+    typedef std::pair<AdbInstance*, RegFieldsFunc> LayoutKey;
+
+    bool isLayoutValid(RegFieldsFunc fields);
+
+    std::map<LayoutKey, bool> _layoutChecks;
+    LayoutKey _lastLayout;
+    bool _lastLayoutValid;
 };
 
 #endif /* MLXLINK_REG_PARSER_H */
@@ -1139,6 +1139,13 @@ int MlxlinkUi::run(int argc, char **argv)
                   + string(_cmdParser.GetErrDesc()));
     }
     paramValidate();
+    // BER collection, PRBS and eye scan sample live state, every GET must
+    // reach the device
+    if (isIn(SEND_BER_COLLECT, _sendRegFuncMap) ||
+            isIn(SEND_PRBS, _sendRegFuncMap) ||
+            isIn(GRADE_SCAN_ENABLE, _sendRegFuncMap)) {
+        _mlxlinkCommander->_regCache->disable();
+    }
     _mlxlinkCommander->_mf = mopen(_mlxlinkCommander->_device.c_str());;
     if (!_mlxlinkCommander->_mf) {
         throw MlxRegException(
@@ -1181,6 +1188,10 @@ int MlxlinkUi::run(int argc, char **argv)
                 _mlxlinkCommander->_userInput._logFilePath);
     }
     commandsCaller();
+    DEBUG_LOG(_mlxlinkCommander->_mlxlinkLogger,
+              "%-15s: %d of %d GET accesses served from cache\n", "REG_CACHE",
+              _mlxlinkCommander->_regCache->_hits,
+              _mlxlinkCommander->_regCache->_hits + _mlxlinkCommander->_regCache->_misses);
     if (_mlxlinkCommander->_allUnhandledErrors != "") {
         exit_code = 1;
         if (!MlxlinkRecord::jsonFormat) {
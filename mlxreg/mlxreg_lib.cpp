@@ -71,7 +71,8 @@ MlxRegLib::MlxRegLib(mfile *mf, string extAdbFile, bool isExternal)
         rootNode  = rootNode + "_ext";
     }
 
-    _regAccessRootNode  = _adb->createLayout(rootNode);
+    // Registers are instantiated on first access, most runs touch only a few
+    _regAccessRootNode  = _adb->createLayout(rootNode, false, NULL, -1, false, false, true);
     if (!_regAccessRootNode) {
         throw MlxRegException("No supported access registers found");
     }
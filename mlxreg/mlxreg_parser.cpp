@@ -322,13 +322,44 @@ void RegAccessParser::strToUint32(char *str, u_int32_t &uint)
 ************************************/
 AdbInstance* RegAccessParser::getField(string name)
 {
-    std::vector<AdbInstance*> subItems = _regNode->getLeafFields(true);
-    for (std::vector<AdbInstance*>::size_type i = 0; i != subItems.size(); i++) {
-        if (subItems[i]->name == name) {
-            return subItems[i];
+    return getFieldHandle(name);
+}
+
+/************************************
+* Function: getFieldHandle
+* The returned instance stays valid for as long as the register node does,
+* callers in hot loops should resolve it once and use the handle overloads
+* of updateField/getFieldValue.
+************************************/
+AdbInstance* RegAccessParser::getFieldHandle(const string &name)
+{
+    FieldIndex &index = getFieldIndex();
+    FieldIndex::iterator it = index.find(name);
+    if (it == index.end()) {
+        throw MlxRegException("Can't find field name: \"%s\"", name.c_str());
+    }
+    return it->second;
+}
+
+/************************************
+* Function: getFieldIndex
+************************************/
+RegAccessParser::FieldIndex& RegAccessParser::getFieldIndex()
+{
+    // _regNode may be switched by derived parsers, keep one index per node
+    std::map<AdbInstance*, FieldIndex>::iterator it = _fieldIndexes.find(_regNode);
+    if (it != _fieldIndexes.end()) {
+        return it->second;
+    }
+    FieldIndex &index = _fieldIndexes[_regNode];
+    if (_regNode) {
+        std::vector<AdbInstance*> subItems = _regNode->getLeafFields(true);
+        for (std::vector<AdbInstance*>::size_type i = 0; i != subItems.size(); i++) {
+            // Keep the first leaf on duplicate names, like the linear lookup did
+            index.insert(FieldIndex::value_type(subItems[i]->name, subItems[i]));
         }
     }
-    throw MlxRegException("Can't find field name: \"%s\"", name.c_str());
+    return index;
 }
 
 string RegAccessParser::getAccess(const AdbInstance *field)
@@ -385,3 +416,13 @@ u_int32_t RegAccessParser::getFieldValue(string field_name, std::vector<u_int32_
     AdbInstance *field = getField(field_name);
     return (u_int32_t)field->popBuf((u_int8_t*)&buff[0]);
 }
+
+void RegAccessParser::updateField(AdbInstance *field, u_int32_t value)
+{
+    updateBuffer(field->offset, field->size, value);
+}
+
+u_int32_t RegAccessParser::getFieldValue(AdbInstance *field, std::vector<u_int32_t>& buff)
+{
+    return (u_int32_t)field->popBuf((u_int8_t*)&buff[0]);
+}
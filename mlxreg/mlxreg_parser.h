@@ -37,6 +37,7 @@
 
 #include <string>
 #include <algorithm>
+#include <map>
 #include <adb_parser/adb_parser.h>
 #include "mlxreg_exception.h"
 
@@ -71,15 +72,22 @@ protected:
     void parseData();
     void parseUnknown();
     AdbInstance* getField(string name);
+    AdbInstance* getFieldHandle(const string &name);
     std::vector<string> strSplit(string str, char delimiter, bool forcePairs);
     void updateBuffer(u_int32_t offset, u_int32_t size, u_int32_t val);
     void updateBufferUnknwon(std::vector<string> fieldTokens);
     void updateField(string field_name, u_int32_t value);
     u_int32_t getFieldValue(string field_name, std::vector<u_int32_t>& buff);
+    void updateField(AdbInstance *field, u_int32_t value);
+    u_int32_t getFieldValue(AdbInstance *field, std::vector<u_int32_t>& buff);
     bool isRO(AdbInstance *field);
     bool isIndex(AdbInstance *field);
     std::vector<string> getAllIndexes(AdbInstance *node);
 private:
+    typedef std::map<string, AdbInstance*> FieldIndex;
+    // Leaf fields by name, built once per register node
+    std::map<AdbInstance*, FieldIndex> _fieldIndexes;
+    FieldIndex& getFieldIndex();
     bool checkAccess(const AdbInstance *field, const string accessStr);
 };
 
@@ -39,9 +39,12 @@
 #include <string.h>
 #include <cstdio>
 #include <stdexcept>
+#include <time.h>
+#include <sstream>
 #include <common/tools_utils.h>
 #include <common/tools_version.h>
 #include <mft_utils/mft_sig_handler.h>
+#include <mft_utils/mft_utils.h>
 #ifndef MST_UL
 #include <tools_layouts/adb_dbs.h>
 #include <cmdif/cib_cif.h>
@@ -113,6 +116,18 @@
 #define IGNORE_REG_CHECK_FLAG_SHORT ' '
 #define FORCE_FLAG                  "yes"
 #define FORCE_FLAG_SHORT            ' '
+#define BATCH_FLAG                  "batch"
+#define BATCH_FLAG_SHORT            ' '
+#define KEEP_GOING_FLAG             "keep_going"
+#define KEEP_GOING_FLAG_SHORT       ' '
+#define MONITOR_FLAG                "monitor"
+#define MONITOR_FLAG_SHORT          ' '
+#define INTERVAL_FLAG               "interval"
+#define INTERVAL_FLAG_SHORT         ' '
+#define COUNT_FLAG                  "count"
+#define COUNT_FLAG_SHORT            ' '
+
+#define DEFAULT_MONITOR_INTERVAL    1000
 
 using namespace mlxreg;
 
@@ -136,6 +151,10 @@ MlxRegUi::MlxRegUi() :
     _op             = CMD_UNKNOWN;
     _mlxRegLib      = NULL;
     _force          = false;
+    _batchFile      = "";
+    _keepGoing      = false;
+    _interval       = 0;
+    _count          = 0;
 #if defined(EXTERNAL) || defined(MST_UL)
     _isExternal     = true;
 #else
@@ -177,6 +196,11 @@ void MlxRegUi::initCmdParser()
     AddOptions(OP_SHOW_REGS_FLAG, OP_SHOW_REGS_FLAG_SHORT, "", "Print available registers names and exit");
     AddOptions(OP_SHOW_ALL_REGS_FLAG, OP_SHOW_ALL_REGS_FLAG_SHORT, "", "");
     AddOptions(FORCE_FLAG, FORCE_FLAG_SHORT, "", "");
+    AddOptions(BATCH_FLAG,        BATCH_FLAG_SHORT, "BatchFile", "Run register operations from a file");
+    AddOptions(KEEP_GOING_FLAG,   KEEP_GOING_FLAG_SHORT, "", "Continue the batch after a failure");
+    AddOptions(MONITOR_FLAG,      MONITOR_FLAG_SHORT, "MonitorFile", "Sample the registers listed in a file");
+    AddOptions(INTERVAL_FLAG,     INTERVAL_FLAG_SHORT, "Interval", "Monitor sampling interval (msec)");
+    AddOptions(COUNT_FLAG,        COUNT_FLAG_SHORT, "Count", "Number of monitor samples");
     _cmdParser.AddRequester(this);
 }
 
@@ -231,6 +255,21 @@ void MlxRegUi::printHelp()
     printFlagLine(OP_SHOW_REG_FLAG_SHORT,   OP_SHOW_REG_FLAG,  "reg_name", "Print the fields of a given reg access (must have reg_name)");
     printFlagLine(OP_SHOW_REGS_FLAG_SHORT,  OP_SHOW_REGS_FLAG, "", "Print all available reg access'");
     printFlagLine(FORCE_FLAG_SHORT,         FORCE_FLAG,        "", "Non-interactive mode, answer yes to all questions");
+    printFlagLine(BATCH_FLAG_SHORT,         BATCH_FLAG,        "file", "Run the operations listed in file (- for stdin), print JSON lines");
+    printFlagLine(KEEP_GOING_FLAG_SHORT,    KEEP_GOING_FLAG,   "", "Batch mode: continue after a failed operation");
+    printFlagLine(MONITOR_FLAG_SHORT,       MONITOR_FLAG,      "file", "GET the registers listed in file (- for stdin) periodically, print CSV");
+    printFlagLine(INTERVAL_FLAG_SHORT,      INTERVAL_FLAG,     "msec", "Monitor mode: sampling interval (default 1000)");
+    printFlagLine(COUNT_FLAG_SHORT,         COUNT_FLAG,        "samples", "Monitor mode: stop after this many samples (default: until interrupted)");
+
+    // print batch file format
+    printf("\n");
+    printf(IDENT "BATCH FILE:\n");
+    printf(IDENT2 "One operation per line, lines starting with '#' are ignored:\n");
+    printf(IDENT2 "get <reg_name> [idxs_vals]\n");
+    printf(IDENT2 "set <reg_name> <idxs_vals|-> <reg_dataStr>\n");
+    printf(IDENT2 "<reg_ID>:<reg_length> can be given instead of <reg_name>. SET operations require --%s\n", FORCE_FLAG);
+    printf(IDENT2 "A monitor file has GET operations only. Each field gets value, delta and rate (per second)\n");
+    printf(IDENT2 "columns, the _high and _low halves of a counter are joined into one field\n");
 
     // print usage examples
     printf("\n");
@@ -241,6 +280,8 @@ void MlxRegUi::printHelp()
            MLXREG_EXEC " -d <device> --get --reg_name PAOS --indexes \"local_port=0x1,swid=0x5\"");
     printf(IDENT2 "%-40s: \n" IDENT3 "%s\n", "SET PAOS with indexes: local port 0x1 and swid 0x5, and data: e 0x0",
            MLXREG_EXEC " -d <device> --set \"e=0x0\" --reg_name PAOS --indexes \"local_port=0x1,swid=0x5\"");
+    printf(IDENT2 "%-40s: %s\n", "Run the operations listed in ops.txt", MLXREG_EXEC " -d <device> --batch ops.txt --yes");
+    printf(IDENT2 "%-40s: %s\n", "Sample counters.txt every 100 msec", MLXREG_EXEC " -d <device> --monitor counters.txt --interval 100");
     printf("\n");
 }
 
@@ -395,6 +436,28 @@ ParseStatus MlxRegUi::HandleOption(string name, string value)
     } else if (name == FORCE_FLAG) {
         _force = true;
         return PARSE_OK;
+    } else if (name == KEEP_GOING_FLAG) {
+        _keepGoing = true;
+        return PARSE_OK;
+    } else if (name == BATCH_FLAG) {
+        CHECK_UNIQUE_OP(_op);
+        _op = CMD_BATCH;
+        _batchFile = value;
+        return PARSE_OK;
+    } else if (name == MONITOR_FLAG) {
+        CHECK_UNIQUE_OP(_op);
+        _op = CMD_MONITOR;
+        _batchFile = value; // same syntax as a batch file
+        return PARSE_OK;
+    } else if (name == INTERVAL_FLAG) {
+        RegAccessParser::strToUint32((char*)value.c_str(), _interval);
+        if (_interval == 0) {
+            throw MlxRegException("the monitor interval must be positive");
+        }
+        return PARSE_OK;
+    } else if (name == COUNT_FLAG) {
+        RegAccessParser::strToUint32((char*)value.c_str(), _count);
+        return PARSE_OK;
     } else if (name == OP_SET_FLAG) {
         CHECK_UNIQUE_OP(_op);
         _op = CMD_SET;
@@ -455,6 +518,431 @@ void MlxRegUi::paramValidate()
     if (_op == CMD_SET && _dataStr == "") {
         throw MlxRegException("you must provide registers data string to use SET");
     }
+    if (_op == CMD_BATCH || _op == CMD_MONITOR) {
+        if (_regName != "" || _regID != 0 || _indexesStr != "") {
+            throw MlxRegException("the register and its indexes are given in the batch file");
+        }
+    }
+    if (_keepGoing && _op != CMD_BATCH) {
+        throw MlxRegException("--%s can only be used with --%s", KEEP_GOING_FLAG, BATCH_FLAG);
+    }
+    if ((_interval || _count) && _op != CMD_MONITOR) {
+        throw MlxRegException("--%s and --%s can only be used with --%s", INTERVAL_FLAG, COUNT_FLAG, MONITOR_FLAG);
+    }
+}
+
+/************************************
+* Function: jsonStr
+************************************/
+static string jsonStr(const string& str)
+{
+    return "\"" + mft_utils::json_escape(str) + "\"";
+}
+
+/************************************
+* Function: fieldsToJson
+************************************/
+string MlxRegUi::fieldsToJson(AdbInstance *node, std::vector<u_int32_t>& buff)
+{
+    std::map<AdbInstance*, std::vector<AdbInstance*> >::iterator it = _leafFields.find(node);
+    if (it == _leafFields.end()) {
+        it = _leafFields.insert(std::make_pair(node, node->getLeafFields(true))).first;
+    }
+    std::vector<AdbInstance*>& subItems = it->second;
+    string json = "\"fields\":{";
+    for (std::vector<AdbInstance*>::size_type i = 0; i != subItems.size(); i++) {
+        char val[32];
+        snprintf(val, sizeof(val), "%llu", (unsigned long long)subItems[i]->popBuf((u_int8_t*)&buff[0]));
+        json += (i ? "," : "") + jsonStr(subItems[i]->name) + ":" + val;
+    }
+    return json + "}";
+}
+
+/************************************
+* Function: openBatchInput
+************************************/
+std::istream* MlxRegUi::openBatchInput(const string& fileName, std::ifstream& file)
+{
+    if (fileName == "-") {
+        return &std::cin;
+    }
+    file.open(fileName.c_str());
+    if (!file.is_open()) {
+        throw MlxRegException("Failed to open batch file: \"" + fileName + "\", " + strerror(errno));
+    }
+    return &file;
+}
+
+/************************************
+* Function: readBatchLine
+* Reads the next operation, skipping empty lines and comments
+************************************/
+static bool readBatchLine(std::istream& in, int& lineNum, std::vector<string>& tokens)
+{
+    string line;
+    while (std::getline(in, line)) {
+        lineNum++;
+        std::istringstream lineStream(line);
+        string token;
+        tokens.clear();
+        while (lineStream >> token) {
+            tokens.push_back(token);
+        }
+        if (!tokens.empty() && tokens[0][0] != '#') {
+            return true;
+        }
+    }
+    return false;
+}
+
+/************************************
+* Function: parseBatchReg
+* Known mode by name, unknown mode by <reg_ID>:<reg_length>
+************************************/
+AdbInstance* MlxRegUi::parseBatchReg(string& regName, u_int32_t& regID, u_int32_t& dataLen)
+{
+    string::size_type sep = regName.find(':');
+    if (sep == string::npos) {
+        return _mlxRegLib->findAdbNode(regName);
+    }
+    string idStr = regName.substr(0, sep);
+    string lenStr = regName.substr(sep + 1);
+    RegAccessParser::strToUint32((char*)idStr.c_str(), regID);
+    RegAccessParser::strToUint32((char*)lenStr.c_str(), dataLen);
+    if (regID == 0 || dataLen == 0) {
+        throw MlxRegException("invalid register id or length: %s", regName.c_str());
+    }
+    regName = "";
+    return NULL;
+}
+
+/************************************
+* Function: runBatchOp
+* Runs one batch line: <get|set> <reg_name|reg_ID:reg_length> [idxs_vals|-] [reg_dataStr]
+* and returns the JSON members describing its result
+************************************/
+string MlxRegUi::runBatchOp(const std::vector<string>& tokens)
+{
+    if (tokens.size() < 2 || tokens.size() > 4) {
+        throw MlxRegException("expected: <get|set> <reg_name> [indexes] [data]");
+    }
+    const string& op = tokens[0];
+    string regName = tokens[1];
+    string indexes = tokens.size() > 2 && tokens[2] != "-" ? tokens[2] : "";
+    string data = tokens.size() > 3 ? tokens[3] : "";
+    if (op != "get" && op != "set") {
+        throw MlxRegException("unknown operation: %s", op.c_str());
+    }
+    if (op == "get" && data != "") {
+        throw MlxRegException("data can't be given to get");
+    }
+    if (op == "set" && data == "") {
+        throw MlxRegException("you must provide registers data string to use SET");
+    }
+    if (op == "set" && !_force) {
+        throw MlxRegException("SET in batch mode requires --%s", FORCE_FLAG);
+    }
+
+    u_int32_t regID = 0;
+    u_int32_t dataLen = 0;
+    AdbInstance *regNode = parseBatchReg(regName, regID, dataLen);
+
+    // SET updates the current register data, like the command line does
+    RegAccessParser parserGet(data, indexes, regNode, dataLen);
+    std::vector<u_int32_t> buff = parserGet.genBuff();
+    if (regNode) {
+        _mlxRegLib->sendRegister(regName, MACCESS_REG_METHOD_GET, buff);
+    } else {
+        _mlxRegLib->sendRegister(regID, MACCESS_REG_METHOD_GET, buff);
+    }
+    if (op == "set") {
+        RegAccessParser parser(data, indexes, regNode, buff);
+        buff = parser.genBuff();
+        if (regNode) {
+            _mlxRegLib->sendRegister(regName, MACCESS_REG_METHOD_SET, buff);
+        } else {
+            _mlxRegLib->sendRegister(regID, MACCESS_REG_METHOD_SET, buff);
+        }
+    }
+
+    if (regNode) {
+        return fieldsToJson(regNode, buff);
+    }
+    string json = "\"data\":[";
+    for (std::vector<u_int32_t>::size_type i = 0; i != buff.size(); i++) {
+        char val[16];
+        snprintf(val, sizeof(val), "\"0x%08x\"", CPU_TO_BE32(buff[i]));
+        json += (i ? "," : "") + string(val);
+    }
+    return json + "]";
+}
+
+/************************************
+* Function: runBatch
+* Runs all the batch operations over the already loaded ADB and opened device,
+* one JSON object is printed per operation
+************************************/
+void MlxRegUi::runBatch()
+{
+    std::ifstream batchFile;
+    std::istream *in = openBatchInput(_batchFile, batchFile);
+
+    int lineNum = 0;
+    int numOfOps = 0;
+    int numOfFailures = 0;
+    std::vector<string> tokens;
+    while (readBatchLine(*in, lineNum, tokens)) {
+        numOfOps++;
+
+        char lineStr[16];
+        snprintf(lineStr, sizeof(lineStr), "%d", lineNum);
+        string json = string("{\"line\":") + lineStr + ",\"op\":" + jsonStr(tokens[0]);
+        if (tokens.size() > 1) {
+            json += ",\"reg\":" + jsonStr(tokens[1]);
+        }
+        bool failed = false;
+        try {
+            string result = runBatchOp(tokens);
+            json += ",\"status\":\"ok\"," + result;
+        } catch (MlxRegException& exp) {
+            json += ",\"status\":\"error\",\"error\":" + jsonStr(exp.what());
+            failed = true;
+        } catch (AdbException& exp) {
+            json += ",\"status\":\"error\",\"error\":" + jsonStr(exp.what());
+            failed = true;
+        }
+        printf("%s}\n", json.c_str());
+        fflush(stdout);
+
+        if (failed) {
+            numOfFailures++;
+            if (!_keepGoing) {
+                break;
+            }
+        }
+    }
+
+    if (numOfFailures) {
+        throw MlxRegException("%d of %d batch operations failed", numOfFailures, numOfOps);
+    }
+}
+
+/************************************
+* Function: csvStr
+************************************/
+static string csvStr(const string& str)
+{
+    if (str.find_first_of(",\"") == string::npos) {
+        return str;
+    }
+    string res = "\"";
+    for (string::size_type i = 0; i < str.size(); i++) {
+        if (str[i] == '"') {
+            res += '"';
+        }
+        res += str[i];
+    }
+    return res + "\"";
+}
+
+/************************************
+* Function: monotonicTime
+* Seconds since an arbitrary point, not affected by clock changes
+************************************/
+static double monotonicTime()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/************************************
+* Function: readMonitorField
+************************************/
+static u_int64_t readMonitorField(const MonitorField& field, std::vector<u_int32_t>& buff)
+{
+    if (!field.high) {
+        return CPU_TO_BE32(buff[field.dword]);
+    }
+    u_int64_t val = field.high->popBuf((u_int8_t*)&buff[0]);
+    if (field.low) {
+        val = (val << field.low->fieldDesc->eSize()) | field.low->popBuf((u_int8_t*)&buff[0]);
+    }
+    return val;
+}
+
+/************************************
+* Function: initMonitorReg
+* Prepares the request buffer and the columns of a monitor file line
+************************************/
+void MlxRegUi::initMonitorReg(const std::vector<string>& tokens, MonitorReg& reg)
+{
+    if (tokens[0] != "get" || tokens.size() < 2 || tokens.size() > 3) {
+        throw MlxRegException("expected: get <reg_name> [indexes]");
+    }
+    string indexes = tokens.size() > 2 && tokens[2] != "-" ? tokens[2] : "";
+    u_int32_t dataLen = 0;
+    reg.regName = tokens[1];
+    reg.regID = 0;
+    reg.sampled = false;
+    reg.prevTime = 0;
+    AdbInstance *regNode = parseBatchReg(reg.regName, reg.regID, dataLen);
+    RegAccessParser parser("", indexes, regNode, dataLen);
+    reg.request = parser.genBuff();
+
+    string prefix = tokens[1] + (indexes != "" ? "[" + indexes + "]" : "") + ".";
+    MonitorField field;
+    field.high = NULL;
+    field.low = NULL;
+    field.dword = 0;
+    field.counter = false;
+    field.prev = 0;
+    if (!regNode) {
+        for (u_int32_t i = 0; i < reg.request.size(); i++) {
+            char label[16];
+            snprintf(label, sizeof(label), "0x%08x", i * 4);
+            field.label = prefix + label;
+            field.dword = i;
+            field.size = 32;
+            reg.fields.push_back(field);
+        }
+        return;
+    }
+
+    std::map<AdbInstance*, std::vector<AdbInstance*> >::iterator it = _leafFields.find(regNode);
+    if (it == _leafFields.end()) {
+        it = _leafFields.insert(std::make_pair(regNode, regNode->getLeafFields(true))).first;
+    }
+    std::vector<AdbInstance*>& leafs = it->second;
+    // the counter groups of these registers all sit in their counter_set union
+    bool counterReg = reg.regName == "PPCNT" || reg.regName == "MPCNT";
+    for (std::vector<AdbInstance*>::size_type i = 0; i < leafs.size(); i++) {
+        const string& name = leafs[i]->name;
+        string::size_type highPos = name.rfind("_high");
+        field.high = leafs[i];
+        field.low = NULL;
+        field.size = leafs[i]->fieldDesc->eSize();
+        field.label = prefix + name;
+        field.counter = counterReg && leafs[i]->fullName().find(".counter_set.") != string::npos;
+        if (highPos != string::npos && highPos + 5 == name.size() && i + 1 < leafs.size() &&
+            leafs[i + 1]->name == name.substr(0, highPos) + "_low") {
+            field.low = leafs[++i];
+            field.size += field.low->fieldDesc->eSize();
+            field.label = prefix + name.substr(0, highPos);
+            field.counter = true;
+        }
+        reg.fields.push_back(field);
+    }
+}
+
+/************************************
+* Function: runMonitor
+* GETs the registers of the monitor file every interval and prints a CSV line
+* per sample: the time followed by value, delta and rate of each field.
+* Counter deltas wrap around at the field size, other fields get a signed
+* delta. A register that fails to read leaves its columns empty for that
+* sample, the next good sample is compared to the last good one.
+************************************/
+void MlxRegUi::runMonitor()
+{
+    std::ifstream monitorFile;
+    std::istream *in = openBatchInput(_batchFile, monitorFile);
+    std::vector<MonitorReg> regs;
+    int lineNum = 0;
+    std::vector<string> tokens;
+    while (readBatchLine(*in, lineNum, tokens)) {
+        regs.push_back(MonitorReg());
+        try {
+            initMonitorReg(tokens, regs.back());
+        } catch (MlxRegException& exp) {
+            throw MlxRegException("%s, in line %d", exp.what(), lineNum);
+        }
+    }
+    if (regs.empty()) {
+        throw MlxRegException("no registers to monitor");
+    }
+
+    string header = "time";
+    for (std::vector<MonitorReg>::size_type r = 0; r < regs.size(); r++) {
+        for (std::vector<MonitorField>::size_type f = 0; f < regs[r].fields.size(); f++) {
+            const string& label = regs[r].fields[f].label;
+            header += "," + csvStr(label) + "," + csvStr(label + ".delta") + "," + csvStr(label + ".rate");
+        }
+    }
+    printf("%s\n", header.c_str());
+
+    double interval = (_interval ? _interval : DEFAULT_MONITOR_INTERVAL) / 1000.0;
+    double start = monotonicTime();
+    double nextTime = start;
+    std::vector<u_int32_t> buff;
+    for (u_int32_t sample = 0; _count == 0 || sample < _count; sample++) {
+        // sleep to the next tick, the signal handler cuts it short
+        double now = monotonicTime();
+        if (nextTime > now) {
+            double wait = nextTime - now;
+            struct timespec ts;
+            ts.tv_sec = (time_t)wait;
+            ts.tv_nsec = (long)((wait - ts.tv_sec) * 1e9);
+            nanosleep(&ts, NULL);
+        }
+        if (mft_signal_is_fired()) {
+            break;
+        }
+        now = monotonicTime();
+        nextTime += interval;
+        if (nextTime < now) {
+            // the device is slower than the interval, don't try to catch up
+            nextTime = now + interval;
+        }
+
+        char val[64];
+        snprintf(val, sizeof(val), "%.3f", now - start);
+        string line = val;
+        for (std::vector<MonitorReg>::size_type r = 0; r < regs.size(); r++) {
+            MonitorReg& reg = regs[r];
+            buff = reg.request;
+            try {
+                if (reg.regName != "") {
+                    _mlxRegLib->sendRegister(reg.regName, MACCESS_REG_METHOD_GET, buff);
+                } else {
+                    _mlxRegLib->sendRegister(reg.regID, MACCESS_REG_METHOD_GET, buff);
+                }
+            } catch (MlxRegException& exp) {
+                if (reg.regName != "") {
+                    fprintf(stderr, "-W- %s at %.3f: %s\n", reg.regName.c_str(), now - start, exp.what());
+                } else {
+                    fprintf(stderr, "-W- 0x%x at %.3f: %s\n", reg.regID, now - start, exp.what());
+                }
+                for (std::vector<MonitorField>::size_type f = 0; f < reg.fields.size(); f++) {
+                    line += ",,,";
+                }
+                continue;
+            }
+            for (std::vector<MonitorField>::size_type f = 0; f < reg.fields.size(); f++) {
+                MonitorField& field = reg.fields[f];
+                u_int64_t cur = readMonitorField(field, buff);
+                if (!reg.sampled) {
+                    snprintf(val, sizeof(val), ",%llu,,", (unsigned long long)cur);
+                } else if (field.counter) {
+                    u_int64_t mask = field.size >= 64 ? ~(u_int64_t)0 : (((u_int64_t)1 << field.size) - 1);
+                    u_int64_t delta = (cur - field.prev) & mask;
+                    snprintf(val, sizeof(val), ",%llu,%llu,%.2f", (unsigned long long)cur,
+                             (unsigned long long)delta, delta / (now - reg.prevTime));
+                } else {
+                    // fields are at most 32 bits unless joined, and joined ones are counters
+                    long long delta = (long long)cur - (long long)field.prev;
+                    snprintf(val, sizeof(val), ",%llu,%lld,%.2f", (unsigned long long)cur,
+                             delta, delta / (now - reg.prevTime));
+                }
+                line += val;
+                field.prev = cur;
+            }
+            reg.sampled = true;
+            reg.prevTime = now;
+        }
+        printf("%s\n", line.c_str());
+        fflush(stdout);
+    }
 }
 
 void MlxRegUi::run(int argc, char **argv)
@@ -570,6 +1058,14 @@ void MlxRegUi::run(int argc, char **argv)
         }
         break;
 
+    case CMD_BATCH:
+        runBatch();
+        break;
+
+    case CMD_MONITOR:
+        runMonitor();
+        break;
+
     default:
         break;
     }
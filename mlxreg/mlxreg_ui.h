@@ -36,7 +36,9 @@
 #define MLXREG_UI_H
 
 #include <vector>
+#include <map>
 #include <iostream>
+#include <fstream>
 #include <common/compatibility.h>
 #include <cmdparser/cmdparser.h>
 #include <mtcr.h>
@@ -53,9 +55,31 @@ typedef enum {
     CMD_SHOW_REG,
     CMD_SHOW_REGS,
     CMD_SHOW_ALL_REGS,
+    CMD_BATCH,
+    CMD_MONITOR,
     CMD_UNKNOWN
 } MlxRegOper;
 
+// A monitored column, the _high/_low halves of a counter are joined into one
+typedef struct {
+    string label;
+    AdbInstance *high; // NULL in unknown mode, the column is a data dword
+    AdbInstance *low; // NULL unless joined
+    u_int32_t dword;
+    u_int32_t size; // in bits, counter deltas wrap around at this size
+    bool counter; // gauges and status fields get a signed delta instead
+    u_int64_t prev;
+} MonitorField;
+
+typedef struct {
+    string regName; // empty in unknown mode
+    u_int32_t regID;
+    std::vector<u_int32_t> request; // indexes are set once, sent on each sample
+    std::vector<MonitorField> fields;
+    bool sampled; // prev of the fields holds a value read at prevTime
+    double prevTime;
+} MonitorReg;
+
 class MlxRegUi : public CommandLineRequester
 {
 public:
@@ -70,6 +94,17 @@ private:
     void paramValidate();
     bool askUser(const char *question);
 
+    //Batch
+    std::istream* openBatchInput(const string& fileName, std::ifstream& file);
+    AdbInstance* parseBatchReg(string& regName, u_int32_t& regID, u_int32_t& dataLen);
+    void runBatch();
+    string runBatchOp(const std::vector<string>& tokens);
+    string fieldsToJson(AdbInstance *node, std::vector<u_int32_t>& buff);
+
+    //Monitor
+    void initMonitorReg(const std::vector<string>& tokens, MonitorReg& reg);
+    void runMonitor();
+
     //Print
     void printRegFields(vector<AdbInstance*> nodeFields);
     void printRegNames(std::vector<string> regs);
@@ -90,6 +125,11 @@ private:
     bool _force;
     MlxRegLib *_mlxRegLib;
     bool _isExternal;
+    string _batchFile;
+    bool _keepGoing;
+    u_int32_t _interval; // monitor sampling interval in msec
+    u_int32_t _count; // monitor samples, 0 means until interrupted
+    std::map<AdbInstance*, std::vector<AdbInstance*> > _leafFields; // per register, for batch output
 };
 
 #endif /* MLXREG_UI_H */
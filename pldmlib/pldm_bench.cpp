@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2020 Mellanox Technologies Ltd.  All rights reserved.
+ *
+ * This software is available to you under a choice of one of two
+ * licenses.  You may choose to be licensed under the terms of the GNU
+ * General Public License (GPL) Version 2, available from the file
+ * COPYING in the main directory of this source tree, or the
+ * OpenIB.org BSD license below:
+ *
+ *     Redistribution and use in source and binary forms, with or
+ *     without modification, are permitted provided that the following
+ *     conditions are met:
+ *
+ *      - Redistributions of source code must retain the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer.
+ *
+ *      - Redistributions in binary form must reproduce the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer in the documentation and/or other materials
+ *        provided with the distribution.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * pldm_bench.cpp
+ *
+ * Writes a synthetic PLDM package with many components, then times loading
+ * it, unpacking it, looking up the last device's PSID and reading that
+ * component. Not part of the build, from the top of a built tree:
+ *   g++ -O2 -Ipldmlib -Icommon pldmlib/pldm_bench.cpp pldmlib/libpldm.a -o pldm_bench
+ *   ./pldm_bench /tmp/big.pldm [components] [component size in KB]
+ * Component c holds the byte c & 0xff, device c (at most 255 devices, the
+ * record count is 8 bit) has the PSID MT_<c> and applies to component c.
+ * Set PLDM_DISABLE_MMAP=1 to time the read() fallback of PldmBuffer.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/time.h>
+#include <string>
+#include <vector>
+
+#include "pldm_buff.h"
+#include "pldm_pkg.h"
+#include "pldm_component_image.h"
+
+static const char *VERSION_STR = "1.0";
+
+static void put8(std::vector<u_int8_t>& buf, u_int8_t val)
+{
+    buf.push_back(val);
+}
+
+static void put16(std::vector<u_int8_t>& buf, u_int16_t val)
+{
+    put8(buf, val & 0xff);
+    put8(buf, val >> 8);
+}
+
+static void put32(std::vector<u_int8_t>& buf, u_int32_t val)
+{
+    put16(buf, val & 0xffff);
+    put16(buf, val >> 16);
+}
+
+static void putStr(std::vector<u_int8_t>& buf, const std::string& str)
+{
+    buf.insert(buf.end(), str.begin(), str.end());
+}
+
+static std::string psidOf(unsigned int dev)
+{
+    char psid[32];
+    snprintf(psid, sizeof(psid), "MT_%010u", dev);
+    return psid;
+}
+
+static bool writePackage(const char *path, unsigned int compsNum, u_int32_t compSize)
+{
+    unsigned int devsNum = compsNum < 255 ? compsNum : 255;
+    u_int16_t bitmapBits = ((compsNum + 7) / 8) * 8;
+    std::string ver = VERSION_STR;
+    std::vector<u_int8_t> hdr;
+
+    for (int i = 0; i < 16; i++) {
+        put8(hdr, PldmPkg::UUID[i]);
+    }
+    put8(hdr, 1);      // header format revision
+    put16(hdr, 0);     // header size
+    hdr.resize(hdr.size() + 13, 0); // release date time
+    put16(hdr, bitmapBits);
+    put8(hdr, 1);      // version string type
+    put8(hdr, ver.size());
+    putStr(hdr, ver);
+
+    put8(hdr, devsNum);
+    for (unsigned int dev = 0; dev < devsNum; dev++) {
+        std::string psid = psidOf(dev) + '\0';
+        std::vector<u_int8_t> body;
+        put8(body, 1);     // descriptor count
+        put32(body, 0);    // update option flags
+        put8(body, 1);     // version string type
+        put8(body, ver.size());
+        put16(body, 0);    // package data length
+        std::vector<u_int8_t> bitmap(bitmapBits / 8, 0);
+        bitmap[dev / 8] |= 1 << (dev % 8);
+        body.insert(body.end(), bitmap.begin(), bitmap.end());
+        putStr(body, ver);
+        put16(body, 0xffff); // vendor defined descriptor
+        put16(body, 2 + 4 + psid.size());
+        put8(body, 1);
+        put8(body, 4);
+        putStr(body, "PSID");
+        putStr(body, psid);
+        put16(hdr, body.size() + 2);
+        hdr.insert(hdr.end(), body.begin(), body.end());
+    }
+
+    u_int32_t compHdrLen = 2 + 2 + 4 + 2 + 2 + 4 + 4 + 1 + 1 + ver.size();
+    u_int32_t dataStart = hdr.size() + 2 + compsNum * compHdrLen + 4;
+    put16(hdr, compsNum);
+    for (unsigned int comp = 0; comp < compsNum; comp++) {
+        put16(hdr, 0xa);   // classification
+        put16(hdr, comp);  // identifier
+        put32(hdr, 0);     // comparison stamp
+        put16(hdr, 0);     // options
+        put16(hdr, 0);     // requested activation method
+        put32(hdr, dataStart + comp * compSize);
+        put32(hdr, compSize);
+        put8(hdr, 1);
+        put8(hdr, ver.size());
+        putStr(hdr, ver);
+    }
+    put32(hdr, 0);         // checksum
+
+    FILE *f = fopen(path, "wb");
+    if (!f) {
+        perror(path);
+        return false;
+    }
+    bool ok = fwrite(&hdr[0], 1, hdr.size(), f) == hdr.size();
+    std::vector<u_int8_t> data(compSize);
+    for (unsigned int comp = 0; ok && comp < compsNum; comp++) {
+        memset(&data[0], comp & 0xff, compSize);
+        ok = fwrite(&data[0], 1, compSize, f) == compSize;
+    }
+    if (fclose(f) || !ok) {
+        perror(path);
+        return false;
+    }
+    return true;
+}
+
+static double now()
+{
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec + tv.tv_usec / 1e6;
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc < 2) {
+        printf("usage: %s <output file> [components] [component size in KB]\n", argv[0]);
+        return 1;
+    }
+    unsigned int compsNum = argc > 2 ? strtoul(argv[2], NULL, 0) : 300;
+    u_int32_t compSize = (argc > 3 ? strtoul(argv[3], NULL, 0) : 1024) * 1024;
+    if (compsNum < 1 || compsNum > 0xffff || !compSize) {
+        printf("-E- bad component count or size\n");
+        return 1;
+    }
+    if (!writePackage(argv[1], compsNum, compSize)) {
+        return 1;
+    }
+
+    unsigned int dev = (compsNum < 255 ? compsNum : 255) - 1;
+    std::string psid = psidOf(dev);
+    double start = now();
+    PldmBuffer buff;
+    if (!buff.loadFile(argv[1])) {
+        printf("-E- failed to load %s\n", argv[1]);
+        return 1;
+    }
+    double loaded = now();
+    PldmPkg pkg;
+    if (!pkg.unpack(buff)) {
+        printf("-E- failed to unpack %s\n", argv[1]);
+        return 1;
+    }
+    double unpacked = now();
+    const PldmComponenetImage *image = pkg.getImageByPsid(psid);
+    if (!image || !image->getComponentData()) {
+        printf("-E- %s not found\n", psid.c_str());
+        return 1;
+    }
+    double found = now();
+    const u_int8_t *data = image->getComponentData();
+    unsigned long sum = 0;
+    for (u_int32_t i = 0; i < image->getComponentSize(); i++) {
+        sum += data[i];
+    }
+    double done = now();
+
+    printf("%u components of %u KB, %u devices\n", compsNum, compSize / 1024, dev + 1);
+    printf("load %.2f ms, unpack %.2f ms, lookup %.3f ms, read component %.2f ms, total %.2f ms\n",
+           (loaded - start) * 1000, (unpacked - loaded) * 1000, (found - unpacked) * 1000,
+           (done - found) * 1000, (done - start) * 1000);
+    if (sum != (unsigned long)(dev & 0xff) * compSize) {
+        printf("-E- component data of %s is wrong\n", psid.c_str());
+        return 1;
+    }
+    return 0;
+}
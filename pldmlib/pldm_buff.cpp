@@ -39,20 +39,77 @@
 #include <stdio.h>
 #include <string.h>
 #include <string>
+#ifndef __WIN__
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
 
 #include <compatibility.h>
 
 #include "pldm_buff.h"
 
 
-PldmBuffer::PldmBuffer(): m_buff(NULL), m_pos(0), m_size(0) {
+PldmBuffer::PldmBuffer(): m_buff(NULL), m_pos(0), m_size(0), m_mapped(false) {
 }
 
 PldmBuffer::~PldmBuffer() {
+    release();
+}
+
+void PldmBuffer::release() {
     if (m_buff) {
-        delete [] m_buff;
+#ifndef __WIN__
+        if (m_mapped) {
+            munmap(m_buff, m_size);
+        } else
+#endif
+        {
+            delete [] m_buff;
+        }
         m_buff = NULL;
     }
+    m_mapped = false;
+    m_pos = 0;
+    m_size = 0;
+}
+
+/*
+ * Mapping the package lets the pages of components nobody asks for stay on
+ * disk, which matters for bundles of hundreds of components.
+ */
+bool PldmBuffer::mapFile(const std::string& fname)
+{
+#ifndef __WIN__
+    struct stat st;
+    void *addr;
+    int fd;
+
+    if (getenv("PLDM_DISABLE_MMAP")) {
+        return false;
+    }
+    fd = open(fname.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    if (fstat(fd, &st) || st.st_size <= 0) {
+        close(fd);
+        return false;
+    }
+    addr = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (addr == MAP_FAILED) {
+        return false;
+    }
+    m_buff = (u_int8_t*)addr;
+    m_size = st.st_size;
+    m_mapped = true;
+    return true;
+#else
+    (void)fname;
+    return false;
+#endif
 }
 
 bool PldmBuffer::loadFile(const std::string& fname)
@@ -60,6 +117,11 @@ bool PldmBuffer::loadFile(const std::string& fname)
     // open the file:
     FILE * fp;
 
+    release();
+    if (mapFile(fname)) {
+        return true;
+    }
+
     fp = fopen(fname.c_str(), "rb");
     if (!fp) {
         return false;
@@ -69,41 +131,45 @@ bool PldmBuffer::loadFile(const std::string& fname)
     fseek(fp, 0, SEEK_END);
     m_size=ftell(fp);
     fseek(fp, 0, SEEK_SET);
-
-    //Allocate memory
-    if (m_buff) {
-        delete [] m_buff;
-        m_buff = NULL;
+    if (m_size < 0) {
+        m_size = 0;
+        fclose(fp);
+        return false;
     }
 
+    //Allocate memory
     m_buff= new u_int8_t[m_size+1];
     if (!m_buff)
     {
+        fclose(fp);
         return false;
     }
 
     //Read file contents into buffer
-    size_t read_size = fread(m_buff, m_size, 1, fp);
+    size_t read_size = fread(m_buff, 1, m_size, fp);
     fclose(fp);
 
     return (read_size == (size_t)m_size);
 }
 
+const u_int8_t * PldmBuffer::getData(long offset, long size) const {
+    if (!m_buff || offset < 0 || size < 0 || offset > m_size || size > m_size - offset) {
+        return NULL;
+    }
+    return m_buff + offset;
+}
 
 void PldmBuffer::read(u_int8_t & val) {
-    val = *(m_buff + m_pos);
-    m_pos += sizeof(u_int8_t);
+    read(&val, sizeof(val));
 }
 
 void PldmBuffer::read(u_int16_t & val) {
-    val = *(u_int16_t *)(m_buff + m_pos);
-    m_pos += sizeof(u_int16_t);
+    read((u_int8_t*)&val, sizeof(val));
     val = __le16_to_cpu(val);
 }
 
 void PldmBuffer::read(u_int32_t & val) {
-    val = *(u_int32_t *)(m_buff + m_pos);
-    m_pos += sizeof(u_int32_t);
+    read((u_int8_t*)&val, sizeof(val));
     val = __le32_to_cpu(val);
 }
 
@@ -114,8 +180,16 @@ void PldmBuffer::read(std::string& str, size_t str_size) {
     delete [] arr;
 }
 
+// reading past the end of a truncated package yields zeros instead of faulting
 void PldmBuffer::read(u_int8_t *arr, size_t arr_size) {
-    memcpy(arr, m_buff + m_pos, arr_size);
+    size_t avail = m_pos < m_size ? (size_t)(m_size - m_pos) : 0;
+    size_t copy_size = arr_size < avail ? arr_size : avail;
+    if (copy_size) {
+        memcpy(arr, m_buff + m_pos, copy_size);
+    }
+    if (copy_size < arr_size) {
+        memset(arr + copy_size, 0, arr_size - copy_size);
+    }
     m_pos += arr_size;
 }
 
@@ -45,6 +45,7 @@ public:
     PldmBuffer();
     virtual ~PldmBuffer();
 
+    // maps the file read-only where possible (PLDM_DISABLE_MMAP forces reading it)
     bool loadFile(const std::string& fname);
 
     void read(u_int8_t & val);
@@ -55,10 +56,18 @@ public:
 
     int seek(long offset, int whence);
     long tell();
+    long getSize() const { return m_size; }
+    // size bytes of the file at offset without copying them, NULL if out of range.
+    // valid as long as the buffer is.
+    const u_int8_t * getData(long offset, long size) const;
 private:
+    void release();
+    bool mapFile(const std::string& fname);
+
     u_int8_t * m_buff;
     long m_pos;
     long m_size;
+    bool m_mapped;
 };
 
 #endif /* _PLDM_BUFF_H_ */
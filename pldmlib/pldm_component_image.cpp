@@ -53,9 +53,6 @@ PldmComponenetImage::PldmComponenetImage(): componentClassification(0),
 }
 
 PldmComponenetImage::~PldmComponenetImage() {
-    if(componentData) {
-        delete [] componentData;
-    }
 }
 
 bool PldmComponenetImage::unpack(PldmBuffer & buff) {
@@ -75,14 +72,9 @@ bool PldmComponenetImage::unpack(PldmBuffer & buff) {
 }
 
 bool PldmComponenetImage::readComponentData(PldmBuffer & buff) {
-    componentData = new u_int8_t[componentSize];
-    // restore previous position
-    long pos = buff.tell();
-    buff.seek(componentLocationOffset, SEEK_SET);
-    buff.read(componentData, componentSize);
-    // restore previous position
-    buff.seek(pos, SEEK_SET);
-    return true;
+    // no copy: only the pages of the components actually used get read
+    componentData = buff.getData(componentLocationOffset, componentSize);
+    return componentData != NULL;
 }
 
 void PldmComponenetImage::print(FILE * fp) {
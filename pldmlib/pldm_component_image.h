@@ -45,6 +45,7 @@ public:
     bool unpack(PldmBuffer & buff);
     void print(FILE * fp);
     u_int32_t getComponentSize() const { return componentSize; }
+    // points into the PldmBuffer the image was unpacked from, NULL if out of its range
     const u_int8_t * getComponentData() const { return componentData; }
 
 private:
@@ -61,7 +62,7 @@ private:
     u_int8_t componentVersionStringLength;
     std::string componentVersionString;
 
-    u_int8_t * componentData;
+    const u_int8_t * componentData;
 };
 
 #endif /* _PLDM_COMPONENET_IMAGE_ */
@@ -47,7 +47,7 @@
 
 
 
-PldmDevIdRecord::PldmDevIdRecord(u_int8_t bitmapBitLength):
+PldmDevIdRecord::PldmDevIdRecord(u_int16_t bitmapBitLength):
         componentBitmapBitLength(bitmapBitLength), recordLength(0),
         descriptorCount(0), deviceUpdateOptionFlags(0),
         componentImageSetVersionStringType(0),
@@ -78,7 +78,7 @@ bool PldmDevIdRecord::unpack(PldmBuffer & buff) {
     buff.read(componentImageSetVersionStringLength);
     buff.read(firmwareDevicePackageDataLength);
     if(componentBitmapBitLength) {
-        u_int8_t applicableComponentsLen = componentBitmapBitLength/8;
+        u_int16_t applicableComponentsLen = componentBitmapBitLength/8;
         applicableComponents = new u_int8_t[applicableComponentsLen];
         buff.read(applicableComponents, applicableComponentsLen);
     }
@@ -103,8 +103,8 @@ void PldmDevIdRecord::print(FILE * fp) {
     fprintf(fp, "componentImageSetVersionStringLength: 0x%X\n", componentImageSetVersionStringLength);
     fprintf(fp, "firmwareDevicePackageDataLength: 0x%X\n", firmwareDevicePackageDataLength);
     if(componentBitmapBitLength) {
-        u_int8_t applicableComponentsLen = componentBitmapBitLength/8;
-        for(u_int8_t i=0; i<applicableComponentsLen; i++) {
+        u_int16_t applicableComponentsLen = componentBitmapBitLength/8;
+        for(u_int16_t i=0; i<applicableComponentsLen; i++) {
             fprintf(fp, "applicableComponents[%d]: 0x%X\n", i, applicableComponents[i]);
         }
     }
@@ -117,10 +117,10 @@ void PldmDevIdRecord::print(FILE * fp) {
 }
 
 int PldmDevIdRecord::getComponentImageIndex() const {
-    u_int8_t applicableComponentsLen = componentBitmapBitLength/8;
+    u_int16_t applicableComponentsLen = componentBitmapBitLength/8;
     int index = -1;
     static const u_int8_t index_map[] = {0x1, 0x2, 0x4, 0x8, 0x10, 0x20, 0x40, 0x80};
-    for(u_int8_t i=0; i<applicableComponentsLen; i++) {
+    for(u_int16_t i=0; i<applicableComponentsLen; i++) {
         u_int8_t flags = applicableComponents[i];
         for(u_int8_t j=0; j<8; j++) {
             if (flags & index_map[j]) {
@@ -42,7 +42,7 @@ class PldmRecordDescriptor;
 
 class PldmDevIdRecord {
 public:
-    PldmDevIdRecord(u_int8_t componentBitmapBitLength=0);
+    PldmDevIdRecord(u_int16_t componentBitmapBitLength=0);
     virtual ~PldmDevIdRecord();
     bool unpack(PldmBuffer & buff);
     int getComponentImageIndex() const;
@@ -50,7 +50,7 @@ public:
     std::string getDescription() const;
     void print(FILE * fp);
 private:
-    u_int8_t componentBitmapBitLength;
+    u_int16_t componentBitmapBitLength;
 
     u_int16_t recordLength;
     u_int8_t descriptorCount;
@@ -70,7 +70,7 @@ bool PldmPkg::unpack(PldmBuffer & buff) {
         return false;
     }
     buff.read(deviceIDRecordCount);
-    u_int8_t componentBitmapBitLength = \
+    u_int16_t componentBitmapBitLength = \
             packageHeader.getComponentBitmapBitLength();
     u_int8_t i;
     for(i=0; i< deviceIDRecordCount; i++) {
@@ -80,13 +80,16 @@ bool PldmPkg::unpack(PldmBuffer & buff) {
         psidImageMap[deviceIDRecord->getDevicePsid()] = deviceIDRecord->getComponentImageIndex();
     }
     buff.read(componentImageCount);
-    for(i=0; i< componentImageCount; i++) {
+    bool res = true;
+    for(u_int16_t j=0; j< componentImageCount; j++) {
         PldmComponenetImage * componentImage = new PldmComponenetImage();
-        componentImage->unpack(buff);
+        if (!componentImage->unpack(buff)) {
+            res = false;
+        }
         componentImages.push_back(componentImage);
     }
     buff.read(packageHeaderChecksum);
-    return true;
+    return res;
 }
 
 
@@ -100,9 +103,9 @@ void PldmPkg::print(FILE * fp) {
         deviceIDRecords[i]->print(fp);
     }
     fprintf(fp, "componentImageCount: 0x%X\n", componentImageCount);
-    for(i=0; i< componentImageCount; i++) {
-        fprintf(fp, "componentImages[%d]:\n", i);
-        componentImages[i]->print(fp);
+    for(u_int16_t j=0; j< componentImageCount; j++) {
+        fprintf(fp, "componentImages[%d]:\n", j);
+        componentImages[j]->print(fp);
     }
     fprintf(fp, "packageHeaderChecksum: 0x%X\n", packageHeaderChecksum);
 }
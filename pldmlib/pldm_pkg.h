@@ -53,6 +53,7 @@ public:
     PldmPkg();
     virtual ~PldmPkg();
 
+    // component images keep pointing into buff, it must outlive the package
     bool unpack(PldmBuffer & buff);
     void print(FILE * fp);
 
@@ -64,6 +65,7 @@ public:
     PldmDevIdRecord * getDeviceIDRecord(u_int8_t index) const {
         return deviceIDRecords[index];
     }
+    u_int16_t getComponentImageCount() const { return componentImageCount; }
     PldmComponenetImage * getComponentImage(u_int16_t index) const {
         return componentImages[index];
     }
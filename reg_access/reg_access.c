@@ -87,6 +87,7 @@
 #define REG_ID_MCC                      0x9062
 #define REG_ID_MCQI                     0x9061
 #define REG_ID_MCDA                     0x9063
+#define MCDA_REG_HEADER_LEN             16
 #define REG_ID_MQIS                     0x9064
 #define REG_ID_MCAM                     0x907f
 // TODO: get correct register ID for mfrl mfai
@@ -593,6 +594,55 @@ reg_access_status_t reg_access_mcda(mfile *mf, reg_access_method_t method, struc
     REG_ACCCESS(mf, method, REG_ID_MCDA, mcda, mcda_reg, reg_access_hca);
 }
 
+/************************************
+* Function: reg_access_mcda_var
+************************************/
+// MCDA with a data section of mcda->size bytes taken from/returned to data[] instead of the fixed 128 bytes
+// data[] dwords use the same encoding as mcda->data, only the header is taken from mcda.
+reg_access_status_t reg_access_mcda_var(mfile *mf, reg_access_method_t method, struct reg_access_hca_mcda_reg *mcda, u_int32_t *data)
+{
+    u_int32_t data_size = (mcda->size + 3) & ~0x3;
+    u_int32_t reg_size = MCDA_REG_HEADER_LEN + data_size;
+    u_int32_t r_size_reg = reg_size;
+    u_int32_t w_size_reg = reg_size;
+    u_int32_t buff_size = reg_access_hca_mcda_reg_size();
+    u_int32_t i;
+    int status = 0;
+    int rc;
+    u_int8_t *buff;
+    if (method == REG_ACCESS_METHOD_GET) {
+        w_size_reg -= data_size;
+    } else if (method == REG_ACCESS_METHOD_SET) {
+        r_size_reg -= data_size;
+    } else {
+        return ME_REG_ACCESS_BAD_METHOD;
+    }
+    if (reg_size > buff_size) {
+        buff_size = reg_size;
+    }
+    buff = (u_int8_t*)malloc(buff_size);
+    if (!buff) {
+        return ME_MEM_ERROR;
+    }
+    memset(buff, 0, buff_size);
+    reg_access_hca_mcda_reg_pack(mcda, buff);
+    for (i = 0; i < data_size / 4; i++) {
+        adb2c_push_integer_to_buff(buff, (MCDA_REG_HEADER_LEN + i * 4) * 8, 4, method == REG_ACCESS_METHOD_SET ? data[i] : 0);
+    }
+    rc = maccess_reg(mf, REG_ID_MCDA, (maccess_reg_method_t)method, buff, reg_size, r_size_reg, w_size_reg, &status);
+    if (rc || status) {
+        free(buff);
+        return (reg_access_status_t)rc;
+    }
+    if (method == REG_ACCESS_METHOD_GET) {
+        for (i = 0; i < data_size / 4; i++) {
+            data[i] = (u_int32_t)adb2c_pop_integer_from_buff(buff, (MCDA_REG_HEADER_LEN + i * 4) * 8, 4);
+        }
+    }
+    free(buff);
+    return ME_OK;
+}
+
 /************************************
 * Function: reg_access_mqis
 ************************************/
@@ -109,6 +109,7 @@ reg_access_status_t reg_access_secure_host(mfile *mf, reg_access_method_t method
  * MCXX new burn commands
  */
 reg_access_status_t reg_access_mcda(mfile *mf, reg_access_method_t method, struct reg_access_hca_mcda_reg *mcda);
+reg_access_status_t reg_access_mcda_var(mfile *mf, reg_access_method_t method, struct reg_access_hca_mcda_reg *mcda, u_int32_t *data);
 reg_access_status_t reg_access_mqis(mfile *mf, reg_access_method_t method, struct reg_access_hca_mqis_reg *mqis);
 reg_access_status_t reg_access_mcc(mfile *mf, reg_access_method_t method, struct reg_access_hca_mcc_reg *mcc );
 reg_access_status_t reg_access_mcqs(mfile *mf, reg_access_method_t method, struct reg_access_hca_mcqs_reg *mcqs);
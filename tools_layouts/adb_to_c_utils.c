@@ -76,10 +76,9 @@ u_int32_t adb2c_calc_array_field_address(u_int32_t start_bit_offset, u_int32_t a
 /************************************
  * Function: adb2c_push_integer_to_buff
  ************************************/
-void adb2c_push_integer_to_buff(u_int8_t *buff, u_int32_t bit_offset,  u_int32_t byte_size, u_int64_t field_value)
+void (adb2c_push_integer_to_buff)(u_int8_t *buff, u_int32_t bit_offset,  u_int32_t byte_size, u_int64_t field_value)
 {
-    field_value = ADB2C_CPU_TO_BE64(field_value);
-    memcpy(buff + bit_offset/8, (u_int8_t*)&field_value + (8-byte_size), (size_t)byte_size);
+    adb2c_push_integer_to_buff_inline(buff, bit_offset, byte_size, field_value);
 }
 
 /************************************
@@ -96,9 +95,17 @@ void adb2c_push_integer_to_buff_le(u_int8_t *buff, u_int32_t bit_offset,  u_int3
 /************************************
  * Function: adb2c_push_bits_to_buff
  ************************************/
+void (adb2c_push_bits_to_buff)(u_int8_t *buff, u_int32_t bit_offset, u_int32_t field_size, u_int32_t field_value)
+{
+    adb2c_push_bits_to_buff_inline(buff, bit_offset, field_size, field_value);
+}
+
+/************************************
+ * Function: adb2c_push_bits_to_buff_bytewise
+ ************************************/
 //the next function will push the field into the buffer by inserting it's MSB bits first
 //and therefore by doing it we save the CPU_TO_BE operation
-void adb2c_push_bits_to_buff(u_int8_t *buff, u_int32_t bit_offset, u_int32_t field_size, u_int32_t field_value)
+void adb2c_push_bits_to_buff_bytewise(u_int8_t *buff, u_int32_t bit_offset, u_int32_t field_size, u_int32_t field_value)
 {
     u_int32_t i 		= 0;
     u_int32_t byte_n	= bit_offset / 8;
@@ -169,11 +176,9 @@ void adb2c_push_to_buf_le(u_int8_t *buff, u_int32_t bit_offset, u_int32_t field_
 /************************************
  * Function: adb2c_pop_integer_from_buff
  ************************************/
-u_int64_t adb2c_pop_integer_from_buff(const u_int8_t *buff, u_int32_t bit_offset, u_int32_t byte_size)
+u_int64_t (adb2c_pop_integer_from_buff)(const u_int8_t *buff, u_int32_t bit_offset, u_int32_t byte_size)
 {
-    u_int64_t val = 0;
-    memcpy((u_int8_t*)&val + (8-byte_size), buff + bit_offset/8, (size_t)byte_size);
-    return ADB2C_BE64_TO_CPU(val);
+    return adb2c_pop_integer_from_buff_inline(buff, bit_offset, byte_size);
 }
 
 /************************************
@@ -189,9 +194,17 @@ u_int64_t adb2c_pop_integer_from_buff_le(const u_int8_t *buff, u_int32_t bit_off
 /************************************
  * Function: adb2c_pop_bits_from_buff
  ************************************/
+u_int32_t (adb2c_pop_bits_from_buff)(const u_int8_t *buff, u_int32_t bit_offset, u_int32_t field_size)
+{
+    return adb2c_pop_bits_from_buff_inline(buff, bit_offset, field_size);
+}
+
+/************************************
+ * Function: adb2c_pop_bits_from_buff_bytewise
+ ************************************/
 //the next function will pop the field into the buffer by removing it's MSB bits first
 //and therefore by doing it we save the BE_TO_CPU operation
-u_int32_t adb2c_pop_bits_from_buff(const u_int8_t *buff, u_int32_t bit_offset, u_int32_t field_size)
+u_int32_t adb2c_pop_bits_from_buff_bytewise(const u_int8_t *buff, u_int32_t bit_offset, u_int32_t field_size)
 {
     u_int32_t i 		= 0;
     u_int32_t byte_n	= bit_offset / 8;
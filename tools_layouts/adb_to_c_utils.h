@@ -109,7 +109,12 @@ extern "C" {
 #define ADB2C_BE32_TO_CPU(x)  ntohl(x)
 #define ADB2C_CPU_TO_BE16(x)  htons(x)
 #define ADB2C_BE16_TO_CPU(x)  ntohs(x)
-#ifdef _LITTLE_ENDIANESS
+#if defined(_LITTLE_ENDIANESS) && defined(__GNUC__)
+    #define ADB2C_CPU_TO_BE64(x) __builtin_bswap64((u_int64_t)(x))
+    #define ADB2C_BE64_TO_CPU(x) __builtin_bswap64((u_int64_t)(x))
+    #define ADB2C_LE64_TO_CPU(x) (x)
+    #define ADB2C_CPU_TO_LE64(x) (x)
+#elif defined(_LITTLE_ENDIANESS)
     #define ADB2C_CPU_TO_BE64(x) (((u_int64_t)htonl((u_int32_t)((x) & 0xffffffff)) << 32) |                             ((u_int64_t)htonl((u_int32_t)((x >> 32) & 0xffffffff))))
 
     #define ADB2C_BE64_TO_CPU(x) (((u_int64_t)ntohl((u_int32_t)((x) & 0xffffffff)) << 32) |                             ((u_int64_t)ntohl((u_int32_t)((x >> 32) & 0xffffffff))))
@@ -275,9 +280,11 @@ u_int32_t adb2c_calc_array_field_address(u_int32_t start_bit_offset, u_int32_t a
 /* Big Endian Functions */
 void adb2c_push_integer_to_buff(u_int8_t *buff, u_int32_t bit_offset,  u_int32_t byte_size, u_int64_t field_value);                                
 void adb2c_push_bits_to_buff(u_int8_t *buff, u_int32_t bit_offset, u_int32_t field_size, u_int32_t field_value);
+void adb2c_push_bits_to_buff_bytewise(u_int8_t *buff, u_int32_t bit_offset, u_int32_t field_size, u_int32_t field_value);
 void adb2c_push_to_buf(u_int8_t *buff, u_int32_t bit_offset, u_int32_t field_size, u_int64_t field_value);
 u_int64_t adb2c_pop_integer_from_buff(const u_int8_t *buff, u_int32_t bit_offset, u_int32_t byte_size);
 u_int32_t adb2c_pop_bits_from_buff(const u_int8_t *buff, u_int32_t bit_offset, u_int32_t field_size);
+u_int32_t adb2c_pop_bits_from_buff_bytewise(const u_int8_t *buff, u_int32_t bit_offset, u_int32_t field_size);
 u_int64_t adb2c_pop_from_buf(const u_int8_t *buff, u_int32_t bit_offset, u_int32_t field_size);
 
 /* Little Endian Functions */
@@ -288,6 +295,76 @@ u_int64_t adb2c_pop_integer_from_buff_le(const u_int8_t *buff, u_int32_t bit_off
 u_int32_t adb2c_pop_bits_from_buff_le(const u_int8_t *buff, u_int32_t bit_offset, u_int32_t field_size);
 u_int64_t adb2c_pop_from_buf_le(const u_int8_t *buff, u_int32_t bit_offset, u_int32_t field_size);
 
+/*
+ * Inline versions of the big endian push/pop functions. The generated
+ * pack/unpack functions pass constant offsets and sizes, so once inlined
+ * a field spanning at most four bytes is a single load/shift/mask/store and
+ * a 64 bit integer a single byte swap. Longer fields still go bit by bit
+ * through the bytewise versions.
+ * Only the bytes holding the field are read and written back, the same
+ * bytes the bytewise versions touch, so the caller's buffer may end right
+ * after the field.
+ */
+static inline void adb2c_push_bits_to_buff_inline(u_int8_t *buff, u_int32_t bit_offset, u_int32_t field_size, u_int32_t field_value)
+{
+    if (field_size && (bit_offset % 8) + field_size <= 32)
+    {
+        u_int32_t nbytes = ((bit_offset % 8) + field_size + 7) / 8;
+        u_int32_t shift  = 32 - (bit_offset % 8) - field_size;
+        u_int32_t mask   = (0xffffffffU >> (32 - field_size)) << shift;
+        u_int8_t *ptr    = buff + bit_offset / 8;
+        u_int32_t dword  = 0;
+
+        memcpy(&dword, ptr, (size_t)nbytes);
+        dword = (ADB2C_BE32_TO_CPU(dword) & ~mask) | ((field_value << shift) & mask);
+        dword = ADB2C_CPU_TO_BE32(dword);
+        memcpy(ptr, &dword, (size_t)nbytes);
+        return;
+    }
+    adb2c_push_bits_to_buff_bytewise(buff, bit_offset, field_size, field_value);
+}
+
+static inline u_int32_t adb2c_pop_bits_from_buff_inline(const u_int8_t *buff, u_int32_t bit_offset, u_int32_t field_size)
+{
+    if (field_size && (bit_offset % 8) + field_size <= 32)
+    {
+        u_int32_t nbytes = ((bit_offset % 8) + field_size + 7) / 8;
+        u_int32_t dword  = 0;
+
+        memcpy(&dword, buff + bit_offset / 8, (size_t)nbytes);
+        dword = ADB2C_BE32_TO_CPU(dword) >> (32 - (bit_offset % 8) - field_size);
+        return dword & (0xffffffffU >> (32 - field_size));
+    }
+    return adb2c_pop_bits_from_buff_bytewise(buff, bit_offset, field_size);
+}
+
+static inline void adb2c_push_integer_to_buff_inline(u_int8_t *buff, u_int32_t bit_offset, u_int32_t byte_size, u_int64_t field_value)
+{
+    field_value = ADB2C_CPU_TO_BE64(field_value);
+    memcpy(buff + bit_offset / 8, (u_int8_t*)&field_value + (8 - byte_size), (size_t)byte_size);
+}
+
+static inline u_int64_t adb2c_pop_integer_from_buff_inline(const u_int8_t *buff, u_int32_t bit_offset, u_int32_t byte_size)
+{
+    u_int64_t val = 0;
+    memcpy((u_int8_t*)&val + (8 - byte_size), buff + bit_offset / 8, (size_t)byte_size);
+    return ADB2C_BE64_TO_CPU(val);
+}
+
+/* Route the generated layouts (built with ADB2C_INLINE_PUSH_POP, see
+ * tools_layouts/Makefile.am) to the inline versions. Other callers and
+ * binary users of the library keep the exported out of line functions */
+#ifdef ADB2C_INLINE_PUSH_POP
+#define adb2c_push_bits_to_buff(buff, bit_offset, field_size, field_value) \
+    adb2c_push_bits_to_buff_inline((buff), (bit_offset), (field_size), (field_value))
+#define adb2c_pop_bits_from_buff(buff, bit_offset, field_size) \
+    adb2c_pop_bits_from_buff_inline((buff), (bit_offset), (field_size))
+#define adb2c_push_integer_to_buff(buff, bit_offset, byte_size, field_value) \
+    adb2c_push_integer_to_buff_inline((buff), (bit_offset), (byte_size), (field_value))
+#define adb2c_pop_integer_from_buff(buff, bit_offset, byte_size) \
+    adb2c_pop_integer_from_buff_inline((buff), (bit_offset), (byte_size))
+#endif
+
 
 void adb2c_add_indentation(FILE* file, int indent_level);
 
@@ -0,0 +1,162 @@
+/*
+ * Copyright (C) Jan 2013 Mellanox Technologies Ltd. All rights reserved.
+ *
+ * This software is available to you under a choice of one of two
+ * licenses.  You may choose to be licensed under the terms of the GNU
+ * General Public License (GPL) Version 2, available from the file
+ * COPYING in the main directory of this source tree, or the
+ * OpenIB.org BSD license below:
+ *
+ *     Redistribution and use in source and binary forms, with or
+ *     without modification, are permitted provided that the following
+ *     conditions are met:
+ *
+ *      - Redistributions of source code must retain the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer.
+ *
+ *      - Redistributions in binary form must reproduce the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer in the documentation and/or other materials
+ *        provided with the distribution.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * Differential test and benchmark of the inline adb2c push/pop functions
+ * against the bytewise ones. Not part of the build:
+ *   gcc -O2 -fsanitize=address -I. -I../common adb_to_c_utils_test.c adb_to_c_utils.c -o adb_to_c_utils_test
+ *   ./adb_to_c_utils_test [iterations] [seed]
+ *   ./adb_to_c_utils_test bench
+ * Each fuzzed field gets a heap buffer that ends with its last byte, so
+ * AddressSanitizer reports any access outside the field's bytes.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "adb_to_c_utils.h"
+
+static u_int32_t rand32(void)
+{
+    return ((u_int32_t)rand() << 16) ^ (u_int32_t)rand();
+}
+
+static int fuzz(unsigned long iterations)
+{
+    unsigned long i;
+    int errors = 0;
+
+    for (i = 0; i < iterations && errors < 10; i++) {
+        u_int32_t bit_offset = rand32() % 256;
+        u_int32_t field_size = 1 + rand32() % 32;
+        u_int32_t value = rand32();
+        u_int32_t len = (bit_offset + field_size + 7) / 8;
+        u_int8_t *ref = (u_int8_t*)malloc(len);
+        u_int8_t *buf = (u_int8_t*)malloc(len);
+        u_int32_t j;
+
+        if (!ref || !buf) {
+            printf("-E- out of memory\n");
+            return 1;
+        }
+        for (j = 0; j < len; j++) {
+            ref[j] = buf[j] = (u_int8_t)rand32();
+        }
+        if (adb2c_pop_bits_from_buff_inline(buf, bit_offset, field_size) !=
+            adb2c_pop_bits_from_buff_bytewise(ref, bit_offset, field_size)) {
+            printf("-E- pop mismatch: offset %u size %u\n", bit_offset, field_size);
+            errors++;
+        }
+        adb2c_push_bits_to_buff_inline(buf, bit_offset, field_size, value);
+        adb2c_push_bits_to_buff_bytewise(ref, bit_offset, field_size, value);
+        if (memcmp(buf, ref, len)) {
+            printf("-E- push mismatch: offset %u size %u value 0x%x\n", bit_offset, field_size, value);
+            errors++;
+        }
+        free(ref);
+        free(buf);
+    }
+    printf("%lu fields checked, %d mismatches\n", i, errors);
+    return errors != 0;
+}
+
+/* constant offsets, as in a generated unpack function */
+#define BENCH_UNPACK(pop, buff, sum) do { \
+        sum += pop(buff, 0, 8);           \
+        sum += pop(buff, 8, 8);           \
+        sum += pop(buff, 16, 16);         \
+        sum += pop(buff, 32, 1);          \
+        sum += pop(buff, 35, 4);          \
+        sum += pop(buff, 44, 20);         \
+        sum += pop(buff, 64, 32);         \
+        sum += pop(buff, 100, 12);        \
+} while (0)
+
+#define BENCH_PACK(push, buff, v) do { \
+        push(buff, 0, 8, v);           \
+        push(buff, 8, 8, v);           \
+        push(buff, 16, 16, v);         \
+        push(buff, 32, 1, v);          \
+        push(buff, 35, 4, v);          \
+        push(buff, 44, 20, v);         \
+        push(buff, 64, 32, v);         \
+        push(buff, 100, 12, v);        \
+} while (0)
+
+static double now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static int bench(void)
+{
+    const unsigned long rounds = 20000000;
+    u_int8_t buff[16];
+    volatile u_int32_t sink;
+    u_int32_t sum = 0;
+    unsigned long i;
+    double t;
+
+    memset(buff, 0x5a, sizeof(buff));
+    t = now();
+    for (i = 0; i < rounds; i++) {
+        BENCH_PACK(adb2c_push_bits_to_buff_bytewise, buff, (u_int32_t)i);
+        BENCH_UNPACK(adb2c_pop_bits_from_buff_bytewise, buff, sum);
+    }
+    t = now() - t;
+    sink = sum;
+    printf("bytewise: %.1f ns per pack+unpack of 8 fields\n", t * 1e9 / rounds);
+
+    sum = 0;
+    t = now();
+    for (i = 0; i < rounds; i++) {
+        BENCH_PACK(adb2c_push_bits_to_buff_inline, buff, (u_int32_t)i);
+        BENCH_UNPACK(adb2c_pop_bits_from_buff_inline, buff, sum);
+    }
+    t = now() - t;
+    sink = sum;
+    printf("inline:   %.1f ns per pack+unpack of 8 fields\n", t * 1e9 / rounds);
+    (void)sink;
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc > 1 && !strcmp(argv[1], "bench")) {
+        return bench();
+    }
+    srand(argc > 2 ? (unsigned)strtoul(argv[2], NULL, 0) : (unsigned)time(NULL));
+    return fuzz(argc > 1 ? strtoul(argv[1], NULL, 0) : 1000000);
+}
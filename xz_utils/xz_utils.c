@@ -40,6 +40,18 @@
 #include <lzma.h>
 #include "xz_utils.h"
 
+// blocks of the multi-threaded encoder, small enough to keep all threads busy on an MFA2 components block
+#define XZ_MT_BLOCK_SIZE (4 * 1024 * 1024)
+// largest output size the int32_t return value can report
+#define XZ_MAX_OUT_SIZE 0x7fffffffULL
+
+// ends a block without waiting for the other encoder threads to drain (same as LZMA_FULL_FLUSH single threaded)
+#if LZMA_VERSION >= 50040002
+#define XZ_BLOCK_ACTION LZMA_FULL_BARRIER
+#else
+#define XZ_BLOCK_ACTION LZMA_FULL_FLUSH
+#endif
+
 static int32_t init_encoder(lzma_stream *strm, u_int32_t preset, lzma_check check)
 {
     // Initialize the encoder using a preset. Set the integrity to check
@@ -81,6 +93,39 @@ static int32_t init_encoder(lzma_stream *strm, u_int32_t preset, lzma_check chec
 }
 
 
+static int32_t init_mt_encoder(lzma_stream *strm, u_int32_t preset, u_int32_t threads, lzma_check check)
+{
+#if LZMA_VERSION >= 50020002
+    lzma_mt mt;
+    memset(&mt, 0, sizeof(mt));
+    mt.flags = 0;
+    // the default (3 x dictionary size, 24 MiB and up) leaves most threads idle on a components block
+    mt.block_size = XZ_MT_BLOCK_SIZE;
+    mt.timeout = 0;
+    mt.preset = preset;
+    mt.filters = NULL;
+    mt.check = check;
+    mt.threads = threads ? threads : lzma_cputhreads();
+    if (mt.threads == 0) {
+        mt.threads = 1;
+    }
+    if (mt.threads > 1) {
+        lzma_ret ret = lzma_stream_encoder_mt(strm, &mt);
+        if (ret == LZMA_OK) {
+            return 0;
+        }
+        if (ret == LZMA_MEM_ERROR) {
+            return XZ_ERR_INTERNAL_MEM;
+        }
+        // fall back to the single threaded encoder
+    }
+#else
+    (void)threads;
+#endif
+    return init_encoder(strm, preset, check);
+}
+
+
 static int32_t init_decoder(lzma_stream *strm)
 {
     lzma_ret ret = lzma_stream_decoder(
@@ -108,7 +153,13 @@ static int32_t init_decoder(lzma_stream *strm)
 }
 
 
-static int32_t xcompress(lzma_stream *strm, u_int8_t *inbuf, u_int32_t insz, u_int8_t *outbuf, u_int32_t outsz)
+/*
+ * block_starts (optional, ascending) are input offsets at which a new xz block
+ * is started (XZ_BLOCK_ACTION), so a reader can decode from there using the
+ * stream index without decoding what comes before.
+ */
+static int32_t xcompress(lzma_stream *strm, u_int8_t *inbuf, u_int32_t insz, u_int8_t *outbuf, u_int32_t outsz,
+                         const u_int32_t *block_starts, u_int32_t num_block_starts, u_int8_t **growbuf)
 {
     // This will be LZMA_RUN until the end of the input file is reached.
     // This tells lzma_code() when there will be no more input.
@@ -125,18 +176,31 @@ static int32_t xcompress(lzma_stream *strm, u_int8_t *inbuf, u_int32_t insz, u_i
     u_int32_t rpos = 0;
     u_int32_t wpos = 0;
     u_int32_t chunk_sz = 0;
+    u_int32_t next_block = 0;
+    u_int32_t chunk_end;
+
+    while (next_block < num_block_starts && block_starts[next_block] == 0) {
+        next_block++;
+    }
 
     // Loop until the file has been successfully compressed or until
     // an error occurs.
     while (1) {
-        // Fill the input buffer if it is empty.
-        if (strm->avail_in == 0 && (rpos < insz)) {
+        // Fill the input buffer if it is empty, up to the next block start.
+        if (action == LZMA_RUN && strm->avail_in == 0 && (rpos < insz)) {
+            chunk_end = insz;
+            if (next_block < num_block_starts && block_starts[next_block] < insz) {
+                chunk_end = block_starts[next_block];
+            }
             strm->next_in = &inbuf[rpos];
-            chunk_sz = insz - rpos;
+            chunk_sz = chunk_end - rpos;
             strm->avail_in = chunk_sz;
         }
         if (rpos >= insz) {
             action = LZMA_FINISH;
+        } else if (action == LZMA_RUN && strm->avail_in == 0 && next_block < num_block_starts &&
+                   rpos == block_starts[next_block]) {
+            action = XZ_BLOCK_ACTION;
         }
 
         lzma_ret ret = lzma_code(strm, action);
@@ -147,8 +211,31 @@ static int32_t xcompress(lzma_stream *strm, u_int8_t *inbuf, u_int32_t insz, u_i
         if (((strm->avail_out == 0) && (ret == LZMA_OK)) || (ret == LZMA_STREAM_END)) {
             u_int32_t write_size = sizeof(obuf) - strm->avail_out;
 
-            if (outbuf) {
-                if (wpos + write_size > outsz) {
+            if (growbuf) {
+                // growable output, *growbuf is owned by the caller also on failure
+                u_int64_t needsz = (u_int64_t)wpos + write_size;
+                if (needsz > outsz) {
+                    if (needsz > XZ_MAX_OUT_SIZE) {
+                        return XZ_ERR_MEM_EXCEEDED;
+                    }
+                    u_int64_t newsz = outsz ? outsz : ((u_int64_t)insz / 4 + sizeof(obuf));
+                    while (newsz < needsz) {
+                        newsz *= 2;
+                    }
+                    if (newsz > XZ_MAX_OUT_SIZE) {
+                        newsz = XZ_MAX_OUT_SIZE;
+                    }
+                    u_int8_t *tmp = (u_int8_t*)realloc(outbuf, (size_t)newsz);
+                    if (tmp == NULL) {
+                        return XZ_ERR_INTERNAL_MEM;
+                    }
+                    outbuf = tmp;
+                    outsz = (u_int32_t)newsz;
+                    *growbuf = outbuf;
+                }
+                memcpy(&(outbuf[wpos]), obuf, write_size);
+            } else if (outbuf) {
+                if ((u_int64_t)wpos + write_size > outsz) {
                     return XZ_ERR_MEM_EXCEEDED;
                 }
 
@@ -170,6 +257,14 @@ static int32_t xcompress(lzma_stream *strm, u_int8_t *inbuf, u_int32_t insz, u_i
             // assume that getting ret != LZMA_OK would mean that
             // everything has gone well.
             if (ret == LZMA_STREAM_END) {
+                if (action == XZ_BLOCK_ACTION) {
+                    // block closed, continue with the next one
+                    action = LZMA_RUN;
+                    while (next_block < num_block_starts && block_starts[next_block] <= rpos) {
+                        next_block++;
+                    }
+                    continue;
+                }
                 break;
             }
 
@@ -233,7 +328,8 @@ static int32_t xcompress(lzma_stream *strm, u_int8_t *inbuf, u_int32_t insz, u_i
 
 
 static int32_t xpress(int comp_decomp_, u_int32_t preset, u_int8_t *inbuf,
-                      u_int32_t insz, u_int8_t *outbuf, u_int32_t outsz, lzma_check check)
+                      u_int32_t insz, u_int8_t *outbuf, u_int32_t outsz, lzma_check check,
+                      const u_int32_t *block_starts, u_int32_t num_block_starts)
 {
     int32_t rc;
     u_int32_t sz;
@@ -251,31 +347,211 @@ static int32_t xpress(int comp_decomp_, u_int32_t preset, u_int8_t *inbuf,
         return rc;
     }
 
-    sz = xcompress(&strm, inbuf, insz, outbuf, outsz);
+    sz = xcompress(&strm, inbuf, insz, outbuf, outsz, block_starts, num_block_starts, NULL);
     lzma_end(&strm);
     return sz;
 }
 
 int32_t xz_compress_crc32(u_int32_t preset, u_int8_t* inbuf, u_int32_t insz, u_int8_t* outbuf, u_int32_t outsz)
 {
-    return xpress(0, preset, inbuf, insz, outbuf, outsz, LZMA_CHECK_CRC32);
+    return xpress(0, preset, inbuf, insz, outbuf, outsz, LZMA_CHECK_CRC32, NULL, 0);
+}
+
+int32_t xz_compress_blocks_crc32(u_int32_t preset, u_int8_t *inbuf, u_int32_t insz, const u_int32_t *block_starts,
+                                 u_int32_t num_block_starts, u_int8_t *outbuf, u_int32_t outsz)
+{
+    return xpress(0, preset, inbuf, insz, outbuf, outsz, LZMA_CHECK_CRC32, block_starts, num_block_starts);
+}
+
+int32_t xz_compress_mt_crc32(u_int32_t preset, u_int32_t threads, u_int8_t *inbuf, u_int32_t insz,
+                             const u_int32_t *block_starts, u_int32_t num_block_starts, u_int8_t **outbuf)
+{
+    int32_t rc;
+    lzma_stream strm;
+    lzma_stream init_strm = LZMA_STREAM_INIT;
+
+    *outbuf = NULL;
+    strm = init_strm;
+    rc = init_mt_encoder(&strm, preset, threads, LZMA_CHECK_CRC32);
+    if (rc) {
+        return rc;
+    }
+    rc = xcompress(&strm, inbuf, insz, NULL, 0, block_starts, num_block_starts, outbuf);
+    lzma_end(&strm);
+    if (rc < 0) {
+        free(*outbuf);
+        *outbuf = NULL;
+    }
+    return rc;
 }
 
 int32_t xz_compress(u_int32_t preset, u_int8_t *inbuf, u_int32_t insz, u_int8_t *outbuf, u_int32_t outsz)
 {
-    return xpress(0, preset, inbuf, insz, outbuf, outsz, LZMA_CHECK_CRC64);
+    return xpress(0, preset, inbuf, insz, outbuf, outsz, LZMA_CHECK_CRC64, NULL, 0);
 }
 
 
 int32_t xz_decompress(u_int8_t *inbuf, u_int32_t insz, u_int8_t *outbuf, u_int32_t outsz)
 {
-    return xpress(1, 0, inbuf, insz, outbuf, outsz, LZMA_CHECK_CRC64);
+    return xpress(1, 0, inbuf, insz, outbuf, outsz, LZMA_CHECK_CRC64, NULL, 0);
 }
 
 int32_t xz_decompress_crc32(u_int8_t *inbuf, u_int32_t insz, u_int8_t *outbuf, u_int32_t outsz)
 {
-    return xpress(1, 0, inbuf, insz, outbuf, outsz, LZMA_CHECK_CRC32);
+    return xpress(1, 0, inbuf, insz, outbuf, outsz, LZMA_CHECK_CRC32, NULL, 0);
+}
+
+/*
+ * Decode from the current position of strm into outbuf, dropping the first
+ * *skip output bytes. Stops as soon as outbuf is full or the stream/block ends.
+ */
+static int32_t xdecode_into(lzma_stream *strm, u_int64_t *skip, u_int8_t *outbuf, u_int32_t outsz, u_int32_t *wpos)
+{
+    u_int8_t scratch[BUFSIZ];
+
+    while (*wpos < outsz) {
+        size_t avail;
+        if (*skip) {
+            avail = *skip < sizeof(scratch) ? (size_t)*skip : sizeof(scratch);
+            strm->next_out = scratch;
+        } else {
+            avail = outsz - *wpos;
+            strm->next_out = outbuf + *wpos;
+        }
+        strm->avail_out = avail;
+        lzma_ret ret = lzma_code(strm, LZMA_RUN);
+        size_t produced = avail - strm->avail_out;
+        if (*skip) {
+            *skip -= produced;
+        } else {
+            *wpos += produced;
+        }
+        if (ret == LZMA_STREAM_END) {
+            return 0;
+        }
+        if (ret == LZMA_MEM_ERROR) {
+            return XZ_ERR_INTERNAL_MEM;
+        }
+        if (ret != LZMA_OK || (produced == 0 && strm->avail_in == 0)) {
+            return XZ_ERR_DECODE_FAULT;
+        }
+    }
+    return 0;
+}
+
+/*
+ * Seek through the stream index: decode only the blocks covering
+ * [offset, offset + outsz). Returns 1 if the stream has no usable index
+ * (e.g. trailing padding or concatenated streams) so the caller can fall
+ * back to decoding from the start.
+ */
+static int32_t xdecode_range_indexed(u_int8_t *inbuf, u_int32_t insz, u_int64_t offset, u_int8_t *outbuf,
+                                     u_int32_t outsz)
+{
+    lzma_stream_flags footer;
+    lzma_index *idx = NULL;
+    lzma_index_iter iter;
+    u_int64_t memlimit = UINT64_MAX;
+    size_t in_pos = 0;
+    u_int64_t skip;
+    u_int32_t wpos = 0;
+    int32_t rc = 0;
+
+    if (insz < 2 * LZMA_STREAM_HEADER_SIZE ||
+        lzma_stream_footer_decode(&footer, inbuf + insz - LZMA_STREAM_HEADER_SIZE) != LZMA_OK ||
+        footer.backward_size > insz - 2 * LZMA_STREAM_HEADER_SIZE) {
+        return 1;
+    }
+    if (lzma_index_buffer_decode(&idx, &memlimit, NULL, inbuf + insz - LZMA_STREAM_HEADER_SIZE - footer.backward_size,
+                                 &in_pos, footer.backward_size) != LZMA_OK) {
+        return 1;
+    }
+    if (lzma_index_file_size(idx) != insz) {
+        lzma_index_end(idx, NULL);
+        return 1;
+    }
+    if (offset + outsz > lzma_index_uncompressed_size(idx)) {
+        lzma_index_end(idx, NULL);
+        return XZ_ERR_DECODE_FAULT;
+    }
+
+    lzma_index_iter_init(&iter, idx);
+    if (lzma_index_iter_locate(&iter, offset)) {
+        lzma_index_end(idx, NULL);
+        return XZ_ERR_DECODE_FAULT;
+    }
+    skip = offset - iter.block.uncompressed_file_offset;
+
+    while (wpos < outsz) {
+        lzma_stream strm = LZMA_STREAM_INIT;
+        lzma_filter filters[LZMA_FILTERS_MAX + 1];
+        lzma_block block;
+        u_int64_t pos = iter.block.compressed_file_offset;
+        u_int32_t i;
+
+        memset(&block, 0, sizeof(block));
+        block.version = 1;
+        block.check = footer.check;
+        block.filters = filters;
+        block.header_size = lzma_block_header_size_decode(inbuf[pos]);
+        if (pos + iter.block.total_size > insz ||
+            lzma_block_header_decode(&block, NULL, inbuf + pos) != LZMA_OK) {
+            rc = XZ_ERR_DECODE_FAULT;
+            break;
+        }
+        if (lzma_block_decoder(&strm, &block) != LZMA_OK) {
+            rc = XZ_ERR_DECODE_FAULT;
+        } else {
+            strm.next_in = inbuf + pos + block.header_size;
+            strm.avail_in = iter.block.total_size - block.header_size;
+            rc = xdecode_into(&strm, &skip, outbuf, outsz, &wpos);
+        }
+        lzma_end(&strm);
+        for (i = 0; filters[i].id != LZMA_VLI_UNKNOWN; i++) {
+            free(filters[i].options);
+        }
+        if (rc) {
+            break;
+        }
+        if (wpos < outsz && lzma_index_iter_next(&iter, LZMA_INDEX_ITER_NONEMPTY_BLOCK)) {
+            rc = XZ_ERR_DECODE_FAULT;
+            break;
+        }
+    }
+    lzma_index_end(idx, NULL);
+    return rc;
+}
+
+int32_t xz_decompress_range(u_int8_t *inbuf, u_int32_t insz, u_int64_t offset, u_int8_t *outbuf, u_int32_t outsz)
+{
+    int32_t rc;
+    lzma_stream strm = LZMA_STREAM_INIT;
+    u_int64_t skip = offset;
+    u_int32_t wpos = 0;
+
+    if (outsz == 0) {
+        return 0;
+    }
+    rc = xdecode_range_indexed(inbuf, insz, offset, outbuf, outsz);
+    if (rc <= 0) {
+        return rc ? rc : (int32_t)outsz;
+    }
+
+    // no index to seek with, decode from the start of the stream
+    rc = init_decoder(&strm);
+    if (rc) {
+        return rc;
+    }
+    strm.next_in = inbuf;
+    strm.avail_in = insz;
+    rc = xdecode_into(&strm, &skip, outbuf, outsz, &wpos);
+    lzma_end(&strm);
+    if (rc) {
+        return rc;
+    }
+    return wpos == outsz ? (int32_t)outsz : XZ_ERR_DECODE_FAULT;
 }
+
 const char* xz_get_error(int32_t error)
 {
     if (error == XZ_ERR_MEM_EXCEEDED) {
@@ -293,6 +569,9 @@ const char* xz_get_error(int32_t error)
     else if (error == XZ_ERR_ENCODE_FAULT) {
         return "XZ_ERR_ENCODE_FAULT";
     }
+    else if (error == XZ_ERR_DECODE_FAULT) {
+        return "XZ_ERR_DECODE_FAULT";
+    }
     else {
         return "UNKNOWN ERROR";
     }
@@ -47,13 +47,22 @@ enum
     XZ_ERR_INTERNAL_MEM         = -3,
     XZ_ERR_PRESET_NO_SUPP       = -4,
     XZ_ERR_INTEGRITY_NOT_SUPP   = -5,
-    XZ_ERR_ENCODE_FAULT         = -6
+    XZ_ERR_ENCODE_FAULT         = -6,
+    XZ_ERR_DECODE_FAULT         = -7
 };
 
 int32_t   xz_compress(u_int32_t preset, u_int8_t *inbuf, u_int32_t insz, u_int8_t *outbuf, u_int32_t outsz);
 int32_t   xz_decompress(u_int8_t *inbuf, u_int32_t insz, u_int8_t *outbuf, u_int32_t outsz);
 int32_t   xz_compress_crc32(u_int32_t preset, u_int8_t* inbuf, u_int32_t insz, u_int8_t* outbuf, u_int32_t outsz);
 int32_t   xz_decompress_crc32(u_int8_t *inbuf, u_int32_t insz, u_int8_t *outbuf, u_int32_t outsz);
+// like xz_compress_crc32, with a new xz block started at every offset in block_starts
+int32_t   xz_compress_blocks_crc32(u_int32_t preset, u_int8_t *inbuf, u_int32_t insz, const u_int32_t *block_starts,
+                                   u_int32_t num_block_starts, u_int8_t *outbuf, u_int32_t outsz);
+// single pass compression into a malloc'ed *outbuf (released with free()), threads == 0 uses one thread per CPU
+int32_t   xz_compress_mt_crc32(u_int32_t preset, u_int32_t threads, u_int8_t *inbuf, u_int32_t insz,
+                               const u_int32_t *block_starts, u_int32_t num_block_starts, u_int8_t **outbuf);
+// decompress only bytes [offset, offset + outsz) of the stream into outbuf, starting at the containing xz block
+int32_t   xz_decompress_range(u_int8_t *inbuf, u_int32_t insz, u_int64_t offset, u_int8_t *outbuf, u_int32_t outsz);
 const char* xz_get_error(int32_t error);
 #ifdef __cplusplus
 }